@@ -33,6 +33,14 @@ extern "C" {
 struct apache_geode_region_s;
 typedef struct apache_geode_region_s apache_geode_region_t;
 
+/**
+ * Values lent out by the borrowing calls below. The pointers handed out
+ * alongside a holder stay valid until it is passed to
+ * apache_geode_ReleaseValues.
+ */
+struct apache_geode_values_s;
+typedef struct apache_geode_values_s apache_geode_values_t;
+
 APACHE_GEODE_C_EXPORT void apache_geode_DestroyRegion(
     apache_geode_region_t* region);
 
@@ -42,12 +50,75 @@ APACHE_GEODE_C_EXPORT void apache_geode_Region_PutString(
 APACHE_GEODE_C_EXPORT void apache_geode_Region_PutByteArray(
     apache_geode_region_t* region, const char* key, const char* value, size_t size);
 
+/**
+ * Returns the string value of key, or NULL if there is none. The result is
+ * valid until the next call to this function on the same thread.
+ */
 APACHE_GEODE_C_EXPORT const char* apache_geode_Region_GetString(
     apache_geode_region_t* region, const char* key);
 
 APACHE_GEODE_C_EXPORT void apache_geode_Region_GetByteArray(
     apache_geode_region_t* region, const char* key, char** value, size_t* size);
 
+/**
+ * Copies the string value of key, without a terminating NUL, into buffer if
+ * it holds at least the number of bytes stored in size. Returns false if
+ * there is no string value for key; size then is 0.
+ */
+APACHE_GEODE_C_EXPORT bool apache_geode_Region_GetStringInto(
+    apache_geode_region_t* region, const char* key, char* buffer,
+    size_t capacity, size_t* size);
+
+/**
+ * Copies the byte array value of key into buffer if it holds at least the
+ * number of bytes stored in size. Returns false if there is no byte array
+ * value for key; size then is 0.
+ */
+APACHE_GEODE_C_EXPORT bool apache_geode_Region_GetByteArrayInto(
+    apache_geode_region_t* region, const char* key, char* buffer,
+    size_t capacity, size_t* size);
+
+/**
+ * Points value at the byte array value of key without copying it. Returns
+ * NULL, with value set to NULL, if there is no byte array value for key.
+ */
+APACHE_GEODE_C_EXPORT apache_geode_values_t*
+apache_geode_Region_BorrowByteArray(apache_geode_region_t* region,
+                                    const char* key, const char** value,
+                                    size_t* size);
+
+/**
+ * Gets the values of count keys in one round trip and points each entry of
+ * values at the corresponding byte array, or NULL if there is none.
+ */
+APACHE_GEODE_C_EXPORT apache_geode_values_t*
+apache_geode_Region_GetAllByteArrays(apache_geode_region_t* region,
+                                     const char* const* keys, size_t count,
+                                     const char** values, size_t* sizes);
+
+/**
+ * Gets the values of count keys in one round trip and points each entry of
+ * values at the corresponding NUL terminated string, or NULL if there is
+ * none.
+ */
+APACHE_GEODE_C_EXPORT apache_geode_values_t* apache_geode_Region_GetAllStrings(
+    apache_geode_region_t* region, const char* const* keys, size_t count,
+    const char** values);
+
+APACHE_GEODE_C_EXPORT void apache_geode_ReleaseValues(
+    apache_geode_values_t* values);
+
+APACHE_GEODE_C_EXPORT void apache_geode_Region_PutAllByteArrays(
+    apache_geode_region_t* region, const char* const* keys,
+    const char* const* values, const size_t* sizes, size_t count);
+
+APACHE_GEODE_C_EXPORT void apache_geode_Region_PutAllStrings(
+    apache_geode_region_t* region, const char* const* keys,
+    const char* const* values, size_t count);
+
+APACHE_GEODE_C_EXPORT void apache_geode_Region_RemoveAll(
+    apache_geode_region_t* region, const char* const* keys, size_t count);
+
 APACHE_GEODE_C_EXPORT void apache_geode_Region_Remove(
     apache_geode_region_t* region, const char* key);
 
@@ -0,0 +1,122 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string>
+
+#include <framework/Cluster.h>
+#include <framework/Framework.h>
+#include <framework/Gfsh.h>
+
+#include <gtest/gtest.h>
+
+#include "geode/cache.h"
+#include "geode/cache/factory.h"
+#include "geode/client.h"
+#include "geode/pool.h"
+#include "geode/pool/factory.h"
+#include "geode/pool/manager.h"
+#include "geode/region.h"
+#include "geode/region/factory.h"
+#include "geode/region/shortcut.h"
+
+TEST(CRegionTest, bulkAndBorrowedCallsWith1Server) {
+  Cluster cluster{LocatorCount{1}, ServerCount{1}};
+
+  cluster.start();
+
+  cluster.getGfsh()
+      .create()
+      .region()
+      .withName("region")
+      .withType("REPLICATE")
+      .execute();
+
+  auto client = apache_geode_ClientInitialize();
+  auto cache_factory = apache_geode_CreateCacheFactory();
+
+  apache_geode_CacheFactory_SetProperty(cache_factory, "log-level", "none");
+  apache_geode_CacheFactory_SetProperty(cache_factory,
+                                        "statistic-sampling-enabled", "false");
+
+  auto cache = apache_geode_CacheFactory_CreateCache(cache_factory);
+
+  auto pool_manager = apache_geode_Cache_GetPoolManager(cache);
+  auto pool_factory = apache_geode_PoolManager_CreateFactory(pool_manager);
+  apache_geode_PoolFactory_AddLocator(pool_factory, "localhost",
+                                      cluster.getLocatorPort());
+  auto pool = apache_geode_PoolFactory_CreatePool(pool_factory, "myPool");
+  auto region_factory = apache_geode_Cache_CreateRegionFactory(cache, PROXY);
+  apache_geode_RegionFactory_SetPoolName(region_factory, "myPool");
+  auto region =
+      apache_geode_RegionFactory_CreateRegion(region_factory, "region");
+
+  const char* keys[] = {"one", "two", "three"};
+  const char* bytes[] = {"a", "bb", "ccc"};
+  const size_t sizes[] = {1, 2, 3};
+  apache_geode_Region_PutAllByteArrays(region, keys, bytes, sizes, 2);
+
+  const char* values[3];
+  size_t valueSizes[3];
+  auto borrowed = apache_geode_Region_GetAllByteArrays(region, keys, 3, values,
+                                                       valueSizes);
+  ASSERT_EQ(valueSizes[0], 1u);
+  ASSERT_EQ(std::string(values[0], valueSizes[0]), "a");
+  ASSERT_EQ(valueSizes[1], 2u);
+  ASSERT_EQ(std::string(values[1], valueSizes[1]), "bb");
+  ASSERT_EQ(values[2], nullptr);
+  apache_geode_ReleaseValues(borrowed);
+
+  const char* value;
+  size_t size;
+  borrowed = apache_geode_Region_BorrowByteArray(region, "two", &value, &size);
+  ASSERT_EQ(std::string(value, size), "bb");
+  apache_geode_ReleaseValues(borrowed);
+
+  char buffer[8];
+  ASSERT_TRUE(apache_geode_Region_GetByteArrayInto(region, "two", buffer,
+                                                   sizeof(buffer), &size));
+  ASSERT_EQ(std::string(buffer, size), "bb");
+  ASSERT_TRUE(
+      apache_geode_Region_GetByteArrayInto(region, "two", buffer, 1, &size));
+  ASSERT_EQ(size, 2u);
+
+  const char* strings[] = {"uno", "dos", "tres"};
+  apache_geode_Region_PutAllStrings(region, keys, strings, 3);
+  borrowed = apache_geode_Region_GetAllStrings(region, keys, 3, values);
+  ASSERT_STREQ(values[0], "uno");
+  ASSERT_STREQ(values[2], "tres");
+  apache_geode_ReleaseValues(borrowed);
+
+  ASSERT_TRUE(apache_geode_Region_GetStringInto(region, "two", buffer,
+                                                sizeof(buffer), &size));
+  ASSERT_EQ(std::string(buffer, size), "dos");
+
+  apache_geode_Region_RemoveAll(region, keys, 2);
+  ASSERT_EQ(apache_geode_Region_GetString(region, "one"), nullptr);
+  ASSERT_STREQ(apache_geode_Region_GetString(region, "three"), "tres");
+
+  apache_geode_DestroyRegion(region);
+  apache_geode_DestroyRegionFactory(region_factory);
+  apache_geode_DestroyPool(pool);
+  apache_geode_DestroyPoolFactory(pool_factory);
+  apache_geode_DestroyPoolManager(pool_manager);
+  apache_geode_DestroyCache(cache);
+  apache_geode_DestroyCacheFactory(cache_factory);
+  auto leaks = apache_geode_ClientUninitialize(client);
+
+  ASSERT_EQ(leaks, 0);
+}
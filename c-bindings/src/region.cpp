@@ -16,14 +16,17 @@
  */
 
 // Standard headers
+#include <cstring>
 #include <memory>
 #include <string>
+#include <vector>
 
 #ifdef _WIN32
 #include <objbase.h>
 #endif  // _WIN32
 
 // C++ client public headers
+#include "geode/CacheableBuiltins.hpp"
 #include "geode/CacheableString.hpp"
 #include "geode/Region.hpp"
 #include "geode/RegionShortcut.hpp"
@@ -36,6 +39,40 @@
 #include "region.hpp"
 #include "region/factory.hpp"
 
+using apache::geode::client::Cacheable;
+using apache::geode::client::CacheableBytes;
+using apache::geode::client::CacheableKey;
+using apache::geode::client::CacheableString;
+using apache::geode::client::HashMapOfCacheable;
+
+namespace {
+
+std::vector<std::shared_ptr<CacheableKey>> MakeKeys(const char* const* keys,
+                                                    size_t count) {
+  std::vector<std::shared_ptr<CacheableKey>> keyList;
+  keyList.reserve(count);
+  for (size_t i = 0; i < count; i++) {
+    keyList.push_back(CacheableString::create(keys[i]));
+  }
+  return keyList;
+}
+
+std::shared_ptr<CacheableBytes> MakeBytes(const char* value, size_t size) {
+  auto bytes = reinterpret_cast<const int8_t*>(value);
+  return CacheableBytes::create(std::vector<int8_t>(bytes, bytes + size));
+}
+
+// Reports the size of value in any case, but only copies it if it fits.
+void CopyInto(const char* value, size_t valueSize, char* buffer,
+              size_t capacity, size_t* size) {
+  *size = valueSize;
+  if (valueSize <= capacity) {
+    std::memcpy(buffer, value, valueSize);
+  }
+}
+
+}  // namespace
+
 RegionWrapper::RegionWrapper(
     std::shared_ptr<apache::geode::client::Region> region)
     : region_(region) {
@@ -51,37 +88,145 @@ void RegionWrapper::PutString(const std::string& key,
 
 void RegionWrapper::PutByteArray(const std::string& key, const char* value,
                                  size_t size) {
-  std::vector<int8_t> val(value, value + size);
-  region_->put(key, apache::geode::client::CacheableBytes::create(val));
+  region_->put(key, MakeBytes(value, size));
 }
 
 const char* RegionWrapper::GetString(const std::string& key) {
-  auto value = region_->get(key);
-  lastValue_ =
-      std::dynamic_pointer_cast<apache::geode::client::CacheableString>(value)
-          ->value();
-  return lastValue_.c_str();
+  static thread_local std::string lastValue;
+
+  auto value = std::dynamic_pointer_cast<CacheableString>(region_->get(key));
+  if (!value) {
+    return nullptr;
+  }
+  lastValue = value->value();
+  return lastValue.c_str();
 }
 
 void RegionWrapper::GetByteArray(const std::string& key, char** value,
                                  size_t* size) {
-  std::shared_ptr<apache::geode::client::Serializable> val = region_->get(key);
+  auto bytes = std::dynamic_pointer_cast<CacheableBytes>(region_->get(key));
+  if (!bytes) return;
 
-  if (val.get() == nullptr) return;
-
-  auto bytes =
-      std::dynamic_pointer_cast<apache::geode::client::CacheableBytes>(val);
-  int valSize = val->objectSize();
+  // data() does not force a copy of values still in their reply buffer.
+  size_t valSize = bytes->length();
 #if defined(_WIN32)
   int8_t* byteArray = static_cast<int8_t*>(CoTaskMemAlloc(valSize));
 #else
   int8_t* byteArray = static_cast<int8_t*>(malloc(valSize));
 #endif
-  if (bytes) {
-    memcpy(byteArray, bytes->value().data(), valSize);
-    *value = reinterpret_cast<char*>(byteArray);
-    *size = valSize;
+  memcpy(byteArray, bytes->data(), valSize);
+  *value = reinterpret_cast<char*>(byteArray);
+  *size = valSize;
+}
+
+bool RegionWrapper::GetStringInto(const std::string& key, char* buffer,
+                                  size_t capacity, size_t* size) {
+  auto value = std::dynamic_pointer_cast<CacheableString>(region_->get(key));
+  if (!value) {
+    *size = 0;
+    return false;
+  }
+  const auto& string = value->value();
+  CopyInto(string.data(), string.size(), buffer, capacity, size);
+  return true;
+}
+
+bool RegionWrapper::GetByteArrayInto(const std::string& key, char* buffer,
+                                     size_t capacity, size_t* size) {
+  auto bytes = std::dynamic_pointer_cast<CacheableBytes>(region_->get(key));
+  if (!bytes) {
+    *size = 0;
+    return false;
   }
+  CopyInto(reinterpret_cast<const char*>(bytes->data()), bytes->length(),
+           buffer, capacity, size);
+  return true;
+}
+
+ValuesWrapper* RegionWrapper::BorrowByteArray(const std::string& key,
+                                              const char** value,
+                                              size_t* size) {
+  auto bytes = std::dynamic_pointer_cast<CacheableBytes>(region_->get(key));
+  if (!bytes) {
+    *value = nullptr;
+    *size = 0;
+    return nullptr;
+  }
+
+  *value = reinterpret_cast<const char*>(bytes->data());
+  *size = bytes->length();
+  auto values = new ValuesWrapper(1);
+  values->Retain(std::move(bytes));
+  return values;
+}
+
+ValuesWrapper* RegionWrapper::GetAllByteArrays(const char* const* keys,
+                                               size_t count,
+                                               const char** values,
+                                               size_t* sizes) {
+  const auto keyList = MakeKeys(keys, count);
+  const auto found = region_->getAll(keyList);
+
+  auto retained = new ValuesWrapper(found.size());
+  for (size_t i = 0; i < count; i++) {
+    values[i] = nullptr;
+    sizes[i] = 0;
+
+    const auto entry = found.find(keyList[i]);
+    if (entry == found.end()) continue;
+    if (auto bytes = std::dynamic_pointer_cast<CacheableBytes>(entry->second)) {
+      values[i] = reinterpret_cast<const char*>(bytes->data());
+      sizes[i] = bytes->length();
+      retained->Retain(std::move(bytes));
+    }
+  }
+  return retained;
+}
+
+ValuesWrapper* RegionWrapper::GetAllStrings(const char* const* keys,
+                                            size_t count,
+                                            const char** values) {
+  const auto keyList = MakeKeys(keys, count);
+  const auto found = region_->getAll(keyList);
+
+  auto retained = new ValuesWrapper(found.size());
+  for (size_t i = 0; i < count; i++) {
+    values[i] = nullptr;
+
+    const auto entry = found.find(keyList[i]);
+    if (entry == found.end()) continue;
+    if (auto string =
+            std::dynamic_pointer_cast<CacheableString>(entry->second)) {
+      values[i] = string->value().c_str();
+      retained->Retain(std::move(string));
+    }
+  }
+  return retained;
+}
+
+void RegionWrapper::PutAllByteArrays(const char* const* keys,
+                                     const char* const* values,
+                                     const size_t* sizes, size_t count) {
+  HashMapOfCacheable map(count);
+  for (size_t i = 0; i < count; i++) {
+    map.emplace(CacheableString::create(keys[i]),
+                MakeBytes(values[i], sizes[i]));
+  }
+  region_->putAll(map);
+}
+
+void RegionWrapper::PutAllStrings(const char* const* keys,
+                                  const char* const* values, size_t count) {
+  HashMapOfCacheable map(count);
+  for (size_t i = 0; i < count; i++) {
+    map.emplace(CacheableString::create(keys[i]),
+                CacheableString::create(values[i]));
+  }
+  region_->putAll(map);
+}
+
+void RegionWrapper::RemoveAll(const char* const* keys, size_t count) {
+  region_->removeAll(MakeKeys(keys, count));
 }
 
 void RegionWrapper::Remove(const std::string& key) { region_->remove(key); }
@@ -121,6 +266,71 @@ void apache_geode_Region_GetByteArray(apache_geode_region_t* region,
   return regionWrapper->GetByteArray(key, value, size);
 }
 
+bool apache_geode_Region_GetStringInto(apache_geode_region_t* region,
+                                       const char* key, char* buffer,
+                                       size_t capacity, size_t* size) {
+  RegionWrapper* regionWrapper = reinterpret_cast<RegionWrapper*>(region);
+  return regionWrapper->GetStringInto(key, buffer, capacity, size);
+}
+
+bool apache_geode_Region_GetByteArrayInto(apache_geode_region_t* region,
+                                          const char* key, char* buffer,
+                                          size_t capacity, size_t* size) {
+  RegionWrapper* regionWrapper = reinterpret_cast<RegionWrapper*>(region);
+  return regionWrapper->GetByteArrayInto(key, buffer, capacity, size);
+}
+
+apache_geode_values_t* apache_geode_Region_BorrowByteArray(
+    apache_geode_region_t* region, const char* key, const char** value,
+    size_t* size) {
+  RegionWrapper* regionWrapper = reinterpret_cast<RegionWrapper*>(region);
+  return reinterpret_cast<apache_geode_values_t*>(
+      regionWrapper->BorrowByteArray(key, value, size));
+}
+
+apache_geode_values_t* apache_geode_Region_GetAllByteArrays(
+    apache_geode_region_t* region, const char* const* keys, size_t count,
+    const char** values, size_t* sizes) {
+  RegionWrapper* regionWrapper = reinterpret_cast<RegionWrapper*>(region);
+  return reinterpret_cast<apache_geode_values_t*>(
+      regionWrapper->GetAllByteArrays(keys, count, values, sizes));
+}
+
+apache_geode_values_t* apache_geode_Region_GetAllStrings(
+    apache_geode_region_t* region, const char* const* keys, size_t count,
+    const char** values) {
+  RegionWrapper* regionWrapper = reinterpret_cast<RegionWrapper*>(region);
+  return reinterpret_cast<apache_geode_values_t*>(
+      regionWrapper->GetAllStrings(keys, count, values));
+}
+
+void apache_geode_ReleaseValues(apache_geode_values_t* values) {
+  ValuesWrapper* valuesWrapper = reinterpret_cast<ValuesWrapper*>(values);
+  delete valuesWrapper;
+}
+
+void apache_geode_Region_PutAllByteArrays(apache_geode_region_t* region,
+                                          const char* const* keys,
+                                          const char* const* values,
+                                          const size_t* sizes, size_t count) {
+  RegionWrapper* regionWrapper = reinterpret_cast<RegionWrapper*>(region);
+  regionWrapper->PutAllByteArrays(keys, values, sizes, count);
+}
+
+void apache_geode_Region_PutAllStrings(apache_geode_region_t* region,
+                                       const char* const* keys,
+                                       const char* const* values,
+                                       size_t count) {
+  RegionWrapper* regionWrapper = reinterpret_cast<RegionWrapper*>(region);
+  regionWrapper->PutAllStrings(keys, values, count);
+}
+
+void apache_geode_Region_RemoveAll(apache_geode_region_t* region,
+                                   const char* const* keys, size_t count) {
+  RegionWrapper* regionWrapper = reinterpret_cast<RegionWrapper*>(region);
+  regionWrapper->RemoveAll(keys, count);
+}
+
 void apache_geode_Region_Remove(apache_geode_region_t* region,
                                 const char* key) {
   RegionWrapper* regionWrapper = reinterpret_cast<RegionWrapper*>(region);
@@ -19,15 +19,29 @@
 
 #include <string>
 #include <memory>
+#include <vector>
 
 #include "client.hpp"
 #include "geode/Region.hpp"
 
 class RegionFactoryWrapper;
 
+// Keeps the values lent out by the borrowing region calls alive. Unlike the
+// other wrappers it is not recorded with the client, since one is created
+// and released on every such call.
+class ValuesWrapper {
+  std::vector<std::shared_ptr<apache::geode::client::Serializable>> values_;
+
+ public:
+  explicit ValuesWrapper(size_t count) { values_.reserve(count); }
+
+  void Retain(std::shared_ptr<apache::geode::client::Serializable> value) {
+    values_.push_back(std::move(value));
+  }
+};
+
 class RegionWrapper : public ClientKeeper {
   std::shared_ptr<apache::geode::client::Region> region_;
-  std::string lastValue_;
 
  public:
   explicit RegionWrapper(std::shared_ptr<apache::geode::client::Region> region);
@@ -41,6 +55,29 @@ class RegionWrapper : public ClientKeeper {
 
   void GetByteArray(const std::string& key, char** value, size_t* size);
 
+  bool GetStringInto(const std::string& key, char* buffer, size_t capacity,
+                     size_t* size);
+
+  bool GetByteArrayInto(const std::string& key, char* buffer, size_t capacity,
+                        size_t* size);
+
+  ValuesWrapper* BorrowByteArray(const std::string& key, const char** value,
+                                 size_t* size);
+
+  ValuesWrapper* GetAllByteArrays(const char* const* keys, size_t count,
+                                  const char** values, size_t* sizes);
+
+  ValuesWrapper* GetAllStrings(const char* const* keys, size_t count,
+                               const char** values);
+
+  void PutAllByteArrays(const char* const* keys, const char* const* values,
+                        const size_t* sizes, size_t count);
+
+  void PutAllStrings(const char* const* keys, const char* const* values,
+                     size_t count);
+
+  void RemoveAll(const char* const* keys, size_t count);
+
   void Remove(const std::string& key);
 
   bool ContainsValueForKey(const std::string& key);
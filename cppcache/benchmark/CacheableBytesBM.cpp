@@ -0,0 +1,79 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include <geode/CacheableBuiltins.hpp>
+
+#include "DataInputInternal.hpp"
+#include "DataOutputInternal.hpp"
+
+using apache::geode::client::CacheableBytes;
+using apache::geode::client::DataInputInternal;
+using apache::geode::client::DataOutputInternal;
+
+namespace {
+
+// A reply holding a single byte array value, as received for a get.
+std::shared_ptr<const uint8_t> createReply(size_t length, size_t& size) {
+  DataOutputInternal output;
+  output.writeBytes(std::vector<int8_t>(length, 42).data(),
+                    static_cast<int32_t>(length));
+  size = output.getBufferLength();
+  auto reply = new uint8_t[size];
+  std::memcpy(reply, output.getBuffer(), size);
+  return std::shared_ptr<const uint8_t>(reply,
+                                        std::default_delete<uint8_t[]>());
+}
+
+}  // namespace
+
+template <bool ZeroCopy>
+void CacheableBytesFromReplyBM(benchmark::State& state) {
+  size_t size;
+  const auto reply = createReply(state.range(0), size);
+  int64_t copied = 0;
+
+  for (auto _ : state) {
+    DataInputInternal input(reply.get(), size);
+    if (ZeroCopy) {
+      DataInputInternal::setBufferOwner(input, reply);
+    }
+    auto bytes = CacheableBytes::create();
+    bytes->fromData(input);
+    if (bytes->data() != reinterpret_cast<const int8_t*>(reply.get()) +
+                             (size - bytes->length())) {
+      copied += bytes->length();
+    }
+    benchmark::DoNotOptimize(bytes);
+  }
+
+  state.counters["bytes_copied"] = benchmark::Counter(
+      static_cast<double>(copied), benchmark::Counter::kAvgIterations);
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(CacheableBytesFromReplyBM, false)
+    ->RangeMultiplier(32)
+    ->Range(1 << 10, 32 << 20);
+BENCHMARK_TEMPLATE(CacheableBytesFromReplyBM, true)
+    ->RangeMultiplier(32)
+    ->Range(1 << 10, 32 << 20);
@@ -49,6 +49,34 @@ void GeodeHashBM(benchmark::State& state) {
   }
 }
 
+// The code point at a time hash for ASCII keys, as a baseline.
+void GeodeHashScalarAsciiBM(benchmark::State& state) {
+  std::string string;
+  for (int64_t i = 0; i < state.range(0); i++) {
+    string.push_back(static_cast<char>('a' + i % 26));
+  }
+
+  for (auto _ : state) {
+    uint32_t hashcode = 0;
+    for (auto&& c : string) {
+      hashcode = 31 * hashcode + static_cast<uint8_t>(c);
+    }
+    benchmark::DoNotOptimize(hashcode);
+  }
+}
+
+void GeodeHashAsciiBM(benchmark::State& state) {
+  std::string string;
+  for (int64_t i = 0; i < state.range(0); i++) {
+    string.push_back(static_cast<char>('a' + i % 26));
+  }
+
+  for (auto _ : state) {
+    int hashcode;
+    benchmark::DoNotOptimize(hashcode = geode_hash<std::string>{}(string));
+  }
+}
+
 constexpr char32_t LATIN_CAPITAL_LETTER_C = U'\U00000043';
 constexpr char32_t INVERTED_EXCLAMATION_MARK = U'\U000000A1';
 constexpr char32_t SAMARITAN_PUNCTUATION_ZIQAA = U'\U00000838';
@@ -70,3 +98,5 @@ BENCHMARK_TEMPLATE(GeodeHashBM, std::string, LINEAR_B_SYLLABLE_B008_A)
     ->Range(8, 8 << 10);
 BENCHMARK_TEMPLATE(GeodeHashBM, std::u16string, LINEAR_B_SYLLABLE_B008_A)
     ->Range(8, 8 << 10);
+BENCHMARK(GeodeHashScalarAsciiBM)->RangeMultiplier(2)->Range(8, 4 << 10);
+BENCHMARK(GeodeHashAsciiBM)->RangeMultiplier(2)->Range(8, 4 << 10);
@@ -0,0 +1,198 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "util/BigEndian.hpp"
+#include "util/JavaModifiedUtf8.hpp"
+#include "util/string.hpp"
+
+using apache::geode::client::to_utf16;
+using apache::geode::client::to_utf8;
+using apache::geode::client::internal::BigEndian;
+using apache::geode::client::internal::JavaModifiedUtf8;
+
+namespace {
+
+// The character at a time encoding, as a baseline.
+std::string encodeEachChar(const std::u16string& utf16) {
+  std::string jmutf8;
+  jmutf8.reserve(utf16.length());
+  for (auto&& c : utf16) {
+    JavaModifiedUtf8::encode(c, jmutf8);
+  }
+  return jmutf8;
+}
+
+std::u16string decodeEachChar(const std::string& jmutf8) {
+  std::u16string utf16;
+  auto buf = jmutf8.data();
+  const auto end = buf + jmutf8.length();
+  while (buf < end) {
+    utf16 += JavaModifiedUtf8::decodeJavaModifiedUtf8Char(&buf);
+  }
+  return utf16;
+}
+
+}  // namespace
+
+template <char32_t UnicodeChar>
+void JavaModifiedUtf8EncodeEachCharBM(benchmark::State& state) {
+  const auto utf16 = to_utf16(std::u32string(state.range(0), UnicodeChar));
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(encodeEachChar(utf16));
+  }
+}
+
+template <char32_t UnicodeChar>
+void JavaModifiedUtf8EncodeBM(benchmark::State& state) {
+  const auto utf16 = to_utf16(std::u32string(state.range(0), UnicodeChar));
+  std::vector<uint8_t> buf(utf16.length() * 3);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(JavaModifiedUtf8::encode(
+        utf16.data(), utf16.length(), buf.data(), buf.size()));
+  }
+}
+
+template <char32_t UnicodeChar>
+void JavaModifiedUtf8FromUtf8ViaUtf16BM(benchmark::State& state) {
+  const auto utf8 = to_utf8(std::u32string(state.range(0), UnicodeChar));
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(encodeEachChar(to_utf16(utf8)));
+  }
+}
+
+template <char32_t UnicodeChar>
+void JavaModifiedUtf8FromUtf8BM(benchmark::State& state) {
+  const auto utf8 = to_utf8(std::u32string(state.range(0), UnicodeChar));
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(JavaModifiedUtf8::fromString(utf8));
+  }
+}
+
+template <char32_t UnicodeChar>
+void JavaModifiedUtf8DecodeEachCharBM(benchmark::State& state) {
+  const auto jmutf8 = JavaModifiedUtf8::fromString(
+      to_utf16(std::u32string(state.range(0), UnicodeChar)));
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(decodeEachChar(jmutf8));
+  }
+}
+
+template <char32_t UnicodeChar>
+void JavaModifiedUtf8DecodeBM(benchmark::State& state) {
+  const auto jmutf8 = JavaModifiedUtf8::fromString(
+      to_utf16(std::u32string(state.range(0), UnicodeChar)));
+  const auto length = static_cast<uint16_t>(jmutf8.length());
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(JavaModifiedUtf8::decode(jmutf8.data(), length));
+  }
+}
+
+template <char32_t UnicodeChar>
+void JavaModifiedUtf8ToUtf8ViaUtf16BM(benchmark::State& state) {
+  const auto jmutf8 = JavaModifiedUtf8::fromString(
+      to_utf16(std::u32string(state.range(0), UnicodeChar)));
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(to_utf8(decodeEachChar(jmutf8)));
+  }
+}
+
+template <char32_t UnicodeChar>
+void JavaModifiedUtf8ToUtf8BM(benchmark::State& state) {
+  const auto jmutf8 = JavaModifiedUtf8::fromString(
+      to_utf16(std::u32string(state.range(0), UnicodeChar)));
+  const auto length = static_cast<uint16_t>(jmutf8.length());
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(JavaModifiedUtf8::toUtf8(jmutf8.data(), length));
+  }
+}
+
+void Utf16ToBigEndianEachCharBM(benchmark::State& state) {
+  const std::u16string utf16(state.range(0), u'C');
+  std::vector<uint8_t> buf(utf16.length() * 2);
+
+  for (auto _ : state) {
+    auto out = buf.data();
+    for (auto&& c : utf16) {
+      *(out++) = static_cast<uint8_t>(c >> 8);
+      *(out++) = static_cast<uint8_t>(c);
+    }
+    benchmark::DoNotOptimize(buf.data());
+  }
+}
+
+void Utf16ToBigEndianBM(benchmark::State& state) {
+  const std::u16string utf16(state.range(0), u'C');
+  std::vector<uint8_t> buf(utf16.length() * 2);
+
+  for (auto _ : state) {
+    BigEndian::write(utf16.data(), utf16.length(), 2, buf.data());
+    benchmark::DoNotOptimize(buf.data());
+  }
+}
+
+constexpr char32_t LATIN_CAPITAL_LETTER_C = U'\U00000043';
+constexpr char32_t INVERTED_EXCLAMATION_MARK = U'\U000000A1';
+constexpr char32_t SAMARITAN_PUNCTUATION_ZIQAA = U'\U00000838';
+constexpr char32_t LINEAR_B_SYLLABLE_B008_A = U'\U00010000';
+
+BENCHMARK_TEMPLATE(JavaModifiedUtf8EncodeEachCharBM, LATIN_CAPITAL_LETTER_C)
+    ->Range(8, 8 << 10);
+BENCHMARK_TEMPLATE(JavaModifiedUtf8EncodeBM, LATIN_CAPITAL_LETTER_C)
+    ->Range(8, 8 << 10);
+BENCHMARK_TEMPLATE(JavaModifiedUtf8EncodeEachCharBM, INVERTED_EXCLAMATION_MARK)
+    ->Range(8, 8 << 10);
+BENCHMARK_TEMPLATE(JavaModifiedUtf8EncodeBM, INVERTED_EXCLAMATION_MARK)
+    ->Range(8, 8 << 10);
+BENCHMARK_TEMPLATE(JavaModifiedUtf8FromUtf8ViaUtf16BM, LATIN_CAPITAL_LETTER_C)
+    ->Range(8, 8 << 10);
+BENCHMARK_TEMPLATE(JavaModifiedUtf8FromUtf8BM, LATIN_CAPITAL_LETTER_C)
+    ->Range(8, 8 << 10);
+BENCHMARK_TEMPLATE(JavaModifiedUtf8FromUtf8ViaUtf16BM,
+                   SAMARITAN_PUNCTUATION_ZIQAA)
+    ->Range(8, 8 << 10);
+BENCHMARK_TEMPLATE(JavaModifiedUtf8FromUtf8BM, SAMARITAN_PUNCTUATION_ZIQAA)
+    ->Range(8, 8 << 10);
+BENCHMARK_TEMPLATE(JavaModifiedUtf8FromUtf8ViaUtf16BM, LINEAR_B_SYLLABLE_B008_A)
+    ->Range(8, 8 << 10);
+BENCHMARK_TEMPLATE(JavaModifiedUtf8FromUtf8BM, LINEAR_B_SYLLABLE_B008_A)
+    ->Range(8, 8 << 10);
+BENCHMARK_TEMPLATE(JavaModifiedUtf8DecodeEachCharBM, LATIN_CAPITAL_LETTER_C)
+    ->Range(8, 8 << 10);
+BENCHMARK_TEMPLATE(JavaModifiedUtf8DecodeBM, LATIN_CAPITAL_LETTER_C)
+    ->Range(8, 8 << 10);
+BENCHMARK_TEMPLATE(JavaModifiedUtf8ToUtf8ViaUtf16BM, LATIN_CAPITAL_LETTER_C)
+    ->Range(8, 8 << 10);
+BENCHMARK_TEMPLATE(JavaModifiedUtf8ToUtf8BM, LATIN_CAPITAL_LETTER_C)
+    ->Range(8, 8 << 10);
+BENCHMARK_TEMPLATE(JavaModifiedUtf8ToUtf8ViaUtf16BM, INVERTED_EXCLAMATION_MARK)
+    ->Range(8, 8 << 10);
+BENCHMARK_TEMPLATE(JavaModifiedUtf8ToUtf8BM, INVERTED_EXCLAMATION_MARK)
+    ->Range(8, 8 << 10);
+BENCHMARK(Utf16ToBigEndianEachCharBM)->Range(8, 8 << 10);
+BENCHMARK(Utf16ToBigEndianBM)->Range(8, 8 << 10);
@@ -0,0 +1,68 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <mutex>
+#include <thread>
+
+#include "PdxType.hpp"
+#include "PdxTypeRegistry.hpp"
+
+using apache::geode::client::PdxType;
+using apache::geode::client::PdxTypeRegistry;
+
+namespace {
+
+const std::string CLASS_NAME = "com.example.Order";
+const int32_t TYPE_ID = 1971;
+
+PdxTypeRegistry& sharedRegistry() {
+  static PdxTypeRegistry pdxTypeRegistry(nullptr);
+  static std::once_flag registered;
+  std::call_once(registered, [] {
+    auto pdxType =
+        std::make_shared<PdxType>(pdxTypeRegistry, CLASS_NAME, true);
+    pdxTypeRegistry.addPdxType(TYPE_ID, pdxType);
+    pdxTypeRegistry.addLocalPdxType(CLASS_NAME, pdxType);
+  });
+  return pdxTypeRegistry;
+}
+
+}  // namespace
+
+static void PdxTypeBM_getPdxType(benchmark::State& state) {
+  auto& pdxTypeRegistry = sharedRegistry();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(pdxTypeRegistry.getPdxType(TYPE_ID));
+  }
+}
+
+static void PdxTypeBM_getLocalPdxType(benchmark::State& state) {
+  auto& pdxTypeRegistry = sharedRegistry();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(pdxTypeRegistry.getLocalPdxType(CLASS_NAME));
+  }
+}
+
+const auto MAX_THREADS = std::thread::hardware_concurrency() * 8;
+
+BENCHMARK(PdxTypeBM_getPdxType)->ThreadRange(1, MAX_THREADS)->UseRealTime();
+
+BENCHMARK(PdxTypeBM_getLocalPdxType)
+    ->ThreadRange(1, MAX_THREADS)
+    ->UseRealTime();
@@ -20,17 +20,22 @@
 #include <mutex>
 #include <thread>
 
+#include "DataOutputInternal.hpp"
 #include "SerializationRegistry.hpp"
 
 using apache::geode::client::DataInput;
 using apache::geode::client::DataOutput;
+using apache::geode::client::DataOutputInternal;
 using apache::geode::client::DataSerializable;
 using apache::geode::client::PdxReader;
 using apache::geode::client::PdxSerializable;
 using apache::geode::client::PdxWriter;
+using apache::geode::client::Serializable;
+using apache::geode::client::SerializationRegistry;
 using apache::geode::client::TheTypeMap;
 using apache::geode::client::TypeFactoryMethod;
 using apache::geode::client::TypeFactoryMethodPdx;
+using apache::geode::client::internal::DataSerializablePrimitive;
 using apache::geode::client::internal::DSCode;
 using apache::geode::client::internal::DSFid;
 
@@ -65,6 +70,17 @@ class TestDataSerializableClass : public DataSerializable {
   }
 };
 
+class TestPrimitiveClass : public DataSerializablePrimitive {
+ public:
+  TestPrimitiveClass() = default;
+
+  void fromData(DataInput&) override {}
+
+  void toData(DataOutput& output) const override { output.writeInt(42); }
+
+  DSCode getDsCode() const override { return DSCode::CacheableInt32; }
+};
+
 static void SerializationRegistryBM_findDataSerializablePrimitive(
     benchmark::State& state) {
   TheTypeMap theTypeMap;
@@ -103,6 +119,41 @@ static void SerializationRegistryBM_findPdxSerializable(
   }
 }
 
+static void SerializationRegistryBM_findDataSerializablePrimitiveShared(
+    benchmark::State& state) {
+  static TheTypeMap theTypeMap;
+  for (auto _ : state) {
+    TypeFactoryMethod func;
+    theTypeMap.findDataSerializablePrimitive(DSCode::CacheableString, func);
+  }
+}
+
+static void SerializationRegistryBM_findDataSerializableFixedIdShared(
+    benchmark::State& state) {
+  static TheTypeMap theTypeMap;
+  for (auto _ : state) {
+    TypeFactoryMethod func;
+    theTypeMap.findDataSerializableFixedId(DSFid::EventId, func);
+  }
+}
+
+template <bool Tagged>
+void SerializationRegistryBM_serialize(benchmark::State& state) {
+  SerializationRegistry serializationRegistry;
+  DataOutputInternal output;
+
+  // A copy carries no serialization kind and takes the dynamic_cast path.
+  TestPrimitiveClass primitive;
+  std::shared_ptr<Serializable> value =
+      Tagged ? std::make_shared<TestPrimitiveClass>()
+             : std::make_shared<TestPrimitiveClass>(primitive);
+
+  for (auto _ : state) {
+    output.reset();
+    serializationRegistry.serialize(value, output);
+  }
+}
+
 const auto MAX_THREADS = std::thread::hardware_concurrency() * 8;
 
 BENCHMARK(SerializationRegistryBM_findDataSerializablePrimitive)
@@ -120,3 +171,19 @@ BENCHMARK(SerializationRegistryBM_findDataSerializable)
 BENCHMARK(SerializationRegistryBM_findPdxSerializable)
     ->ThreadRange(1, MAX_THREADS)
     ->UseRealTime();
+
+BENCHMARK(SerializationRegistryBM_findDataSerializablePrimitiveShared)
+    ->ThreadRange(1, MAX_THREADS)
+    ->UseRealTime();
+
+BENCHMARK(SerializationRegistryBM_findDataSerializableFixedIdShared)
+    ->ThreadRange(1, MAX_THREADS)
+    ->UseRealTime();
+
+BENCHMARK_TEMPLATE(SerializationRegistryBM_serialize, true)
+    ->ThreadRange(1, MAX_THREADS)
+    ->UseRealTime();
+
+BENCHMARK_TEMPLATE(SerializationRegistryBM_serialize, false)
+    ->ThreadRange(1, MAX_THREADS)
+    ->UseRealTime();
@@ -0,0 +1,74 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_COMPRESSOR_H_
+#define GEODE_COMPRESSOR_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "internal/geode_globals.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * Implement the <code>Compressor</code> interface to keep the values of a
+ * caching region compressed in the local cache.
+ *
+ * When a region has a compressor every value added to its local cache is
+ * serialized and compressed, and it is decompressed and deserialized again
+ * each time it is read, so every read returns a new copy of the value. The
+ * heap LRU accounts for the compressed size. A delta received for a compressed
+ * value is not applied locally, the full value is fetched from the server
+ * instead.
+ *
+ * Implementations must be thread safe. {@link LZ4Compressor} is a built-in
+ * implementation favoring speed over compression ratio.
+ *
+ * @see RegionAttributesFactory::setCompressor
+ */
+class APACHE_GEODE_EXPORT Compressor {
+ public:
+  virtual ~Compressor() noexcept = default;
+
+  /**
+   * Compresses length bytes of input.
+   *
+   * @return the compressed bytes.
+   */
+  virtual std::vector<int8_t> compress(const int8_t* input, size_t length) = 0;
+
+  /**
+   * Decompresses length bytes of input previously returned by compress.
+   *
+   * @return the original bytes.
+   * @throws IllegalArgumentException if input is not valid compressed data.
+   */
+  virtual std::vector<int8_t> decompress(const int8_t* input,
+                                         size_t length) = 0;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_COMPRESSOR_H_
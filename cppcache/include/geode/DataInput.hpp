@@ -29,6 +29,7 @@
 #include "ExceptionTypes.hpp"
 #include "internal/DSCode.hpp"
 #include "internal/geode_globals.hpp"
+#include "internal/type_traits.hpp"
 
 /**
  * @file
@@ -112,6 +113,47 @@ class APACHE_GEODE_EXPORT DataInput {
     }
   }
 
+  /**
+   * Read the given number of integers, chars, floats or doubles from the
+   * <code>DataInput</code>, in the big endian byte order of
+   * <code>readInt16</code>, <code>readInt32</code>, <code>readInt64</code>,
+   * <code>readFloat</code> or <code>readDouble</code>.
+   * @remarks This method is complimentary to
+   *   <code>DataOutput::writeArrayOnly</code>. The buffer is checked once and
+   *   the bytes of whole blocks of values are swapped at a time.
+   *
+   * @param values array to store the values read
+   * @param len number of values to read
+   */
+  template <class _T>
+  inline void readArrayOnly(_T* values, size_t len) {
+    static_assert(internal::is_bulk_serializable<_T>::value,
+                  "values must be integers, chars, floats or doubles");
+    _GEODE_CHECK_BUFFER_SIZE(len * sizeof(_T));
+    decodeBigEndian(m_buf, len, sizeof(_T), values);
+    advanceCursor(len * sizeof(_T));
+  }
+
+  /**
+   * Read the next len bytes without copying them, if the buffer being read
+   * is reference counted, e.g. a reply received from a server while
+   * <code>zero-copy-byte-arrays</code> is enabled.
+   *
+   * @param len number of bytes to read
+   * @return a pointer to the bytes that keeps the whole buffer alive, or
+   *   nullptr, without advancing the cursor, if the buffer is not reference
+   *   counted.
+   */
+  inline std::shared_ptr<const uint8_t> readBytesShared(size_t len) {
+    if (!m_bufferOwner) {
+      return nullptr;
+    }
+    _GEODE_CHECK_BUFFER_SIZE(len);
+    std::shared_ptr<const uint8_t> bytes(m_bufferOwner, m_buf);
+    advanceCursor(len);
+    return bytes;
+  }
+
   /**
    * Read an array of unsigned bytes from the <code>DataInput</code>
    * expecting to find the length of array in the stream at the start.
@@ -464,6 +506,7 @@ class APACHE_GEODE_EXPORT DataInput {
   size_t m_bufLength;
   Pool* m_pool;
   const CacheImpl* m_cache;
+  std::shared_ptr<const uint8_t> m_bufferOwner;
 
   std::shared_ptr<Serializable> readObjectInternal(int8_t typeId = -1);
 
@@ -514,6 +557,10 @@ class APACHE_GEODE_EXPORT DataInput {
 
   inline int8_t readNoCheck() { return *(m_buf++); }
 
+  /** Reads count values of size bytes in big endian order from in. */
+  static void decodeBigEndian(const uint8_t* in, size_t count, size_t size,
+                              void* values);
+
   inline int16_t readInt16NoCheck() {
     int16_t tmp = *(m_buf++);
     tmp = static_cast<int16_t>((tmp << 8) | *(m_buf++));
@@ -577,12 +624,11 @@ class APACHE_GEODE_EXPORT DataInput {
   template <class _Traits, class _Allocator>
   inline void readUtf16Huge(
       std::basic_string<char16_t, _Traits, _Allocator>& value) {
-    uint32_t length = readInt32();
-    _GEODE_CHECK_BUFFER_SIZE(length);
-    value.reserve(length);
-    while (length-- > 0) {
-      value += readInt16NoCheck();
-    }
+    size_t length = static_cast<uint32_t>(readInt32());
+    _GEODE_CHECK_BUFFER_SIZE(length * 2);
+    auto offset = value.length();
+    value.resize(offset + length);
+    readArrayOnly(&value[offset], length);
   }
 
   template <class _Traits, class _Allocator>
@@ -29,6 +29,7 @@
 #include "ExceptionTypes.hpp"
 #include "Serializable.hpp"
 #include "internal/geode_globals.hpp"
+#include "internal/type_traits.hpp"
 
 namespace apache {
 namespace geode {
@@ -132,6 +133,26 @@ class APACHE_GEODE_EXPORT DataOutput {
     writeBytesOnly(reinterpret_cast<const uint8_t*>(bytes), len);
   }
 
+  /**
+   * Write an array of integers, chars, floats or doubles without its length
+   * to the <code>DataOutput</code>. Each value is written in the same big
+   * endian byte order as by <code>writeInt</code>, <code>writeChar</code>,
+   * <code>writeFloat</code> or <code>writeDouble</code>, but the capacity is
+   * ensured once and the bytes of whole blocks of values are swapped at a
+   * time.
+   *
+   * @param values the array of values to be written
+   * @param len the number of values from the start of array to be written
+   */
+  template <class _T>
+  inline void writeArrayOnly(const _T* values, size_t len) {
+    static_assert(internal::is_bulk_serializable<_T>::value,
+                  "values must be integers, chars, floats or doubles");
+    ensureCapacity(len * sizeof(_T));
+    encodeBigEndian(values, len, sizeof(_T), m_buf);
+    m_buf += len * sizeof(_T);
+  }
+
   /**
    * Write a 16-bit unsigned integer value to the <code>DataOutput</code>.
    *
@@ -561,19 +582,23 @@ class APACHE_GEODE_EXPORT DataOutput {
   }
 
   inline void writeJavaModifiedUtf8(const char16_t* data, size_t len) {
+    constexpr size_t maxLength = (std::numeric_limits<uint16_t>::max)();
     if (0 == len) {
       writeInt(static_cast<uint16_t>(0));
+    } else if (len * 3 <= maxLength) {
+      // Encode in a single pass, the length is written once known.
+      ensureCapacity(2 + len * 3);
+      auto encodedLen = encodeJavaModifiedUtf8(data, len, m_buf + 2, len * 3);
+      writeNoCheck(static_cast<uint8_t>(encodedLen >> 8));
+      writeNoCheck(static_cast<uint8_t>(encodedLen));
+      m_buf += encodedLen;
     } else {
-      auto encodedLen = static_cast<uint16_t>(
-          std::min<size_t>(getJavaModifiedUtf8EncodedLength(data, len),
-                           (std::numeric_limits<uint16_t>::max)()));
-      writeInt(encodedLen);
+      auto encodedLen = std::min<size_t>(
+          getJavaModifiedUtf8EncodedLength(data, len), maxLength);
+      writeInt(static_cast<uint16_t>(encodedLen));
       ensureCapacity(encodedLen);
-      const auto end = m_buf + encodedLen;
-      while (m_buf < end) {
-        encodeJavaModifiedUtf8(*data++);
-      }
-      if (m_buf > end) m_buf = end;
+      encodeJavaModifiedUtf8(data, len, m_buf, encodedLen);
+      m_buf += encodedLen;
     }
   }
 
@@ -637,11 +662,7 @@ class APACHE_GEODE_EXPORT DataOutput {
   }
 
   inline void writeUtf16(const char16_t* data, size_t length) {
-    ensureCapacity(length * 2);
-    for (; length > 0; length--, data++) {
-      writeNoCheck(static_cast<uint8_t>(*data >> 8));
-      writeNoCheck(static_cast<uint8_t>(*data));
-    }
+    writeArrayOnly(data, length);
   }
 
   void writeUtf16(const char32_t* data, size_t len);
@@ -702,23 +723,16 @@ class APACHE_GEODE_EXPORT DataOutput {
     }
   }
 
-  inline void encodeJavaModifiedUtf8(const char16_t c) {
-    if (c == 0) {
-      // NUL
-      *(m_buf++) = 0xc0;
-      *(m_buf++) = 0x80;
-    } else if (c < 0x80) {
-      // ASCII character
-      *(m_buf++) = static_cast<uint8_t>(c);
-    } else if (c < 0x800) {
-      *(m_buf++) = static_cast<uint8_t>(0xC0 | c >> 6);
-      *(m_buf++) = static_cast<uint8_t>(0x80 | (c & 0x3F));
-    } else {
-      *(m_buf++) = static_cast<uint8_t>(0xE0 | c >> 12);
-      *(m_buf++) = static_cast<uint8_t>(0x80 | ((c >> 6) & 0x3F));
-      *(m_buf++) = static_cast<uint8_t>(0x80 | (c & 0x3F));
-    }
-  }
+  /**
+   * Encodes data into out, writing at most limit bytes, and returns the
+   * length of the complete encoding.
+   */
+  static size_t encodeJavaModifiedUtf8(const char16_t* data, size_t length,
+                                       uint8_t* out, size_t limit);
+
+  /** Writes count values of size bytes to out in big endian order. */
+  static void encodeBigEndian(const void* values, size_t count, size_t size,
+                              uint8_t* out);
 
   inline void writeNoCheck(uint8_t value) { *(m_buf++) = value; }
 
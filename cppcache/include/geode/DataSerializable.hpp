@@ -37,6 +37,11 @@ class DataInput;
  * An interface for objects whose contents can be serialized as primitive types.
  */
 class APACHE_GEODE_EXPORT DataSerializable : public virtual Serializable {
+ protected:
+  DataSerializable() {
+    setSerializationKind(internal::SerializationKind::DataSerializable, this);
+  }
+
  public:
   ~DataSerializable() override = default;
 
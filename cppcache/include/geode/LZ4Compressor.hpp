@@ -0,0 +1,61 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_LZ4COMPRESSOR_H_
+#define GEODE_LZ4COMPRESSOR_H_
+
+#include "Compressor.hpp"
+#include "internal/geode_globals.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * A fast {@link Compressor} producing LZ4 blocks with the LZ4 library, each
+ * preceded by the uncompressed length.
+ *
+ * For cache.xml the factory function <code>createLZ4Compressor</code> is
+ * exported by the native client library:
+ *
+ * @code
+ * <compressor library-name="apache-geode"
+ *   library-function-name="createLZ4Compressor"/>
+ * @endcode
+ */
+class APACHE_GEODE_EXPORT LZ4Compressor : public Compressor {
+ public:
+  LZ4Compressor() = default;
+  ~LZ4Compressor() noexcept override = default;
+
+  std::vector<int8_t> compress(const int8_t* input, size_t length) override;
+
+  std::vector<int8_t> decompress(const int8_t* input, size_t length) override;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+extern "C" {
+
+APACHE_GEODE_EXPORT apache::geode::client::Compressor* createLZ4Compressor();
+}
+
+#endif  // GEODE_LZ4COMPRESSOR_H_
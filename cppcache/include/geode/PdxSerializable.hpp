@@ -39,6 +39,11 @@ class PdxWriter;
  */
 class APACHE_GEODE_EXPORT PdxSerializable : public virtual Serializable,
                                             public virtual CacheableKey {
+ protected:
+  PdxSerializable() {
+    setSerializationKind(internal::SerializationKind::PdxSerializable, this);
+  }
+
  public:
   ~PdxSerializable() noexcept override {}
 
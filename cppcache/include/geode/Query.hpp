@@ -23,6 +23,7 @@
 #include <chrono>
 
 #include "SelectResults.hpp"
+#include "SelectResultsStream.hpp"
 #include "internal/geode_globals.hpp"
 
 /**
@@ -90,6 +91,26 @@ class APACHE_GEODE_EXPORT Query {
   virtual std::shared_ptr<SelectResults> execute(
       std::shared_ptr<CacheableVector> paramList,
       std::chrono::milliseconds timeout = DEFAULT_QUERY_RESPONSE_TIMEOUT) = 0;
+
+  /**
+   * Executes the OQL Query, optionally parameterized, on the cache server and
+   * returns its results as they arrive, without waiting for the whole reply.
+   * The query runs on a background thread until the reply has been read.
+   *
+   * @param paramList The query parameters list, or nullptr.
+   * @param timeout The time to wait for each part of the query response.
+   * @param prefetchChunks The number of reply chunks received ahead of the
+   * reader, at least 1.
+   *
+   * @throws IllegalArgumentException If timeout exceeds 2147483647ms.
+   * @returns A stream over the results. Errors executing the query are
+   * thrown by SelectResultsStream::next.
+   */
+  virtual std::shared_ptr<SelectResultsStream> stream(
+      std::shared_ptr<CacheableVector> paramList = nullptr,
+      std::chrono::milliseconds timeout = DEFAULT_QUERY_RESPONSE_TIMEOUT,
+      size_t prefetchChunks = 4) = 0;
+
   /**
    * Get the query string provided when a new Query was created from a
    * QueryService.
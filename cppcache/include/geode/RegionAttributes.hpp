@@ -29,6 +29,7 @@
 #include "CacheListener.hpp"
 #include "CacheLoader.hpp"
 #include "CacheWriter.hpp"
+#include "Compressor.hpp"
 #include "DiskPolicyType.hpp"
 #include "ExpirationAttributes.hpp"
 #include "PartitionResolver.hpp"
@@ -108,6 +109,12 @@ class APACHE_GEODE_EXPORT RegionAttributes
    */
   std::shared_ptr<PartitionResolver> getPartitionResolver() const;
 
+  /** Gets the compressor of the values kept in the local cache.
+   * @return  a pointer that points to the region's <code>Compressor</code>,
+   * nullptr if values are not compressed.
+   */
+  std::shared_ptr<Compressor> getCompressor() const;
+
   /** Gets the <code>timeToLive</code> expiration attributes for the region as a
    * whole.
    * @return the timeToLive expiration attributes for this region
@@ -170,6 +177,21 @@ class APACHE_GEODE_EXPORT RegionAttributes
    */
   uint32_t getLruEntriesLimit() const;
 
+  /**
+   * Returns the maximum number of keys the region remembers as absent on the
+   * server, so that repeated gets of them are answered without a round trip.
+   * A return value of zero, 0, indicates the negative lookup cache is
+   * disabled.
+   */
+  uint32_t getNegativeCacheEntriesLimit() const;
+
+  /**
+   * Returns how long a key is remembered as absent on the server by the
+   * negative lookup cache. A return value of zero, 0, indicates keys are
+   * remembered until they are created, updated or evicted by the limit.
+   */
+  std::chrono::milliseconds getNegativeCacheTimeToLive() const;
+
   /** Returns the disk policy type of the region.
    *
    * @return the <code>DiskPolicyType</code>, default is
@@ -252,6 +274,18 @@ class APACHE_GEODE_EXPORT RegionAttributes
    */
   const std::string& getPartitionResolverFactory() const;
 
+  /**
+   * This method returns the path of the library from which
+   * the factory function will be invoked to create the compressor.
+   */
+  const std::string& getCompressorLibrary() const;
+
+  /**
+   * This method returns the symbol name of the factory function from which
+   * the compressor will be created.
+   */
+  const std::string& getCompressorFactory() const;
+
   /** Return true if all the attributes are equal to those of other. */
   bool operator==(const RegionAttributes& other) const;
 
@@ -310,6 +344,15 @@ class APACHE_GEODE_EXPORT RegionAttributes
   bool getConcurrencyChecksEnabled() const {
     return m_isConcurrencyChecksEnabled;
   }
+
+  /**
+   * Returns true if subscription events that are waiting to be applied to
+   * this region are conflated, so that only the latest update of each key is
+   * applied and dispatched to listeners.
+   */
+  bool getSubscriptionConflationEnabled() const {
+    return m_isSubscriptionConflationEnabled;
+  }
   RegionAttributes& operator=(const RegionAttributes&) = default;
 
  private:
@@ -321,6 +364,8 @@ class APACHE_GEODE_EXPORT RegionAttributes
                       const std::string& factoryFuncName);
   void setPartitionResolver(const std::string& libpath,
                             const std::string& factoryFuncName);
+  void setCompressor(const std::string& libpath,
+                     const std::string& factoryFuncName);
   void setPersistenceManager(const std::string& lib, const std::string& func,
                              const std::shared_ptr<Properties>& config);
   void setEndpoints(const std::string& endpoints);
@@ -328,8 +373,11 @@ class APACHE_GEODE_EXPORT RegionAttributes
   void setCloningEnabled(bool isClonable);
   void setCachingEnabled(bool enable);
   void setLruEntriesLimit(int limit);
+  void setNegativeCacheEntriesLimit(uint32_t limit);
+  void setNegativeCacheTimeToLive(std::chrono::milliseconds timeToLive);
   void setDiskPolicy(DiskPolicyType diskPolicy);
   void setConcurrencyChecksEnabled(bool enable);
+  void setSubscriptionConflationEnabled(bool enable);
 
   inline bool getEntryExpiryEnabled() const {
     return (m_entryTimeToLive > std::chrono::seconds::zero() ||
@@ -350,7 +398,10 @@ class APACHE_GEODE_EXPORT RegionAttributes
   mutable std::shared_ptr<CacheLoader> m_cacheLoader;
   mutable std::shared_ptr<CacheListener> m_cacheListener;
   mutable std::shared_ptr<PartitionResolver> m_partitionResolver;
+  mutable std::shared_ptr<Compressor> m_compressor;
   uint32_t m_lruEntriesLimit;
+  uint32_t m_negativeCacheEntriesLimit;
+  std::chrono::milliseconds m_negativeCacheTimeToLive;
   bool m_caching;
   uint32_t m_maxValueDistLimit;
   std::chrono::seconds m_entryIdleTimeout;
@@ -368,6 +419,8 @@ class APACHE_GEODE_EXPORT RegionAttributes
   std::string m_cacheWriterFactory;
   std::string m_cacheListenerFactory;
   std::string m_partitionResolverFactory;
+  std::string m_compressorLibrary;
+  std::string m_compressorFactory;
   DiskPolicyType m_diskPolicy;
   std::string m_endpoints;
   bool m_clientNotificationEnabled;
@@ -378,6 +431,7 @@ class APACHE_GEODE_EXPORT RegionAttributes
   std::string m_poolName;
   bool m_isClonable;
   bool m_isConcurrencyChecksEnabled;
+  bool m_isSubscriptionConflationEnabled;
   friend class RegionAttributesFactory;
   friend class AttributesMutator;
   friend class Cache;
@@ -219,6 +219,16 @@ class APACHE_GEODE_EXPORT RegionAttributesFactory {
   RegionAttributesFactory& setPartitionResolver(
       const std::shared_ptr<PartitionResolver>& aResolver);
 
+  /**
+   * Sets the Compressor of the values kept in the local cache for the next
+   * <code>RegionAttributes</code> created.
+   * @param aCompressor a compressor such as LZ4Compressor, nullptr to keep
+   * values uncompressed
+   * @return a reference to <code>this</code>
+   */
+  RegionAttributesFactory& setCompressor(
+      const std::shared_ptr<Compressor>& aCompressor);
+
   /**
    * Sets the library path for the library that will be invoked for the loader
    * of the region.
@@ -252,6 +262,14 @@ class APACHE_GEODE_EXPORT RegionAttributesFactory {
   RegionAttributesFactory& setPartitionResolver(
       const std::string& libpath, const std::string& factoryFuncName);
 
+  /**
+   * Sets the library path for the library that will be invoked for the
+   * compressor of the region.
+   * @return a reference to <code>this</code>
+   */
+  RegionAttributesFactory& setCompressor(const std::string& libpath,
+                                         const std::string& factoryFuncName);
+
   // EXPIRATION ATTRIBUTES
 
   /**
@@ -368,6 +386,29 @@ class APACHE_GEODE_EXPORT RegionAttributesFactory {
    */
   RegionAttributesFactory& setLruEntriesLimit(const uint32_t entriesLimit);
 
+  /**
+   * Sets the number of keys the region remembers as absent on the server.
+   * A get of such a key returns nullptr without a round trip to the server,
+   * until the key is created or updated through this region or a
+   * subscription event, or until its time to live elapses. Defaults to 0,
+   * meaning gets always go to the server.
+   * @param entriesLimit number of absent keys to remember
+   * @return a reference to <code>this</code>
+   */
+  RegionAttributesFactory& setNegativeCacheEntriesLimit(
+      const uint32_t entriesLimit);
+
+  /**
+   * Sets how long a key is remembered as absent on the server by the
+   * negative lookup cache. Bounds how stale a get can be for keys created
+   * by other clients when no subscription event reaches this region.
+   * Defaults to 1 second; 0 means keys do not expire.
+   * @param timeToLive how long to remember an absent key
+   * @return a reference to <code>this</code>
+   */
+  RegionAttributesFactory& setNegativeCacheTimeToLive(
+      std::chrono::milliseconds timeToLive);
+
   /**
    * Sets the Disk policy type for the next <code>RegionAttributes</code>
    * created.
@@ -427,6 +468,17 @@ class APACHE_GEODE_EXPORT RegionAttributesFactory {
   RegionAttributesFactory& setConcurrencyChecksEnabled(
       bool concurrencyChecksEnabled);
 
+  /**
+   * Enables or disables conflation of the subscription events waiting to be
+   * applied to the region. When the region's listeners or local cache fall
+   * behind the subscription channel, only the latest update of each key is
+   * applied; creates, destroys and invalidates are never dropped. Defaults
+   * to false.
+   * @param enable whether to conflate waiting subscription events
+   * @return a reference to <code>this</code>
+   */
+  RegionAttributesFactory& setSubscriptionConflationEnabled(bool enable);
+
   // FACTORY METHOD
 
   /**
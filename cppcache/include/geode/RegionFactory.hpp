@@ -86,6 +86,14 @@ class APACHE_GEODE_EXPORT RegionFactory {
   RegionFactory& setPartitionResolver(
       const std::shared_ptr<PartitionResolver>& aResolver);
 
+  /** Sets the Compressor of the values kept in the local cache for the next
+   * <code>RegionAttributes</code> created.
+   * @param aCompressor a compressor such as LZ4Compressor, nullptr to keep
+   * values uncompressed
+   * @return a reference to <code>this</code>
+   */
+  RegionFactory& setCompressor(const std::shared_ptr<Compressor>& aCompressor);
+
   /**
    * Sets the library path for the library that will be invoked for the loader
    * of the region.
@@ -118,6 +126,14 @@ class APACHE_GEODE_EXPORT RegionFactory {
   RegionFactory& setPartitionResolver(const std::string& libpath,
                                       const std::string& factoryFuncName);
 
+  /**
+   * Sets the library path for the library that will be invoked for the
+   * compressor of the region.
+   * @return a reference to <code>this</code>
+   */
+  RegionFactory& setCompressor(const std::string& libpath,
+                               const std::string& factoryFuncName);
+
   // EXPIRATION ATTRIBUTES
 
   /** Sets the idleTimeout expiration attributes for region entries for the next
@@ -216,6 +232,28 @@ class APACHE_GEODE_EXPORT RegionFactory {
    */
   RegionFactory& setLruEntriesLimit(const uint32_t entriesLimit);
 
+  /**
+   * Sets the number of keys the region remembers as absent on the server.
+   * A get of such a key returns nullptr without a round trip to the server,
+   * until the key is created or updated through this region or a
+   * subscription event, or until its time to live elapses. Defaults to 0,
+   * meaning gets always go to the server.
+   * @param entriesLimit number of absent keys to remember
+   * @return a reference to <code>this</code>
+   */
+  RegionFactory& setNegativeCacheEntriesLimit(const uint32_t entriesLimit);
+
+  /**
+   * Sets how long a key is remembered as absent on the server by the
+   * negative lookup cache. Bounds how stale a get can be for keys created
+   * by other clients when no subscription event reaches this region.
+   * Defaults to 1 second; 0 means keys do not expire.
+   * @param timeToLive how long to remember an absent key
+   * @return a reference to <code>this</code>
+   */
+  RegionFactory& setNegativeCacheTimeToLive(
+      std::chrono::milliseconds timeToLive);
+
   /** Sets the Disk policy type for the next <code>RegionAttributes</code>
    * created.
    * @param diskPolicy the type of disk policy to use for the region
@@ -262,6 +300,17 @@ class APACHE_GEODE_EXPORT RegionFactory {
    */
   RegionFactory& setConcurrencyChecksEnabled(bool enable);
 
+  /**
+   * Enables or disables conflation of the subscription events waiting to be
+   * applied to the region. When the region's listeners or local cache fall
+   * behind the subscription channel, only the latest update of each key is
+   * applied; creates, destroys and invalidates are never dropped. Defaults
+   * to false.
+   * @param enable whether to conflate waiting subscription events
+   * @return a reference to <code>this</code>
+   */
+  RegionFactory& setSubscriptionConflationEnabled(bool enable);
+
  private:
   RegionFactory(apache::geode::client::RegionShortcut preDefinedRegion,
                 CacheImpl* cacheImpl);
@@ -0,0 +1,82 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#ifndef GEODE_SELECTRESULTSSTREAM_H_
+#define GEODE_SELECTRESULTSSTREAM_H_
+
+#include <memory>
+
+#include "Serializable.hpp"
+#include "internal/geode_globals.hpp"
+
+/**
+ * @file
+ */
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * @class SelectResultsStream SelectResultsStream.hpp
+ *
+ * The results of a Query returned by Query::stream, read as they arrive from
+ * the server rather than once the whole reply has been received.
+ *
+ * Only a bounded number of reply chunks is received ahead of the reader. Once
+ * that many are waiting the connection is not read until results are
+ * consumed, so a slow reader keeps its pool connection busy.
+ *
+ * Results of a query selecting several fields are Struct instances whose
+ * field names are only available while the stream exists.
+ *
+ * This class is not thread-safe, except for cancel.
+ */
+class APACHE_GEODE_EXPORT SelectResultsStream {
+ public:
+  /**
+   * Cancels the stream and waits for the rest of the reply to be drained
+   * from the connection.
+   */
+  virtual ~SelectResultsStream() noexcept = default;
+
+  /**
+   * Waits for the next result.
+   *
+   * @param result set to the next result.
+   * @returns false once every result has been read, or after cancel.
+   * @throws QueryException if some query error occurred at the server, once
+   * the results received before the error have been read.
+   * @throws NotConnectedException if no java cache server is available.
+   * @throws MessageException if the query was retried on another server after
+   * some of its results had been read.
+   */
+  virtual bool next(std::shared_ptr<Serializable>& result) = 0;
+
+  /**
+   * Stops reading results. Results not yet received are discarded as they
+   * arrive, which keeps the connection usable.
+   */
+  virtual void cancel() = 0;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_SELECTRESULTSSTREAM_H_
@@ -20,6 +20,7 @@
 #ifndef GEODE_SERIALIZABLE_H_
 #define GEODE_SERIALIZABLE_H_
 
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <string>
@@ -35,6 +36,24 @@ class DataInput;
 class Cache;
 class PdxSerializable;
 class Serializable;
+class SerializationRegistry;
+
+namespace internal {
+
+/**
+ * Serialization interface implemented by a Serializable, ordered so that
+ * a type implementing several of them is dispatched through the greatest.
+ */
+enum class SerializationKind : int8_t {
+  Unknown = 0,
+  DataSerializableInternal,
+  DataSerializable,
+  DataSerializablePrimitive,
+  DataSerializableFixedId,
+  PdxSerializable
+};
+
+}  // namespace internal
 
 /** @brief signature of functions passed to registerType. Such functions
  * should return an empty instance of the type they represent. The instance
@@ -82,9 +101,40 @@ class APACHE_GEODE_EXPORT Serializable {
     return value;
   }
 
+  Serializable() = default;
+
+  /**
+   * Copies do not take over the dispatch tag of their source, which may be
+   * of a different most derived type; they fall back to dynamic dispatch.
+   */
+  Serializable(const Serializable&) noexcept {}
+
+  Serializable& operator=(const Serializable&) noexcept { return *this; }
+
   virtual ~Serializable() noexcept = default;
 
  protected:
+  /**
+   * Called by the constructor of each serialization interface with its own
+   * address so that SerializationRegistry can reach the interface without a
+   * dynamic_cast.
+   */
+  void setSerializationKind(internal::SerializationKind kind,
+                            const void* base) noexcept {
+    if (kind > serializationKind_) {
+      serializationKind_ = kind;
+      serializationOffset_ =
+          static_cast<int32_t>(static_cast<const char*>(base) -
+                               reinterpret_cast<const char*>(this));
+    }
+  }
+
+ private:
+  int32_t serializationOffset_ = 0;
+  internal::SerializationKind serializationKind_ =
+      internal::SerializationKind::Unknown;
+
+  friend class SerializationRegistry;
 };
 
 typedef Serializable Cacheable;
@@ -29,6 +29,7 @@
 #include "DataInput.hpp"
 #include "DataOutput.hpp"
 #include "internal/geode_globals.hpp"
+#include "internal/type_traits.hpp"
 
 namespace apache {
 namespace geode {
@@ -203,9 +204,11 @@ inline void readObject(apache::geode::client::DataInput& input,
   value = std::dynamic_pointer_cast<TObj>(input.readObject());
 }
 
-// For arrays
+// For arrays, those of primitives are written and read in bulk.
 
-template <typename TObj, typename TLen>
+template <typename TObj, typename TLen,
+          typename std::enable_if<!internal::is_bulk_serializable<TObj>::value,
+                                  Serializable>::type* = nullptr>
 inline void writeObject(apache::geode::client::DataOutput& output,
                         const TObj* array, TLen len) {
   if (array == nullptr) {
@@ -219,7 +222,22 @@ inline void writeObject(apache::geode::client::DataOutput& output,
   }
 }
 
-template <typename TObj>
+template <typename TObj, typename TLen,
+          typename std::enable_if<internal::is_bulk_serializable<TObj>::value,
+                                  Serializable>::type* = nullptr>
+inline void writeObject(apache::geode::client::DataOutput& output,
+                        const TObj* array, TLen len) {
+  if (array == nullptr) {
+    output.write(static_cast<int8_t>(-1));
+  } else {
+    output.writeArrayLen(len);
+    output.writeArrayOnly(array, len);
+  }
+}
+
+template <typename TObj,
+          typename std::enable_if<!internal::is_bulk_serializable<TObj>::value,
+                                  Serializable>::type* = nullptr>
 inline void writeArrayObject(apache::geode::client::DataOutput& output,
                              const std::vector<TObj>& array) {
   output.writeArrayLen(static_cast<int32_t>(array.size()));
@@ -228,7 +246,18 @@ inline void writeArrayObject(apache::geode::client::DataOutput& output,
   }
 }
 
-template <typename TObj>
+template <typename TObj,
+          typename std::enable_if<internal::is_bulk_serializable<TObj>::value,
+                                  Serializable>::type* = nullptr>
+inline void writeArrayObject(apache::geode::client::DataOutput& output,
+                             const std::vector<TObj>& array) {
+  output.writeArrayLen(static_cast<int32_t>(array.size()));
+  output.writeArrayOnly(array.data(), array.size());
+}
+
+template <typename TObj,
+          typename std::enable_if<!internal::is_bulk_serializable<TObj>::value,
+                                  Serializable>::type* = nullptr>
 inline std::vector<TObj> readArrayObject(
     apache::geode::client::DataInput& input) {
   std::vector<TObj> array;
@@ -242,7 +271,23 @@ inline std::vector<TObj> readArrayObject(
   return array;
 }
 
-template <typename TObj, typename TLen>
+template <typename TObj,
+          typename std::enable_if<internal::is_bulk_serializable<TObj>::value,
+                                  Serializable>::type* = nullptr>
+inline std::vector<TObj> readArrayObject(
+    apache::geode::client::DataInput& input) {
+  std::vector<TObj> array;
+  int len = input.readArrayLength();
+  if (len >= 0) {
+    array.resize(len);
+    input.readArrayOnly(array.data(), array.size());
+  }
+  return array;
+}
+
+template <typename TObj, typename TLen,
+          typename std::enable_if<!internal::is_bulk_serializable<TObj>::value,
+                                  Serializable>::type* = nullptr>
 inline void readObject(apache::geode::client::DataInput& input, TObj*& array,
                        TLen& len) {
   len = input.readArrayLength();
@@ -258,6 +303,20 @@ inline void readObject(apache::geode::client::DataInput& input, TObj*& array,
   }
 }
 
+template <typename TObj, typename TLen,
+          typename std::enable_if<internal::is_bulk_serializable<TObj>::value,
+                                  Serializable>::type* = nullptr>
+inline void readObject(apache::geode::client::DataInput& input, TObj*& array,
+                       TLen& len) {
+  len = input.readArrayLength();
+  if (len > 0) {
+    _GEODE_NEW(array, TObj[len]);
+    input.readArrayOnly(array, len);
+  } else {
+    array = nullptr;
+  }
+}
+
 template <typename TObj,
           typename std::enable_if<!std::is_base_of<Serializable, TObj>::value,
                                   Serializable>::type* = nullptr>
@@ -302,7 +361,9 @@ inline size_t objectSize(const TObj* array, TLen len) {
 
 // For containers vector/hashmap/hashset
 
-template <typename TObj, typename Allocator>
+template <typename TObj, typename Allocator,
+          typename std::enable_if<!internal::is_bulk_serializable<TObj>::value,
+                                  Serializable>::type* = nullptr>
 inline void writeObject(apache::geode::client::DataOutput& output,
                         const std::vector<TObj, Allocator>& value) {
   output.writeArrayLen(static_cast<int32_t>(value.size()));
@@ -311,6 +372,15 @@ inline void writeObject(apache::geode::client::DataOutput& output,
   }
 }
 
+template <typename TObj, typename Allocator,
+          typename std::enable_if<internal::is_bulk_serializable<TObj>::value,
+                                  Serializable>::type* = nullptr>
+inline void writeObject(apache::geode::client::DataOutput& output,
+                        const std::vector<TObj, Allocator>& value) {
+  output.writeArrayLen(static_cast<int32_t>(value.size()));
+  output.writeArrayOnly(value.data(), value.size());
+}
+
 inline size_t objectSize(const std::vector<std::shared_ptr<Cacheable>>& value) {
   size_t objectSize = 0;
   for (const auto& iter : value) {
@@ -322,7 +392,9 @@ inline size_t objectSize(const std::vector<std::shared_ptr<Cacheable>>& value) {
   return objectSize;
 }
 
-template <typename TObj, typename _tail>
+template <typename TObj, typename _tail,
+          typename std::enable_if<!internal::is_bulk_serializable<TObj>::value,
+                                  Serializable>::type* = nullptr>
 inline void readObject(apache::geode::client::DataInput& input,
                        std::vector<TObj, _tail>& value) {
   int32_t len = input.readArrayLength();
@@ -335,6 +407,19 @@ inline void readObject(apache::geode::client::DataInput& input,
   }
 }
 
+template <typename TObj, typename _tail,
+          typename std::enable_if<internal::is_bulk_serializable<TObj>::value,
+                                  Serializable>::type* = nullptr>
+inline void readObject(apache::geode::client::DataInput& input,
+                       std::vector<TObj, _tail>& value) {
+  int32_t len = input.readArrayLength();
+  if (len > 0) {
+    auto offset = value.size();
+    value.resize(offset + len);
+    input.readArrayOnly(value.data() + offset, len);
+  }
+}
+
 template <typename TKey, typename TValue, typename Hash, typename KeyEqual,
           typename Allocator>
 inline void writeObject(
@@ -0,0 +1,142 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_STREAMINGRESULTCOLLECTOR_H_
+#define GEODE_STREAMINGRESULTCOLLECTOR_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+
+#include "CacheableBuiltins.hpp"
+#include "ResultCollector.hpp"
+#include "internal/geode_globals.hpp"
+
+/**
+ * @file
+ */
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * @class StreamingResultCollector StreamingResultCollector.hpp
+ * A ResultCollector whose results can be consumed while the function is
+ * still executing. Results from every server are queued in arrival order and
+ * handed out by {@link #next}.
+ *
+ * Since Execution::execute returns only once all results have arrived, the
+ * consumer calls next() on a different thread from the one executing the
+ * function:
+ *  <pre>
+ * auto rc = std::make_shared<StreamingResultCollector>(1000);
+ * auto done = std::async(std::launch::async, [&] {
+ *   FunctionService::onRegion(region).withCollector(rc).execute(func);
+ * });
+ * std::shared_ptr<Cacheable> result;
+ * while (rc->next(result)) {
+ *   process(result);
+ * }
+ * done.get();
+ * </pre>
+ *
+ * With a non-zero capacity, a server connection that delivers a result while
+ * the capacity is reached blocks until the consumer takes a result, so no
+ * more of its reply is read until the consumer catches up.
+ */
+class APACHE_GEODE_EXPORT StreamingResultCollector : public ResultCollector {
+ public:
+  /**
+   * @param capacity the number of results that may wait for the consumer to
+   * take them, or 0 for no limit.
+   */
+  explicit StreamingResultCollector(size_t capacity = 0);
+  ~StreamingResultCollector() noexcept override;
+
+  /**
+   * Waits for the next result.
+   *
+   * @param result set to the next result.
+   * @param timeout how long to wait for a result to arrive.
+   * @returns false once all results have been returned or the collector has
+   * been cancelled.
+   * @throws FunctionExecutionException if no result arrives within the
+   * timeout, or if the function was re-executed after some of its results
+   * had already been returned.
+   * @throws the exception recorded by {@link #setException} once the
+   * execution has failed.
+   */
+  bool next(std::shared_ptr<Cacheable>& result,
+            std::chrono::milliseconds timeout = DEFAULT_QUERY_RESPONSE_TIMEOUT);
+
+  /**
+   * Discards queued and further results, and releases any server connection
+   * waiting for the consumer. Called by the consuming thread.
+   */
+  void cancel();
+
+  /**
+   * Records that the execution failed. Queued and further results are
+   * discarded, and the consumer's next call to {@link #next} rethrows the
+   * exception instead of waiting for more results. Called by the executing
+   * thread.
+   */
+  void setException(std::exception_ptr exception);
+
+  /**
+   * Waits for the function to complete and returns the results that have
+   * not been returned by {@link #next}.
+   */
+  std::shared_ptr<CacheableVector> getResult(
+      std::chrono::milliseconds timeout =
+          DEFAULT_QUERY_RESPONSE_TIMEOUT) override;
+
+  void addResult(
+      const std::shared_ptr<Cacheable>& resultOfSingleExecution) override;
+
+  void endResults() override;
+
+  void clearResults() override;
+
+ private:
+  const size_t capacity_;
+  std::mutex mutex_;
+  std::condition_variable resultAdded_;
+  std::condition_variable resultsTaken_;
+  std::deque<std::shared_ptr<Cacheable>> queue_;
+  bool ended_;
+  bool cancelled_;
+  bool reExecuted_;
+  bool delivered_;
+  std::exception_ptr exception_;
+
+  // Results taken from queue_ in one go, owned by the consumer.
+  std::deque<std::shared_ptr<Cacheable>> batch_;
+  std::shared_ptr<CacheableVector> resultList_;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_STREAMINGRESULTCOLLECTOR_H_
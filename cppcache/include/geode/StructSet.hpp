@@ -20,6 +20,10 @@
 #ifndef GEODE_STRUCTSET_H_
 #define GEODE_STRUCTSET_H_
 
+#include <memory>
+#include <string>
+#include <vector>
+
 #include "CqResults.hpp"
 #include "Struct.hpp"
 #include "internal/geode_globals.hpp"
@@ -32,6 +36,8 @@ namespace apache {
 namespace geode {
 namespace client {
 
+class Struct;
+
 /**
  * @class StructSet StructSet.hpp
  *
@@ -61,6 +67,110 @@ class APACHE_GEODE_EXPORT StructSet : public CqResults {
    * @throws std::out_of_range if index is not found
    */
   virtual const std::string& getFieldName(int32_t index) = 0;
+
+  /**
+   * @class Row StructSet.hpp
+   *
+   * A lightweight view of one row of a StructSet. Unlike a Struct, a Row
+   * holds no copy of the field values and is only valid for as long as the
+   * StructSet it came from.
+   */
+  class APACHE_GEODE_EXPORT Row {
+   public:
+    Row(StructSet* parent, const std::shared_ptr<Serializable>* values,
+        int32_t size)
+        : parent_(parent), values_(values), size_(size) {}
+
+    /**
+     * Creates a view of the field values of a Struct, which the Row keeps
+     * alive.
+     */
+    Row(StructSet* parent, std::shared_ptr<Struct> row);
+
+    /**
+     * Get the number of field values in the row.
+     */
+    int32_t size() const { return size_; }
+
+    /**
+     * Get the field value for the given index number.
+     *
+     * @throws OutOfRangeException if the index is out of bounds.
+     */
+    const std::shared_ptr<Serializable>& operator[](int32_t index) const {
+      if (index < 0 || index >= size_) {
+        throw OutOfRangeException("StructSet::Row: index out of bounds.");
+      }
+      return values_[index];
+    }
+
+    /**
+     * Get the field value for the given field name.
+     *
+     * @throws std::invalid_argument if the field name is not found.
+     */
+    const std::shared_ptr<Serializable>& operator[](
+        const std::string& fieldName) const {
+      return values_[parent_->getFieldIndex(fieldName)];
+    }
+
+    /**
+     * Get the field value for the given index number as type
+     * <code>T</code>.
+     *
+     * @returns the field value or nullptr if it is not a <code>T</code>.
+     * @throws OutOfRangeException if the index is out of bounds.
+     */
+    template <class T>
+    std::shared_ptr<T> get(int32_t index) const {
+      return std::dynamic_pointer_cast<T>(operator[](index));
+    }
+
+   private:
+    StructSet* parent_;
+    std::shared_ptr<Struct> struct_;
+    const std::shared_ptr<Serializable>* values_;
+    int32_t size_;
+  };
+
+  /**
+   * Get a view of the row at the specified index number without creating a
+   * Struct for it. The default implementation views the Struct returned by
+   * operator[].
+   *
+   * @param index the index number of the row.
+   * @throws IllegalArgumentException if the index is out of bounds.
+   */
+  virtual Row getRow(size_t index);
+
+  /**
+   * Get the values of one field for every row, as type <code>T</code>.
+   *
+   * @param fieldIndex the index number of the field.
+   * @returns one value per row, nullptr where the value is not a
+   * <code>T</code>.
+   * @throws OutOfRangeException if the field index is out of bounds.
+   */
+  template <class T>
+  std::vector<std::shared_ptr<T>> getColumn(int32_t fieldIndex) {
+    std::vector<std::shared_ptr<T>> column;
+    column.reserve(size());
+    for (size_t row = 0, rows = size(); row < rows; row++) {
+      column.push_back(getRow(row).template get<T>(fieldIndex));
+    }
+    return column;
+  }
+
+  /**
+   * Get the values of the named field for every row, as type
+   * <code>T</code>.
+   *
+   * @throws std::invalid_argument if the field name is not found.
+   */
+  template <class T>
+  std::vector<std::shared_ptr<T>> getColumn(const std::string& fieldName) {
+    return getColumn<T>(getFieldIndex(fieldName));
+  }
 };
 
 }  // namespace client
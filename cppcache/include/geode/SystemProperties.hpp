@@ -115,6 +115,20 @@ class APACHE_GEODE_EXPORT SystemProperties {
     return m_statisticsArchiveFile;
   }
 
+  /**
+   * Returns the loopback TCP port on which statistics are served in
+   * OpenMetrics text format, 0 if disabled.
+   */
+  uint16_t statisticsExporterPort() const { return m_statisticsExporterPort; }
+
+  /**
+   * Returns the Unix domain socket path on which statistics are served in
+   * OpenMetrics text format, empty if disabled.
+   */
+  const std::string& statisticsExporterSocket() const {
+    return m_statisticsExporterSocket;
+  }
+
   /**
    * Returns the name of the filename into which logging would
    * be done.
@@ -209,6 +223,43 @@ class APACHE_GEODE_EXPORT SystemProperties {
     return m_connectTimeout;
   }
 
+  /**
+   * Returns how long a server list fetched from a locator is reused to pick
+   * servers for new pool connections, zero if every new connection queries a
+   * locator.
+   */
+  const std::chrono::milliseconds& locatorCacheTtl() const {
+    return m_locatorCacheTtl;
+  }
+
+  /**
+   * Returns the minimum time between two single-hop metadata refreshes of the
+   * same partitioned region.
+   */
+  const std::chrono::milliseconds& metadataRefreshInterval() const {
+    return m_metadataRefreshInterval;
+  }
+
+  /**
+   * Returns how long creating a pool waits for its minimum number of
+   * connections, zero if the connections are created in the background.
+   */
+  const std::chrono::milliseconds& poolWarmupTimeout() const {
+    return m_poolWarmupTimeout;
+  }
+
+  /**
+   * Returns how many connections a pool creates concurrently to reach its
+   * minimum number of connections.
+   */
+  uint32_t poolWarmupThreads() const { return m_poolWarmupThreads; }
+
+  /**
+   * Returns the number of entries a putAll sends per request, zero if a
+   * putAll is always sent as one request.
+   */
+  uint32_t putAllBatchSize() const { return m_putAllBatchSize; }
+
   /**
    * Returns the connect wait timeout(in milliseconds) used for to connect to
    * server This is only applicable for linux
@@ -285,6 +336,12 @@ class APACHE_GEODE_EXPORT SystemProperties {
     m_onClientDisconnectClearPdxTypeIds = set;
   }
 
+  /**
+   * Returns true if byte arrays read from a server reply share the reply
+   * buffer instead of being copied. Default is false.
+   */
+  bool zeroCopyByteArrays() const { return m_zeroCopyByteArrays; }
+
   /**
    * @return Empty string
    * @deprecated Diffie-Hellman based credentials encryption is not supported.
@@ -354,6 +411,10 @@ class APACHE_GEODE_EXPORT SystemProperties {
 
   std::string m_statisticsArchiveFile;
 
+  uint16_t m_statisticsExporterPort;
+
+  std::string m_statisticsExporterSocket;
+
   std::string m_logFilename;
 
   LogLevel m_logLevel;
@@ -394,6 +455,11 @@ class APACHE_GEODE_EXPORT SystemProperties {
   std::chrono::milliseconds m_connectTimeout;
   std::chrono::milliseconds m_connectWaitTimeout;
   std::chrono::milliseconds m_bucketWaitTimeout;
+  std::chrono::milliseconds m_locatorCacheTtl;
+  std::chrono::milliseconds m_metadataRefreshInterval;
+  std::chrono::milliseconds m_poolWarmupTimeout;
+  uint32_t m_poolWarmupThreads;
+  uint32_t m_putAllBatchSize;
 
   bool m_autoReadyForEvents;
 
@@ -411,6 +477,7 @@ class APACHE_GEODE_EXPORT SystemProperties {
   std::chrono::milliseconds m_tombstoneTimeout;
   bool m_enableChunkHandlerThread;
   bool m_onClientDisconnectClearPdxTypeIds;
+  bool m_zeroCopyByteArrays;
 
   /**
    * Processes the given property/value pair, saving
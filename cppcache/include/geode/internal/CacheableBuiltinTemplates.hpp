@@ -21,6 +21,8 @@
 #define GEODE_CACHEABLEBUILTINTEMPLATES_H_
 
 #include <cstring>
+#include <mutex>
+#include <type_traits>
 
 #include "../CacheableKey.hpp"
 #include "../CacheableString.hpp"
@@ -107,12 +109,45 @@ class CacheableArrayPrimitive : public DataSerializablePrimitive {
   DSCode getDsCode() const override { return GeodeTypeId; }
 
   size_t objectSize() const override {
+    if (m_shared) {
+      return sizeof(T) * m_sharedLength;
+    }
     return static_cast<uint32_t>(
         apache::geode::client::serializer::objectArraySize(m_value));
   }
 
  private:
-  std::vector<T> m_value;
+  mutable std::vector<T> m_value;
+
+  // Arrays of bytes may instead refer to the buffer they were read from, see
+  // DataInput::readBytesShared, and are only copied to m_value on demand.
+  std::shared_ptr<const T> m_shared;
+  size_t m_sharedLength = 0;
+  mutable std::once_flag m_copied;
+
+  using can_share = std::integral_constant<
+      bool, sizeof(T) == 1 && is_bulk_serializable<T>::value>;
+
+  // Templates, so that explicit instantiations only compile the one used.
+  template <typename TT = T>
+  void readArray(DataInput& input, std::false_type) {
+    m_value = apache::geode::client::serializer::readArrayObject<T>(input);
+  }
+
+  template <typename TT = T>
+  void readArray(DataInput& input, std::true_type) {
+    auto length = input.readArrayLength();
+    if (length > 0) {
+      if (auto bytes = input.readBytesShared(length)) {
+        m_shared = std::shared_ptr<const TT>(
+            bytes, reinterpret_cast<const TT*>(bytes.get()));
+        m_sharedLength = length;
+        return;
+      }
+    }
+    m_value.resize(length > 0 ? length : 0);
+    input.readArrayOnly(m_value.data(), m_value.size());
+  }
 
  public:
   inline CacheableArrayPrimitive() = default;
@@ -128,9 +163,30 @@ class CacheableArrayPrimitive : public DataSerializablePrimitive {
   CacheableArrayPrimitive& operator=(const CacheableArrayPrimitive& other) =
       delete;
 
-  inline const std::vector<T>& value() const { return m_value; }
+  /**
+   * Returns the values, copying them first if they still refer to the buffer
+   * they were read from.
+   */
+  inline const std::vector<T>& value() const {
+    if (m_shared) {
+      std::call_once(m_copied, [this] {
+        m_value.assign(m_shared.get(), m_shared.get() + m_sharedLength);
+      });
+    }
+    return m_value;
+  }
+
+  /**
+   * Returns the values without copying them, valid as long as this object.
+   */
+  template <typename TT = T>
+  inline const TT* data() const {
+    return m_shared ? m_shared.get() : m_value.data();
+  }
 
-  inline int32_t length() const { return static_cast<int32_t>(m_value.size()); }
+  inline int32_t length() const {
+    return static_cast<int32_t>(m_shared ? m_sharedLength : m_value.size());
+  }
 
   static std::shared_ptr<Serializable> createDeserializable() {
     return std::make_shared<CacheableArrayPrimitive<T, GeodeTypeId>>();
@@ -153,19 +209,24 @@ class CacheableArrayPrimitive : public DataSerializablePrimitive {
   }
 
   inline T operator[](int32_t index) const {
-    if (index >= static_cast<int32_t>(m_value.size())) {
+    if (index >= length()) {
       throw OutOfRangeException(
           "CacheableArrayPrimitive::operator[]: Index out of range.");
     }
-    return m_value[index];
+    return m_shared ? m_shared.get()[index] : m_value[index];
   }
 
   virtual void toData(DataOutput& output) const override {
-    apache::geode::client::serializer::writeArrayObject(output, m_value);
+    if (m_shared) {
+      apache::geode::client::serializer::writeObject(output, m_shared.get(),
+                                                     length());
+    } else {
+      apache::geode::client::serializer::writeArrayObject(output, m_value);
+    }
   }
 
   virtual void fromData(DataInput& input) override {
-    m_value = apache::geode::client::serializer::readArrayObject<T>(input);
+    readArray(input, can_share{});
   }
 };
 
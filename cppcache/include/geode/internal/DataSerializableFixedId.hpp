@@ -34,6 +34,11 @@ namespace internal {
 
 class APACHE_GEODE_EXPORT DataSerializableFixedId
     : public virtual Serializable {
+ protected:
+  DataSerializableFixedId() {
+    setSerializationKind(SerializationKind::DataSerializableFixedId, this);
+  }
+
  public:
   ~DataSerializableFixedId() noexcept override = default;
 
@@ -33,6 +33,11 @@ namespace internal {
 
 class APACHE_GEODE_EXPORT DataSerializableInternal
     : public virtual Serializable {
+ protected:
+  DataSerializableInternal() {
+    setSerializationKind(SerializationKind::DataSerializableInternal, this);
+  }
+
  public:
   ~DataSerializableInternal() override = default;
   virtual void toData(DataOutput& dataOutput) const = 0;
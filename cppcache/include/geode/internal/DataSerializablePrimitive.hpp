@@ -34,6 +34,11 @@ namespace internal {
 
 class APACHE_GEODE_EXPORT DataSerializablePrimitive
     : public virtual Serializable {
+ protected:
+  DataSerializablePrimitive() {
+    setSerializationKind(SerializationKind::DataSerializablePrimitive, this);
+  }
+
  public:
   ~DataSerializablePrimitive() noexcept override = default;
   virtual void toData(DataOutput& dataOutput) const = 0;
@@ -27,6 +27,8 @@
 #include <string>
 #include <type_traits>
 
+#include "geode_base.hpp"
+
 namespace apache {
 namespace geode {
 namespace client {
@@ -105,6 +107,16 @@ struct geode_hash<std::u16string> {
   }
 };
 
+/**
+ * Continues hash, a java.lang.String hash, over the leading ASCII characters
+ * of the length bytes at data, several characters at a time.
+ *
+ * @return the number of characters hashed.
+ */
+APACHE_GEODE_EXPORT std::size_t java_hash_ascii(const char* data,
+                                                std::size_t length,
+                                                int32_t& hash);
+
 /**
  * Hashes like java.lang.String
  */
@@ -113,7 +125,9 @@ struct geode_hash<std::string> {
   inline int32_t operator()(const std::string& val) {
     int32_t hash = 0;
 
-    for (auto&& it = val.cbegin(); it < val.cend(); it++) {
+    // Keys are mostly ASCII, where each byte is a UTF-16 code unit.
+    auto ascii = java_hash_ascii(val.data(), val.length(), hash);
+    for (auto&& it = val.cbegin() + ascii; it < val.cend(); it++) {
       auto cp = static_cast<uint32_t>(0xff & *it);
       if (cp < 0x80) {
         // 1 byte
@@ -0,0 +1,46 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_INTERNAL_TYPE_TRAITS_H_
+#define GEODE_INTERNAL_TYPE_TRAITS_H_
+
+#include <type_traits>
+
+namespace apache {
+namespace geode {
+namespace client {
+namespace internal {
+
+/**
+ * Whether arrays of _T are serialized as the big endian bytes of each value,
+ * as for Java's byte, short, int, long, char, float and double, and so can be
+ * written and read in bulk.
+ */
+template <class _T>
+struct is_bulk_serializable
+    : std::integral_constant<bool, std::is_arithmetic<_T>::value &&
+                                       !std::is_same<_T, bool>::value &&
+                                       sizeof(_T) <= 8> {};
+
+}  // namespace internal
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_INTERNAL_TYPE_TRAITS_H_
@@ -0,0 +1,147 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <framework/Cluster.h>
+#include <framework/Gfsh.h>
+
+// Disable warning for "extra qualifications" here.  One of the boost log
+// headers triggers this warning.  See RegionBM.cpp.
+#ifdef WIN32
+#pragma warning(disable : 4596)
+#endif
+
+#include <boost/log/core.hpp>
+#include <boost/log/expressions.hpp>
+#include <boost/log/trivial.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <geode/Cache.hpp>
+#include <geode/CacheableString.hpp>
+#include <geode/PoolManager.hpp>
+#include <geode/RegionFactory.hpp>
+#include <geode/RegionShortcut.hpp>
+
+using apache::geode::client::Cache;
+using apache::geode::client::Cacheable;
+using apache::geode::client::CacheableKey;
+using apache::geode::client::HashMapOfCacheable;
+using apache::geode::client::Region;
+using apache::geode::client::RegionShortcut;
+
+namespace {
+
+constexpr int SERVERS = 8;
+constexpr int ENTRIES = 10000;
+
+/**
+ * Single-hop getAll of ENTRIES keys spread over a local SERVERS server
+ * cluster. Range 0 uses a PROXY region, range 1 a CACHING_PROXY region so the
+ * local cache population done by the getAll workers is included.
+ */
+class GetAllBM : public benchmark::Fixture {
+ public:
+  GetAllBM() {
+    boost::log::core::get()->set_filter(boost::log::trivial::severity >=
+                                        boost::log::trivial::warning);
+  }
+
+  using benchmark::Fixture::SetUp;
+  void SetUp(benchmark::State& state) override {
+    if (!cluster) {
+      cluster = std::unique_ptr<Cluster>(
+          new Cluster(::Name{name_}, LocatorCount{1}, ServerCount{SERVERS}));
+      cluster->start();
+      cluster->getGfsh()
+          .create()
+          .region()
+          .withName("region")
+          .withType("PARTITION")
+          .execute();
+
+      cache = std::unique_ptr<Cache>(new Cache(cluster->createCache()));
+      region = cache
+                   ->createRegionFactory(state.range(0)
+                                             ? RegionShortcut::CACHING_PROXY
+                                             : RegionShortcut::PROXY)
+                   .setPoolName("default")
+                   .create("region");
+
+      HashMapOfCacheable map;
+      keys.reserve(ENTRIES);
+      for (int i = 0; i < ENTRIES; i++) {
+        auto key = CacheableKey::create(i);
+        map.emplace(key, Cacheable::create(std::to_string(i)));
+        keys.push_back(key);
+      }
+      region->putAll(map);
+
+      // Warm up the single-hop metadata.
+      region->getAll(keys);
+    }
+  }
+
+  using benchmark::Fixture::TearDown;
+  void TearDown(benchmark::State&) override {
+    if (cluster) {
+      keys.clear();
+      region = nullptr;
+      cache->close();
+      cache = nullptr;
+      cluster = nullptr;
+    }
+  }
+
+ protected:
+  void SetName(const char* name) {
+    name_ = name;
+
+    Benchmark::SetName(name);
+  }
+
+  std::unique_ptr<Cluster> cluster;
+  std::unique_ptr<Cache> cache;
+  std::shared_ptr<Region> region;
+  std::vector<std::shared_ptr<CacheableKey>> keys;
+
+ private:
+  std::string name_;
+};
+
+BENCHMARK_DEFINE_F(GetAllBM, getAll)(benchmark::State& state) {
+  for (auto _ : state) {
+    if (state.range(0)) {
+      state.PauseTiming();
+      region->localClear();
+      state.ResumeTiming();
+    }
+    auto values = region->getAll(keys);
+    benchmark::DoNotOptimize(values);
+  }
+  state.SetItemsProcessed(state.iterations() * ENTRIES);
+}
+
+BENCHMARK_REGISTER_F(GetAllBM, getAll)
+    ->Arg(0)
+    ->Arg(1)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+}  // namespace
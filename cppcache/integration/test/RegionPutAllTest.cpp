@@ -18,6 +18,7 @@
 #include <chrono>
 #include <future>
 #include <iostream>
+#include <iterator>
 #include <random>
 #include <thread>
 
@@ -27,8 +28,10 @@
 #include <geode/PoolManager.hpp>
 #include <geode/RegionFactory.hpp>
 #include <geode/RegionShortcut.hpp>
+#include <geode/TypeRegistry.hpp>
 
 #include "CacheRegionHelper.hpp"
+#include "PositionKey.hpp"
 #include "framework/Cluster.h"
 #include "framework/Framework.h"
 #include "framework/Gfsh.h"
@@ -37,13 +40,17 @@ namespace {
 
 using apache::geode::client::Cache;
 using apache::geode::client::Cacheable;
+using apache::geode::client::CacheableInt32;
 using apache::geode::client::CacheableKey;
 using apache::geode::client::CacheableString;
 using apache::geode::client::HashMapOfCacheable;
 using apache::geode::client::Pool;
+using apache::geode::client::PutAllPartialResultException;
 using apache::geode::client::Region;
 using apache::geode::client::RegionShortcut;
 
+using DataSerializableTest::PositionKey;
+
 using std::chrono::minutes;
 
 Cache createCache() {
@@ -137,4 +144,124 @@ TEST(RegionPutAllTest, putAllAndVerifyKeysExist) {
     ASSERT_TRUE(region->containsKeyOnServer(key.first));
   }
 }
+
+//
+// verifies that a putAll larger than put-all-batch-size is sent in several
+// requests, with and without single hop, and that the version tags of all
+// batches are applied to the local cache.
+//
+TEST(RegionPutAllTest, putAllInBatches) {
+  Cluster cluster{LocatorCount{1}, ServerCount{2}};
+
+  cluster.start();
+
+  cluster.getGfsh()
+      .create()
+      .region()
+      .withName("region")
+      .withType("PARTITION")
+      .execute();
+
+  for (auto singleHop : {false, true}) {
+    auto cache = apache::geode::client::CacheFactory()
+                     .set("log-level", "none")
+                     .set("statistic-sampling-enabled", "false")
+                     .set("put-all-batch-size", "10")
+                     .create();
+    auto poolFactory = cache.getPoolManager().createFactory();
+    cluster.applyLocators(poolFactory);
+    poolFactory.setPRSingleHopEnabled(singleHop);
+    auto pool = poolFactory.create("default");
+    auto region = cache.createRegionFactory(RegionShortcut::CACHING_PROXY)
+                      .setPoolName(pool->getName())
+                      .create("region");
+
+    HashMapOfCacheable all;
+    for (int i = 0; i < 95; i++) {
+      all.emplace(CacheableKey::create(std::to_string(i)),
+                  Cacheable::create(i + (singleHop ? 1000 : 0)));
+    }
+    region->putAll(all);
+
+    for (auto& entry : all) {
+      ASSERT_TRUE(region->containsKeyOnServer(entry.first));
+      auto value =
+          std::dynamic_pointer_cast<CacheableInt32>(region->get(entry.first));
+      ASSERT_NE(nullptr, value);
+      auto expected = std::dynamic_pointer_cast<CacheableInt32>(entry.second);
+      EXPECT_EQ(expected->value(), value->value());
+    }
+    EXPECT_EQ(all.size(), region->size());
+
+    cache.close();
+  }
+}
+
+//
+// verifies that when a later batch of a putAll fails on the server the
+// batches already committed there are still applied to the local cache and
+// the failure is reported as a partial result. The server has no instantiator
+// for PositionKey, so the batch carrying it fails to deserialize.
+//
+TEST(RegionPutAllTest, putAllBatchFailurePartwayThrough) {
+  Cluster cluster{LocatorCount{1}, ServerCount{1}};
+
+  cluster.start();
+
+  cluster.getGfsh()
+      .create()
+      .region()
+      .withName("region")
+      .withType("PARTITION")
+      .execute();
+
+  HashMapOfCacheable all;
+  for (int i = 0; i < 95; i++) {
+    all.emplace(CacheableKey::create(std::to_string(i)), Cacheable::create(i));
+  }
+
+  // Start the second batch with the key the server cannot read.
+  std::shared_ptr<CacheableKey> badKey;
+  size_t badIndex = 0;
+  for (int64_t id = 1; badIndex == 0; id++) {
+    if (badKey) {
+      all.erase(badKey);
+    }
+    badKey = std::make_shared<PositionKey>(id);
+    all.emplace(badKey, Cacheable::create(-1));
+    badIndex = static_cast<size_t>(
+        std::distance(all.begin(), all.find(badKey)));
+  }
+
+  for (auto singleHop : {false, true}) {
+    auto cache = apache::geode::client::CacheFactory()
+                     .set("log-level", "none")
+                     .set("statistic-sampling-enabled", "false")
+                     .set("put-all-batch-size", std::to_string(badIndex))
+                     .create();
+    cache.getTypeRegistry().registerType(PositionKey::createDeserializable, 21);
+    auto poolFactory = cache.getPoolManager().createFactory();
+    cluster.applyLocators(poolFactory);
+    poolFactory.setPRSingleHopEnabled(singleHop);
+    auto pool = poolFactory.create("default");
+    auto region = cache.createRegionFactory(RegionShortcut::CACHING_PROXY)
+                      .setPoolName(pool->getName())
+                      .create("region");
+
+    EXPECT_THROW(region->putAll(all), PutAllPartialResultException);
+
+    size_t index = 0;
+    for (auto& entry : all) {
+      if (index++ < badIndex) {
+        EXPECT_TRUE(region->containsKey(entry.first));
+        EXPECT_TRUE(region->containsKeyOnServer(entry.first));
+      } else {
+        EXPECT_FALSE(region->containsKey(entry.first));
+      }
+    }
+    EXPECT_EQ(badIndex, region->size());
+
+    cache.close();
+  }
+}
 }  // namespace
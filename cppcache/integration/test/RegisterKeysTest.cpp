@@ -42,10 +42,12 @@ using apache::geode::client::CacheableInt16;
 using apache::geode::client::CacheableKey;
 using apache::geode::client::CacheableString;
 using apache::geode::client::CacheFactory;
+using apache::geode::client::HashMapOfCacheable;
 using apache::geode::client::CacheListenerMock;
 using apache::geode::client::IllegalStateException;
 using apache::geode::client::Region;
 using apache::geode::client::RegionShortcut;
+using apache::geode::client::Serializable;
 
 using ::testing::_;
 using ::testing::DoAll;
@@ -127,6 +129,73 @@ TEST(RegisterKeysTest, RegisterAllWithCachingRegion) {
   }
 }
 
+TEST(RegisterKeysTest, RegisterAllAndKeysLoadsEveryInitialValue) {
+  Cluster cluster{LocatorCount{1}, ServerCount{2}};
+
+  cluster.start();
+
+  cluster.getGfsh()
+      .create()
+      .region()
+      .withName("region")
+      .withType("PARTITION")
+      .execute();
+
+  // Enough entries for the initial image to span many reply chunks.
+  constexpr int ENTRIES = 5000;
+  std::vector<std::shared_ptr<CacheableKey>> keys;
+  {
+    auto cache = createTestCache();
+    auto poolFactory = cache.getPoolManager().createFactory();
+    cluster.applyLocators(poolFactory);
+    poolFactory.create("default");
+    auto region = setupProxyRegion(cache);
+
+    HashMapOfCacheable map;
+    for (int i = 0; i < ENTRIES; i++) {
+      auto key = CacheableKey::create(i);
+      map.emplace(key, Serializable::create(std::to_string(i)));
+      keys.push_back(key);
+    }
+    region->putAll(map);
+    cache.close();
+  }
+
+  {
+    auto cache = createTestCache();
+    auto poolFactory =
+        cache.getPoolManager().createFactory().setSubscriptionEnabled(true);
+    cluster.applyLocators(poolFactory);
+    poolFactory.create("default");
+    auto region = setupCachingProxyRegion(cache);
+
+    region->registerAllKeys(false, true);
+
+    ASSERT_EQ(static_cast<uint32_t>(ENTRIES), region->size());
+    for (int i = 0; i < ENTRIES; i++) {
+      auto value = std::dynamic_pointer_cast<CacheableString>(
+          region->getEntry(CacheableKey::create(i))->getValue());
+      ASSERT_NE(nullptr, value);
+      ASSERT_EQ(std::to_string(i), value->value());
+    }
+    cache.close();
+  }
+
+  {
+    auto cache = createTestCache();
+    auto poolFactory =
+        cache.getPoolManager().createFactory().setSubscriptionEnabled(true);
+    cluster.applyLocators(poolFactory);
+    poolFactory.create("default");
+    auto region = setupCachingProxyRegion(cache);
+
+    region->registerKeys(keys, false, true);
+
+    ASSERT_EQ(static_cast<uint32_t>(ENTRIES), region->size());
+    cache.close();
+  }
+}
+
 TEST(RegisterKeysTest, RegisterAllWithConsistencyDisabled) {
   Cluster cluster{LocatorCount{1}, ServerCount{1}};
 
@@ -34,6 +34,7 @@
 #include "LocalRegion.hpp"
 #include "PdxTypeRegistry.hpp"
 #include "SerializationRegistry.hpp"
+#include "SslContext.hpp"
 #include "TcrConnectionManager.hpp"
 #include "TcrEndpoint.hpp"
 #include "TcrMessage.hpp"
@@ -44,6 +45,7 @@
 #include "ThinClientRegion.hpp"
 #include "ThreadPool.hpp"
 #include "Utils.hpp"
+#include "statistics/OpenMetricsExporter.hpp"
 
 #define DEFAULT_DS_NAME "default_GeodeDS"
 
@@ -82,6 +84,18 @@ CacheImpl::CacheImpl(Cache* c, const std::shared_ptr<Properties>& dsProps,
       new InternalCacheTransactionManager2PCImpl(this));
 
   auto& prop = m_distributedSystem.getSystemProperties();
+
+  // Bind the statistics exporter before any service thread is started, so
+  // that a port or socket that cannot be bound fails cleanly.
+  std::unique_ptr<statistics::OpenMetricsExporter> exporter;
+  if (prop.statisticsExporterPort() != 0 ||
+      !prop.statisticsExporterSocket().empty()) {
+    exporter = std::unique_ptr<statistics::OpenMetricsExporter>(
+        new statistics::OpenMetricsExporter(prop.statisticsExporterPort(),
+                                            prop.statisticsExporterSocket()));
+    exporter->listen();
+  }
+
   if (prop.heapLRULimitEnabled()) {
     m_evictionController = std::unique_ptr<EvictionController>(
         new EvictionController(prop.heapLRULimit(), prop.heapLRUDelta(), this));
@@ -102,6 +116,9 @@ CacheImpl::CacheImpl(Cache* c, const std::shared_ptr<Properties>& dsProps,
             prop.statisticsArchiveFile().c_str(),
             prop.statisticsSampleInterval(), prop.statisticsEnabled(), this,
             prop.statsFileSizeLimit(), prop.statsDiskSpaceLimit()));
+    if (exporter) {
+      m_statisticsManager->startExporter(std::move(exporter));
+    }
     m_cacheStats =
         new CachePerfStats(m_statisticsManager->getStatisticsFactory());
   } catch (const NullPointerException&) {
@@ -781,6 +798,17 @@ std::shared_ptr<SerializationRegistry> CacheImpl::getSerializationRegistry()
 
 ThreadPool& CacheImpl::getThreadPool() { return m_threadPool; }
 
+std::shared_ptr<SslContext> CacheImpl::getSslContext() {
+  std::lock_guard<decltype(m_sslContextMutex)> guard(m_sslContextMutex);
+  if (!m_sslContext) {
+    auto& systemProperties = getSystemProperties();
+    m_sslContext = std::make_shared<SslContext>(
+        systemProperties.sslTrustStore(), systemProperties.sslKeyStore(),
+        systemProperties.sslKeystorePassword());
+  }
+  return m_sslContext;
+}
+
 std::shared_ptr<CacheTransactionManager>
 CacheImpl::getCacheTransactionManager() {
   this->throwIfClosed();
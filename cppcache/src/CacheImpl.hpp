@@ -59,6 +59,7 @@ class PdxTypeRegistry;
 class Pool;
 class RegionAttributes;
 class SerializationRegistry;
+class SslContext;
 class ThreadPool;
 class EvictionController;
 class TcrConnectionManager;
@@ -288,6 +289,13 @@ class APACHE_GEODE_EXPORT CacheImpl {
 
   ThreadPool& getThreadPool();
 
+  /**
+   * Returns the TLS context shared by all SSL connections of this cache,
+   * loading the configured trust and key stores on first use.
+   * @throws SslException if the stores could not be loaded.
+   */
+  std::shared_ptr<SslContext> getSslContext();
+
   inline const std::shared_ptr<AuthInitialize>& getAuthInitialize() {
     return m_authInitialize;
   }
@@ -382,6 +390,8 @@ class APACHE_GEODE_EXPORT CacheImpl {
   const std::shared_ptr<AuthInitialize> m_authInitialize;
   std::unique_ptr<TypeRegistry> m_typeRegistry;
   bool m_keepAlive;
+  std::shared_ptr<SslContext> m_sslContext;
+  std::mutex m_sslContextMutex;
 
   inline void throwIfClosed() const {
     if (m_closed) {
@@ -59,6 +59,10 @@ auto REGION_ATTRIBUTES = "region-attributes";
 
 auto LRU_ENTRIES_LIMIT = "lru-entries-limit";
 
+auto NEGATIVE_CACHE_ENTRIES_LIMIT = "negative-cache-entries-limit";
+
+auto NEGATIVE_CACHE_TIME_TO_LIVE = "negative-cache-time-to-live";
+
 auto DISK_POLICY = "disk-policy";
 
 auto ENDPOINTS = "endpoints";
@@ -90,6 +94,9 @@ auto CACHE_LISTENER = "cache-listener";
 /** The name of the <code>partition-resolver</code> element */
 auto PARTITION_RESOLVER = "partition-resolver";
 
+/** The name of the <code>compressor</code> element */
+auto COMPRESSOR = "compressor";
+
 auto LIBRARY_NAME = "library-name";
 
 auto LIBRARY_FUNCTION_NAME = "library-function-name";
@@ -165,6 +172,8 @@ auto PROPERTY = "property";
 
 auto CONCURRENCY_CHECKS_ENABLED = "concurrency-checks-enabled";
 
+auto SUBSCRIPTION_CONFLATION_ENABLED = "subscription-conflation-enabled";
+
 auto TOMBSTONE_TIMEOUT = "tombstone-timeout";
 
 /** Pool elements and attributes */
@@ -259,6 +268,7 @@ FactoryLoaderFn<CacheListener> CacheXmlParser::managedCacheListenerFn_ =
 FactoryLoaderFn<PartitionResolver> CacheXmlParser::managedPartitionResolverFn_ =
     nullptr;
 FactoryLoaderFn<CacheWriter> CacheXmlParser::managedCacheWriterFn_ = nullptr;
+FactoryLoaderFn<Compressor> CacheXmlParser::managedCompressorFn_ = nullptr;
 FactoryLoaderFn<PersistenceManager>
     CacheXmlParser::managedPersistenceManagerFn_ = nullptr;
 
@@ -300,6 +310,8 @@ CacheXmlParser::CacheXmlParser(Cache *cache)
   start_element_map_.emplace(
       std::make_pair(std::string(PARTITION_RESOLVER),
                      &CacheXmlParser::startPartitionResolver));
+  start_element_map_.emplace(std::make_pair(std::string(COMPRESSOR),
+                                            &CacheXmlParser::startCompressor));
   start_element_map_.emplace(
       std::make_pair(std::string(PERSISTENCE_MANAGER),
                      &CacheXmlParser::startPersistenceManager));
@@ -886,6 +898,21 @@ void CacheXmlParser::startRegionAttributes(const xercesc::Attributes &attrs) {
       regionAttributesFactory->setLruEntriesLimit(std::stoi(lruEntriesLimit));
     }
 
+    auto negativeCacheEntriesLimit =
+        getOptionalAttribute(attrs, NEGATIVE_CACHE_ENTRIES_LIMIT);
+    if (!negativeCacheEntriesLimit.empty()) {
+      regionAttributesFactory->setNegativeCacheEntriesLimit(
+          std::stoi(negativeCacheEntriesLimit));
+    }
+
+    auto negativeCacheTimeToLive =
+        getOptionalAttribute(attrs, NEGATIVE_CACHE_TIME_TO_LIVE);
+    if (!negativeCacheTimeToLive.empty()) {
+      using apache::geode::internal::chrono::duration::from_string;
+      regionAttributesFactory->setNegativeCacheTimeToLive(
+          from_string<std::chrono::milliseconds>(negativeCacheTimeToLive));
+    }
+
     auto diskPolicyString = getOptionalAttribute(attrs, DISK_POLICY);
     if (!diskPolicyString.empty()) {
       auto diskPolicy = apache::geode::client::DiskPolicyType::NONE;
@@ -957,6 +984,26 @@ void CacheXmlParser::startRegionAttributes(const xercesc::Attributes &attrs) {
       }
       regionAttributesFactory->setConcurrencyChecksEnabled(flag);
     }
+
+    auto subscriptionConflationEnabled =
+        getOptionalAttribute(attrs, SUBSCRIPTION_CONFLATION_ENABLED);
+    if (!subscriptionConflationEnabled.empty()) {
+      bool flag = false;
+      std::transform(subscriptionConflationEnabled.begin(),
+                     subscriptionConflationEnabled.end(),
+                     subscriptionConflationEnabled.begin(), ::tolower);
+      if ("false" == subscriptionConflationEnabled) {
+        flag = false;
+      } else if ("true" == subscriptionConflationEnabled) {
+        flag = true;
+      } else {
+        throw CacheXmlException(
+            "XML: " + subscriptionConflationEnabled +
+            " is not a valid value for the attribute <" +
+            std::string(SUBSCRIPTION_CONFLATION_ENABLED) + ">");
+      }
+      regionAttributesFactory->setSubscriptionConflationEnabled(flag);
+    }
   }
 
   if (isDistributed && isTCR) {
@@ -1118,6 +1165,17 @@ void CacheXmlParser::startPartitionResolver(const xercesc::Attributes &attrs) {
                                                 libraryFunctionName);
 }
 
+void CacheXmlParser::startCompressor(const xercesc::Attributes &attrs) {
+  auto libraryName = getLibraryName(attrs);
+  auto libraryFunctionName = getLibraryFunctionName(attrs);
+
+  verifyFactoryFunction(managedCompressorFn_, libraryName, libraryFunctionName);
+
+  auto regionAttributesFactory =
+      std::static_pointer_cast<RegionAttributesFactory>(_stack.top());
+  regionAttributesFactory->setCompressor(libraryName, libraryFunctionName);
+}
+
 void CacheXmlParser::startCacheWriter(const xercesc::Attributes &attrs) {
   auto libraryName = getLibraryName(attrs);
   auto libraryFunctionName = getLibraryFunctionName(attrs);
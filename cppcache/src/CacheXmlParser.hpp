@@ -32,6 +32,7 @@
 #include <geode/Cache.hpp>
 #include <geode/CacheListener.hpp>
 #include <geode/CacheLoader.hpp>
+#include <geode/Compressor.hpp>
 #include <geode/ExceptionTypes.hpp>
 #include <geode/ExpirationAction.hpp>
 #include <geode/ExpirationAttributes.hpp>
@@ -99,6 +100,7 @@ class CacheXmlParser : public xercesc::DefaultHandler {
   void startCacheLoader(const xercesc::Attributes& attrs);
   void startCacheListener(const xercesc::Attributes& attrs);
   void startPartitionResolver(const xercesc::Attributes& attrs);
+  void startCompressor(const xercesc::Attributes& attrs);
   void startCacheWriter(const xercesc::Attributes& attrs);
   void endEntryIdleTime();
   void endEntryTimeToLive();
@@ -144,6 +146,7 @@ class CacheXmlParser : public xercesc::DefaultHandler {
   static FactoryLoaderFn<CacheListener> managedCacheListenerFn_;
   static FactoryLoaderFn<PartitionResolver> managedPartitionResolverFn_;
   static FactoryLoaderFn<CacheWriter> managedCacheWriterFn_;
+  static FactoryLoaderFn<Compressor> managedCompressorFn_;
   static FactoryLoaderFn<PersistenceManager> managedPersistenceManagerFn_;
 
  private:
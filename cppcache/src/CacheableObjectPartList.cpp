@@ -102,6 +102,7 @@ void CacheableObjectPartList::fromData(DataInput& input) {
         // if value has already been received via notification or put by
         // another thread, then return that
         if (oldValue != nullptr && !CacheableToken::isInvalid(oldValue)) {
+          m_region->fromStored(oldValue);
           value = oldValue;
         }
         if (m_values != nullptr) {
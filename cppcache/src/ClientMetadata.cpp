@@ -17,6 +17,7 @@
 
 #include "ClientMetadata.hpp"
 
+#include <algorithm>
 #include <climits>
 #include <cstdlib>
 
@@ -44,6 +45,7 @@ ClientMetadata::ClientMetadata(
     throw IllegalArgumentException(
         "ClientMetaData: ThinClientPoolDM is nullptr.");
   }
+  m_serverGroup = m_tcrdm->getServerGroup();
   if (fpaSet != nullptr) {
     LOGDEBUG(
         "ClientMetadata Creating metadata with %d buckets & fpaset size is "
@@ -64,6 +66,15 @@ ClientMetadata::ClientMetadata(
   }
 }
 
+ClientMetadata::ClientMetadata(int totalNumBuckets, std::string serverGroup)
+    : m_partitionNames(nullptr),
+      m_bucketServerLocationsList(totalNumBuckets),
+      m_previousOne(nullptr),
+      m_totalNumBuckets(totalNumBuckets),
+      m_colocatedWith(),
+      m_tcrdm(nullptr),
+      m_serverGroup(std::move(serverGroup)) {}
+
 ClientMetadata::ClientMetadata(ClientMetadata& other) {
   m_partitionNames = nullptr;
   m_previousOne = nullptr;
@@ -74,6 +85,7 @@ ClientMetadata::ClientMetadata(ClientMetadata& other) {
   }
   m_colocatedWith = other.m_colocatedWith;
   m_tcrdm = other.m_tcrdm;
+  m_serverGroup = other.m_serverGroup;
   for (FixedMapType::iterator iter = other.m_fpaMap.begin();
        iter != other.m_fpaMap.end(); ++iter) {
     m_fpaMap[iter->first] = iter->second;
@@ -126,6 +138,69 @@ void ClientMetadata::removeBucketServerLocation(
   }
 }
 
+std::shared_ptr<ClientMetadata> ClientMetadata::withoutBucketServerLocation(
+    const std::shared_ptr<BucketServerLocation>& serverLocation) {
+  auto copy = std::make_shared<ClientMetadata>(*this);
+  copy->m_bucketServerLocationsList = m_bucketServerLocationsList;
+  copy->removeBucketServerLocation(serverLocation);
+  return copy;
+}
+
+std::shared_ptr<ClientMetadata> ClientMetadata::withBucketServerLocations(
+    const std::vector<BucketServerLocationsType>& bucketServerLocations,
+    int32_t& changedBuckets) {
+  auto copy = std::make_shared<ClientMetadata>(*this);
+  std::vector<bool> reported(m_bucketServerLocationsList.size(), false);
+  changedBuckets = 0;
+  for (const auto& locations : bucketServerLocations) {
+    if (locations.empty()) {
+      continue;
+    }
+    auto bucketId = locations.front()->getBucketId();
+    checkBucketId(bucketId);
+    reported[bucketId] = true;
+    // The current list was pruned by server group when it was stored, so the
+    // reply must be too before the two are compared.
+    if (sameLocations(m_bucketServerLocationsList[bucketId],
+                      filterByServerGroup(locations, m_serverGroup))) {
+      copy->m_bucketServerLocationsList[bucketId] =
+          m_bucketServerLocationsList[bucketId];
+    } else {
+      copy->updateBucketServerLocations(bucketId, locations);
+      changedBuckets++;
+    }
+  }
+  // Buckets missing from the reply have no hosting server anymore.
+  for (size_t bucketId = 0; bucketId < reported.size(); bucketId++) {
+    if (!reported[bucketId] &&
+        !m_bucketServerLocationsList[bucketId].empty()) {
+      copy->m_bucketServerLocationsList[bucketId].clear();
+      changedBuckets++;
+    }
+  }
+  return copy;
+}
+
+bool ClientMetadata::sameLocations(const BucketServerLocationsType& current,
+                                   const BucketServerLocationsType& reported) {
+  if (current.size() != reported.size()) {
+    return false;
+  }
+  for (const auto& location : reported) {
+    auto found = std::find_if(
+        current.begin(), current.end(),
+        [&location](const std::shared_ptr<BucketServerLocation>& other) {
+          return other->getEpString() == location->getEpString() &&
+                 other->isPrimary() == location->isPrimary() &&
+                 other->getVersion() == location->getVersion();
+        });
+    if (found == current.end()) {
+      return false;
+    }
+  }
+  return true;
+}
+
 void ClientMetadata::getServerLocation(
     int bucketId, bool tryPrimary,
     std::shared_ptr<BucketServerLocation>& serverLocation, int8_t& version) {
@@ -162,126 +237,88 @@ void ClientMetadata::getServerLocation(
   // return m_bucketServerLocationsList[bucketId].at(0);
 }
 
-void ClientMetadata::updateBucketServerLocations(
-    int bucketId, BucketServerLocationsType bucketServerLocations) {
-  checkBucketId(bucketId);
-
-  auto&& serverGroup = m_tcrdm->getServerGroup();
-
+BucketServerLocationsType ClientMetadata::filterByServerGroup(
+    const BucketServerLocationsType& bucketServerLocations,
+    const std::string& serverGroup) {
   // This is for pruning according to server groups, only applicable when client
   // is configured with
   // server-group.
-  if (serverGroup.length() != 0) {
-    BucketServerLocationsType primaries;
-    BucketServerLocationsType secondaries;
-    for (BucketServerLocationsType::iterator iter =
-             bucketServerLocations.begin();
-         iter != bucketServerLocations.end(); ++iter) {
-      auto groups = (*iter)->getServerGroups();
-      if ((groups != nullptr) && (groups->length() > 0)) {
-        bool added = false;
-        for (int i = 0; i < groups->length(); i++) {
-          auto cs = (*groups)[i];
-          if (cs->length() > 0) {
-            auto&& str = cs->toString();
-            if (str == serverGroup) {
-              added = true;
-              if ((*iter)->isPrimary()) {
-                primaries.push_back(*iter);
-                break;
-              } else {
-                secondaries.push_back(*iter);
-                break;
-              }
-            }
-          } else {
+  if (serverGroup.length() == 0) {
+    return bucketServerLocations;
+  }
+
+  BucketServerLocationsType filtered;
+  for (const auto& location : bucketServerLocations) {
+    auto groups = location->getServerGroups();
+    if ((groups != nullptr) && (groups->length() > 0)) {
+      bool added = false;
+      for (int i = 0; i < groups->length(); i++) {
+        auto cs = (*groups)[i];
+        if (cs->length() > 0) {
+          auto&& str = cs->toString();
+          if (str == serverGroup) {
             added = true;
-            if ((*iter)->isPrimary()) {
-              primaries.push_back(*iter);
-            } else {
-              secondaries.push_back(*iter);
-            }
-          }
-        }
-        if (!added) {
-          if ((*iter)->isPrimary()) {
-            primaries.push_back(*iter);
-          } else {
-            secondaries.push_back(*iter);
+            filtered.push_back(location);
+            break;
           }
+        } else {
+          added = true;
+          filtered.push_back(location);
         }
       }
+      if (!added) {
+        filtered.push_back(location);
+      }
     }
+  }
+  return filtered;
+}
 
-    // shuffle the deck
-
-    RandGen randGen;
-
-    if (primaries.size() > 0) {
-      std::shuffle(primaries.begin(), primaries.end(), randGen);
-    }
+void ClientMetadata::updateBucketServerLocations(
+    int bucketId, BucketServerLocationsType bucketServerLocations) {
+  checkBucketId(bucketId);
 
-    if (secondaries.size() > 0) {
-      std::shuffle(secondaries.begin(), secondaries.end(), randGen);
-    }
+  BucketServerLocationsType primaries;
+  BucketServerLocationsType secondaries;
 
-    m_bucketServerLocationsList[bucketId].clear();
-    for (BucketServerLocationsType::iterator iter = primaries.begin();
-         iter != primaries.end(); ++iter) {
-      LOGFINER("updating primaries with bucketId %d", bucketId);
-      m_bucketServerLocationsList[bucketId].push_back(*iter);
-    }
+  // separate out the primaries from the secondaries
 
-    // add secondaries to the end
-    for (BucketServerLocationsType::iterator iter = secondaries.begin();
-         iter != secondaries.end(); ++iter) {
-      LOGFINER("updating secondaries with bucketId %d", bucketId);
-      m_bucketServerLocationsList[bucketId].push_back(*iter);
-    }
-  } else {
-    BucketServerLocationsType primaries;
-    BucketServerLocationsType secondaries;
-
-    // separate out the primaries from the secondaries
-
-    for (BucketServerLocationsType::iterator iter =
-             bucketServerLocations.begin();
-         iter != bucketServerLocations.end(); ++iter) {
-      if ((*iter)->isPrimary()) {
-        primaries.push_back(*iter);
-      } else {
-        secondaries.push_back(*iter);
-      }
+  for (auto&& location :
+       filterByServerGroup(bucketServerLocations, m_serverGroup)) {
+    if (location->isPrimary()) {
+      primaries.push_back(location);
+    } else {
+      secondaries.push_back(location);
     }
+  }
 
-    // shuffle the deck
+  // shuffle the deck
 
-    RandGen randGen;
+  RandGen randGen;
 
-    if (primaries.size() > 0) {
-      std::shuffle(primaries.begin(), primaries.end(), randGen);
-    }
+  if (primaries.size() > 0) {
+    std::shuffle(primaries.begin(), primaries.end(), randGen);
+  }
 
-    if (secondaries.size() > 0) {
-      std::shuffle(secondaries.begin(), secondaries.end(), randGen);
-    }
+  if (secondaries.size() > 0) {
+    std::shuffle(secondaries.begin(), secondaries.end(), randGen);
+  }
 
-    m_bucketServerLocationsList[bucketId].clear();
+  m_bucketServerLocationsList[bucketId].clear();
 
-    // add primaries to the front
-    for (BucketServerLocationsType::iterator iter = primaries.begin();
-         iter != primaries.end(); ++iter) {
-      LOGFINER("updating primaries with bucketId %d and Server = %s ", bucketId,
-               (*iter)->getEpString().c_str());
-      m_bucketServerLocationsList[bucketId].push_back(*iter);
-    }
+  // add primaries to the front
+  for (BucketServerLocationsType::iterator iter = primaries.begin();
+       iter != primaries.end(); ++iter) {
+    LOGFINER("updating primaries with bucketId %d and Server = %s ", bucketId,
+             (*iter)->getEpString().c_str());
+    m_bucketServerLocationsList[bucketId].push_back(*iter);
+  }
 
-    // add secondaries to the end
-    for (BucketServerLocationsType::iterator iter = secondaries.begin();
-         iter != secondaries.end(); ++iter) {
-      LOGFINER("updating secondaries with bucketId %d", bucketId);
-      m_bucketServerLocationsList[bucketId].push_back(*iter);
-    }
+  // add secondaries to the end
+  for (BucketServerLocationsType::iterator iter = secondaries.begin();
+       iter != secondaries.end(); ++iter) {
+    LOGFINER("updating secondaries with bucketId %d", bucketId);
+    m_bucketServerLocationsList[bucketId].push_back(*iter);
   }
 }
 
@@ -65,8 +65,18 @@ class ClientMetadata {
           "ClientMetadata::getServerLocation(): BucketId out of range.");
     }
   }
+  std::string m_serverGroup;
 
  public:
+  // Whether a bucket's current locations match a reply's, ignoring order.
+  static bool sameLocations(const BucketServerLocationsType& current,
+                            const BucketServerLocationsType& reported);
+
+  // The locations a client configured with serverGroup routes to.
+  static BucketServerLocationsType filterByServerGroup(
+      const BucketServerLocationsType& bucketServerLocations,
+      const std::string& serverGroup);
+
   void setPreviousone(std::shared_ptr<ClientMetadata> cptr) {
     m_previousOne = cptr;
   }
@@ -75,6 +85,9 @@ class ClientMetadata {
   ClientMetadata(
       int totalNumBuckets, std::string colocatedWith, ThinClientPoolDM* tcrdm,
       std::vector<std::shared_ptr<FixedPartitionAttributesImpl>>* fpaSet);
+  // Metadata of a region without fixed partitions, for a client configured
+  // with serverGroup, that is not tied to a pool.
+  ClientMetadata(int totalNumBuckets, std::string serverGroup);
 
   void getServerLocation(int bucketId, bool tryPrimary,
                          std::shared_ptr<BucketServerLocation>& serverLocation,
@@ -110,6 +123,23 @@ class ClientMetadata {
   void removeBucketServerLocation(
       const std::shared_ptr<BucketServerLocation>& serverLocation);
 
+  /**
+   * Returns a copy of this metadata without serverLocation, leaving this
+   * instance, which may be read concurrently, unchanged.
+   */
+  std::shared_ptr<ClientMetadata> withoutBucketServerLocation(
+      const std::shared_ptr<BucketServerLocation>& serverLocation);
+
+  /**
+   * Returns a copy of this metadata with the bucket locations of a client PR
+   * metadata reply applied. Buckets whose locations and versions are
+   * unchanged keep their current location list, so only moved buckets are
+   * re-sorted. changedBuckets is set to the number of buckets that changed.
+   */
+  std::shared_ptr<ClientMetadata> withBucketServerLocations(
+      const std::vector<BucketServerLocationsType>& bucketServerLocations,
+      int32_t& changedBuckets);
+
   std::string toString();
 };
 }  // namespace client
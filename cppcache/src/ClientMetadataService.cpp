@@ -17,6 +17,7 @@
 
 #include "ClientMetadataService.hpp"
 
+#include <algorithm>
 #include <climits>
 #include <cstdlib>
 
@@ -29,7 +30,6 @@
 #include "TcrConnectionManager.hpp"
 #include "TcrMessage.hpp"
 #include "ThinClientPoolDM.hpp"
-#include "util/queue.hpp"
 
 namespace apache {
 namespace geode {
@@ -37,6 +37,40 @@ namespace client {
 
 const BucketStatus::clock::time_point BucketStatus::m_noTimeout{};
 
+constexpr size_t ClientMetadataSnapshotCache::SIZE;
+
+bool ClientMetadataSnapshotCache::find(
+    const ClientMetadataGeneration* region, uint64_t generation,
+    std::shared_ptr<ClientMetadata>& metadata) const {
+  for (const auto& entry : m_entries) {
+    if (entry.region == region && entry.generation == generation) {
+      metadata = entry.metadata;
+      return true;
+    }
+  }
+  return false;
+}
+
+void ClientMetadataSnapshotCache::store(
+    const ClientMetadataGeneration* region, uint64_t generation,
+    std::shared_ptr<ClientMetadata> metadata) {
+  auto entry = std::find_if(
+      m_entries.begin(), m_entries.end(),
+      [region](const Entry& candidate) { return candidate.region == region; });
+  if (entry == m_entries.end()) {
+    entry = m_entries.begin() + m_next;
+    m_next = (m_next + 1) % SIZE;
+  }
+  entry->region = region;
+  entry->generation = generation;
+  entry->metadata = std::move(metadata);
+}
+
+uint64_t ClientMetadataSnapshotCache::newGeneration() {
+  static std::atomic<uint64_t> lastGeneration(0);
+  return ++lastGeneration;
+}
+
 const char* ClientMetadataService::NC_CMDSvcThread = "NC CMDSvcThread";
 
 ClientMetadataService::ClientMetadataService(ThinClientPoolDM* pool)
@@ -44,6 +78,9 @@ ClientMetadataService::ClientMetadataService(ThinClientPoolDM* pool)
       m_pool(pool),
       m_cache(m_pool->getConnectionManager().getCacheImpl()),
       m_regionQueue(false),
+      m_refreshSchedule(m_cache->getDistributedSystem()
+                            .getSystemProperties()
+                            .metadataRefreshInterval()),
       m_bucketWaitTimeout(m_cache->getDistributedSystem()
                               .getSystemProperties()
                               .bucketWaitTimeout()),
@@ -78,9 +115,20 @@ void ClientMetadataService::svc() {
       break;
     }
 
-    auto regionFullPath = std::move(m_regionQueue.front());
-    m_regionQueue.pop_front();
-    queue::coalesce(m_regionQueue, regionFullPath);
+    // Refreshes of one region are at least m_metadataRefreshInterval apart,
+    // so the misroutes reported while its buckets move fold into a single
+    // refresh. Regions that are due are served first.
+    std::chrono::steady_clock::time_point due;
+    auto next = m_refreshSchedule.nextDue(m_regionQueue, due);
+    auto now = std::chrono::steady_clock::now();
+    if (due > now) {
+      m_regionQueueCondition.wait_until(lock, due);
+      continue;
+    }
+
+    auto regionFullPath = std::move(*next);
+    m_regionQueue.erase(next);
+    m_refreshSchedule.refreshed(regionFullPath, now);
 
     if (!m_cache->doIfDestroyNotPending([&]() {
           lock.unlock();
@@ -95,6 +143,30 @@ void ClientMetadataService::svc() {
   LOGINFO("ClientMetadataService stopped for pool " + m_pool->getName());
 }
 
+MetadataRefreshSchedule::clock::time_point
+MetadataRefreshSchedule::nextRefreshTime(
+    const std::string& regionFullPath) const {
+  const auto& last = m_lastRefresh.find(regionFullPath);
+  if (last == m_lastRefresh.end()) {
+    return clock::time_point::min();
+  }
+  return last->second + m_interval;
+}
+
+std::deque<std::string>::iterator MetadataRefreshSchedule::nextDue(
+    std::deque<std::string>& queue, clock::time_point& due) const {
+  auto next = queue.begin();
+  due = nextRefreshTime(*next);
+  for (auto entry = next + 1; entry != queue.end(); ++entry) {
+    auto entryDue = nextRefreshTime(*entry);
+    if (entryDue < due) {
+      next = entry;
+      due = entryDue;
+    }
+  }
+  return next;
+}
+
 void ClientMetadataService::getClientPRMetadata(const char* regionFullPath) {
   if (regionFullPath == nullptr) return;
   // That means metadata for the region not found, So only for the first time
@@ -112,6 +184,9 @@ void ClientMetadataService::getClientPRMetadata(const char* regionFullPath) {
       cptr = itr->second;
     }
   }
+  // Metadata fetched for the first time is cached even if no bucket has a
+  // location yet, so later refreshes do not fetch the attributes again.
+  const bool cached = cptr != nullptr;
   std::shared_ptr<ClientMetadata> newCptr = nullptr;
 
   if (cptr == nullptr) {
@@ -151,26 +226,33 @@ void ClientMetadataService::getClientPRMetadata(const char* regionFullPath) {
   if (colocatedWith.empty()) {
     newCptr = SendClientPRMetadata(regionFullPath, cptr);
     // now we will get new instance so assign it again
-    if (newCptr != nullptr) {
-      cptr->setPreviousone(nullptr);
-      newCptr->setPreviousone(cptr);
+    if (newCptr != nullptr && (newCptr != cptr || !cached)) {
+      if (newCptr != cptr) {
+        cptr->setPreviousone(nullptr);
+        newCptr->setPreviousone(cptr);
+      }
       boost::unique_lock<decltype(m_regionMetadataLock)> lock(
           m_regionMetadataLock);
       m_regionMetaDataMap[path] = newCptr;
+      metadataChanged(path);
       LOGINFO("Updated client meta data");
       m_cache->setPrMetadataUpdatedFlag(true);
     }
   } else {
     newCptr = SendClientPRMetadata(colocatedWith.c_str(), cptr);
 
-    if (newCptr) {
-      cptr->setPreviousone(nullptr);
-      newCptr->setPreviousone(cptr);
+    if (newCptr && (newCptr != cptr || !cached)) {
+      if (newCptr != cptr) {
+        cptr->setPreviousone(nullptr);
+        newCptr->setPreviousone(cptr);
+      }
       // now we will get new instance so assign it again
       boost::unique_lock<decltype(m_regionMetadataLock)> lock(
           m_regionMetadataLock);
       m_regionMetaDataMap[colocatedWith.c_str()] = newCptr;
       m_regionMetaDataMap[path] = newCptr;
+      metadataChanged(colocatedWith);
+      metadataChanged(path);
       LOGINFO("Updated client meta data");
       m_cache->setPrMetadataUpdatedFlag(true);
     }
@@ -183,15 +265,14 @@ std::shared_ptr<ClientMetadata> ClientMetadataService::SendClientPRMetadata(
       new DataOutput(m_cache->createDataOutput(m_pool)), regionPath);
   TcrMessageReply reply(true, nullptr);
   // send this message to server and get metadata from server.
-  std::shared_ptr<Region> region = nullptr;
+  std::shared_ptr<LocalRegion> region = nullptr;
   GfErrType err = m_pool->sendSyncRequest(request, reply);
   if (err == GF_NOERR &&
       reply.getMessageType() == TcrMessage::RESPONSE_CLIENT_PR_METADATA) {
-    region = m_cache->getRegion(regionPath);
+    region = std::dynamic_pointer_cast<LocalRegion>(
+        m_cache->getRegion(regionPath));
     if (region != nullptr) {
-      if (auto lregion = std::dynamic_pointer_cast<LocalRegion>(region)) {
-        lregion->getRegionStats()->incMetaDataRefreshCount();
-      }
+      region->getRegionStats()->incMetaDataRefreshCount();
     }
     auto metadata = reply.getMetadata();
     if (metadata == nullptr) {
@@ -201,13 +282,19 @@ std::shared_ptr<ClientMetadata> ClientMetadataService::SendClientPRMetadata(
       delete metadata;
       return nullptr;
     }
-    auto newCptr = std::make_shared<ClientMetadata>(*cptr);
-    for (const auto& v : *metadata) {
-      if (!v.empty()) {
-        newCptr->updateBucketServerLocations(v.at(0)->getBucketId(), v);
-      }
-    }
+    // Only the buckets that moved are updated, so a rebalance that moves a
+    // few buckets does not reshuffle the server order of all the others.
+    int32_t changedBuckets = 0;
+    auto newCptr = cptr->withBucketServerLocations(*metadata, changedBuckets);
     delete metadata;
+    LOGFINE("Client metadata for %s has %d changed buckets", regionPath,
+            changedBuckets);
+    if (changedBuckets == 0) {
+      return cptr;
+    }
+    if (region != nullptr) {
+      region->getRegionStats()->incMetaDataBucketUpdates(changedBuckets);
+    }
     return newCptr;
   }
   return nullptr;
@@ -216,10 +303,39 @@ std::shared_ptr<ClientMetadata> ClientMetadataService::SendClientPRMetadata(
 void ClientMetadataService::removeBucketServerLocation(
     const std::shared_ptr<BucketServerLocation>& serverLocation) {
   boost::unique_lock<decltype(m_regionMetadataLock)> lock(m_regionMetadataLock);
-  for (const auto& regionMetadataIter : m_regionMetaDataMap) {
-    auto clientMetaData = regionMetadataIter.second;
-    clientMetaData->removeBucketServerLocation(serverLocation);
+  // Metadata may be read without the lock, so it is replaced rather than
+  // modified. Colocated regions keep sharing one instance.
+  std::unordered_map<ClientMetadata*, std::shared_ptr<ClientMetadata>>
+      replacements;
+  for (auto& regionMetadataIter : m_regionMetaDataMap) {
+    auto& replacement = replacements[regionMetadataIter.second.get()];
+    if (!replacement) {
+      replacement = regionMetadataIter.second->withoutBucketServerLocation(
+          serverLocation);
+    }
+    regionMetadataIter.second = replacement;
+    metadataChanged(regionMetadataIter.first);
+  }
+}
+
+void ClientMetadataService::removeRegion(const std::string& regionFullPath) {
+  {
+    std::lock_guard<decltype(m_regionQueueMutex)> lock(m_regionQueueMutex);
+    m_regionQueue.erase(
+        std::remove(m_regionQueue.begin(), m_regionQueue.end(), regionFullPath),
+        m_regionQueue.end());
+    m_refreshSchedule.remove(regionFullPath);
+  }
+  {
+    boost::unique_lock<decltype(m_regionMetadataLock)> lock(
+        m_regionMetadataLock);
+    if (m_regionMetaDataMap.erase(regionFullPath) > 0) {
+      metadataChanged(regionFullPath);
+    }
+    m_regionGenerations.erase(regionFullPath);
   }
+  boost::unique_lock<decltype(m_PRbucketStatusLock)> lock(m_PRbucketStatusLock);
+  m_bucketStatus.erase(regionFullPath);
 }
 
 void ClientMetadataService::getBucketServerLocation(
@@ -229,44 +345,32 @@ void ClientMetadataService::getBucketServerLocation(
     const std::shared_ptr<Serializable>& aCallbackArgument, bool isPrimary,
     std::shared_ptr<BucketServerLocation>& serverLocation, int8_t& version) {
   if (region != nullptr) {
-    boost::shared_lock<decltype(m_regionMetadataLock)> lock(
-        m_regionMetadataLock);
-    LOGDEBUG(
-        "ClientMetadataService::getBucketServerLocation m_regionMetaDataMap "
-        "size is %zu",
-        m_regionMetaDataMap.size());
-    std::string path(region->getFullPath());
-    std::shared_ptr<ClientMetadata> cptr = nullptr;
-    const auto& itr = m_regionMetaDataMap.find(path);
-    if (itr != m_regionMetaDataMap.end()) {
-      cptr = itr->second;
-    }
+    auto cptr = getClientMetadata(region);
     if (!cptr) {
       return;
     }
-    std::shared_ptr<CacheableKey> resolvekey;
-    const auto& resolver = region->getAttributes().getPartitionResolver();
 
-    EntryEvent event(region, key, value, nullptr, aCallbackArgument, false);
+    const auto& resolver = region->getAttributes().getPartitionResolver();
     int bucketId = 0;
     if (resolver == nullptr) {
-      resolvekey = key;
+      if (cptr->getTotalNumBuckets() > 0) {
+        bucketId = std::abs(key->hashcode() % cptr->getTotalNumBuckets());
+      }
     } else {
-      resolvekey = resolver->getRoutingObject(event);
+      EntryEvent event(region, key, value, nullptr, aCallbackArgument, false);
+      auto resolvekey = resolver->getRoutingObject(event);
       if (resolvekey == nullptr) {
         throw IllegalStateException(
             "The RoutingObject returned by PartitionResolver is null.");
       }
-    }
-    if (auto&& fpResolver =
-            std::dynamic_pointer_cast<FixedPartitionResolver>(resolver)) {
-      auto&& partition = fpResolver->getPartitionName(event);
-      bucketId = cptr->assignFixedBucketId(partition.c_str(), resolvekey);
-      if (bucketId == -1) {
-        return;
-      }
-    } else {
-      if (cptr->getTotalNumBuckets() > 0) {
+      if (auto&& fpResolver =
+              std::dynamic_pointer_cast<FixedPartitionResolver>(resolver)) {
+        auto&& partition = fpResolver->getPartitionName(event);
+        bucketId = cptr->assignFixedBucketId(partition.c_str(), resolvekey);
+        if (bucketId == -1) {
+          return;
+        }
+      } else if (cptr->getTotalNumBuckets() > 0) {
         bucketId =
             std::abs(resolvekey->hashcode() % cptr->getTotalNumBuckets());
       }
@@ -289,9 +393,57 @@ std::shared_ptr<ClientMetadata> ClientMetadataService::getClientMetadata(
 
 std::shared_ptr<ClientMetadata> ClientMetadataService::getClientMetadata(
     const std::shared_ptr<Region>& region) {
+  if (auto tcrRegion = dynamic_cast<ThinClientRegion*>(region.get())) {
+    return getClientMetadata(*tcrRegion);
+  }
   return getClientMetadata(region->getFullPath());
 }
 
+std::shared_ptr<ClientMetadata> ClientMetadataService::getClientMetadata(
+    ThinClientRegion& region) {
+  static thread_local ClientMetadataSnapshotCache snapshots;
+
+  const auto& generation = region.getMetadataGeneration();
+  std::shared_ptr<ClientMetadata> metadata;
+  if (snapshots.find(generation.get(), generation->load(), metadata)) {
+    return metadata;
+  }
+
+  uint64_t current;
+  if (generation->load() == 0) {
+    // The region's first routed key, start counting its metadata changes.
+    boost::unique_lock<decltype(m_regionMetadataLock)> lock(
+        m_regionMetadataLock);
+    auto& registered = m_regionGenerations[region.getFullPath()];
+    if (registered != generation) {
+      registered = generation;
+      generation->store(ClientMetadataSnapshotCache::newGeneration());
+    }
+    current = generation->load();
+    const auto& entry = m_regionMetaDataMap.find(region.getFullPath());
+    if (entry != m_regionMetaDataMap.end()) {
+      metadata = entry->second;
+    }
+  } else {
+    boost::shared_lock<decltype(m_regionMetadataLock)> lock(
+        m_regionMetadataLock);
+    current = generation->load();
+    const auto& entry = m_regionMetaDataMap.find(region.getFullPath());
+    if (entry != m_regionMetaDataMap.end()) {
+      metadata = entry->second;
+    }
+  }
+  snapshots.store(generation.get(), current, metadata);
+  return metadata;
+}
+
+void ClientMetadataService::metadataChanged(const std::string& regionFullPath) {
+  const auto& entry = m_regionGenerations.find(regionFullPath);
+  if (entry != m_regionGenerations.end()) {
+    entry->second->store(ClientMetadataSnapshotCache::newGeneration());
+  }
+}
+
 void ClientMetadataService::enqueueForMetadataRefresh(
     const std::string& regionFullPath, int8_t serverGroupFlag) {
   auto region = m_cache->getRegion(regionFullPath);
@@ -320,6 +472,10 @@ void ClientMetadataService::enqueueForMetadataRefresh(
       tcrRegion->setMetaDataRefreshed(true);
       {
         std::lock_guard<decltype(m_regionQueueMutex)> lock(m_regionQueueMutex);
+        if (std::find(m_regionQueue.begin(), m_regionQueue.end(),
+                      regionFullPath) != m_regionQueue.end()) {
+          return;
+        }
         m_regionQueue.push_back(regionFullPath);
       }
       m_regionQueueCondition.notify_one();
@@ -20,6 +20,7 @@
 #ifndef GEODE_CLIENTMETADATASERVICE_H_
 #define GEODE_CLIENTMETADATASERVICE_H_
 
+#include <array>
 #include <atomic>
 #include <chrono>
 #include <condition_variable>
@@ -47,10 +48,57 @@ namespace client {
 
 class ClientMetadata;
 class ThinClientPoolDM;
+class ThinClientRegion;
 
 typedef std::map<std::string, std::shared_ptr<ClientMetadata>>
     RegionMetadataMapType;
 
+/**
+ * Counts the changes to one region's ClientMetadata. Shared by the region
+ * and the ClientMetadataService, which stores a new generation each time it
+ * replaces the region's metadata. 0 until the region first routes a key.
+ */
+using ClientMetadataGeneration = std::atomic<uint64_t>;
+
+/**
+ * The ClientMetadata of a few regions, each as of a generation of its
+ * region. Every routing thread keeps one, so routing a key needs neither
+ * m_regionMetadataLock nor a shared_ptr atomic while the region's
+ * generation is unchanged.
+ */
+class ClientMetadataSnapshotCache {
+ public:
+  static constexpr size_t SIZE = 8;
+
+  /**
+   * Sets metadata and returns true if the metadata of the region counted by
+   * region is cached as of generation.
+   */
+  bool find(const ClientMetadataGeneration* region, uint64_t generation,
+            std::shared_ptr<ClientMetadata>& metadata) const;
+
+  /** Caches metadata, replacing the oldest region's if the cache is full. */
+  void store(const ClientMetadataGeneration* region, uint64_t generation,
+             std::shared_ptr<ClientMetadata> metadata);
+
+  /**
+   * Returns a generation that no region in the process has had, so a cached
+   * snapshot of a destroyed region never matches a region created later at
+   * the same address.
+   */
+  static uint64_t newGeneration();
+
+ private:
+  struct Entry {
+    const ClientMetadataGeneration* region = nullptr;
+    uint64_t generation = 0;
+    std::shared_ptr<ClientMetadata> metadata;
+  };
+
+  std::array<Entry, SIZE> m_entries;
+  size_t m_next = 0;
+};
+
 class BucketStatus {
  private:
   using clock = std::chrono::steady_clock;
@@ -98,6 +146,44 @@ class PRbuckets {
   void setBucketTimeout(int32_t bucketId) { m_buckets[bucketId].setTimeout(); }
 };
 
+/**
+ * Spaces the metadata refreshes of each region at least an interval apart.
+ * Not thread safe.
+ */
+class MetadataRefreshSchedule {
+ public:
+  using clock = std::chrono::steady_clock;
+
+  explicit MetadataRefreshSchedule(std::chrono::milliseconds interval)
+      : m_interval(interval) {}
+
+  /**
+   * Earliest time the metadata of regionFullPath may be fetched again.
+   */
+  clock::time_point nextRefreshTime(const std::string& regionFullPath) const;
+
+  /**
+   * Returns the region of a non-empty queue that may be refreshed first and
+   * sets due to the time it may be.
+   */
+  std::deque<std::string>::iterator nextDue(std::deque<std::string>& queue,
+                                            clock::time_point& due) const;
+
+  void refreshed(const std::string& regionFullPath, clock::time_point time) {
+    m_lastRefresh[regionFullPath] = time;
+  }
+
+  void remove(const std::string& regionFullPath) {
+    m_lastRefresh.erase(regionFullPath);
+  }
+
+  size_t size() const { return m_lastRefresh.size(); }
+
+ private:
+  std::chrono::milliseconds m_interval;
+  std::unordered_map<std::string, clock::time_point> m_lastRefresh;
+};
+
 class ClientMetadataService {
  public:
   ClientMetadataService(const ClientMetadataService&) = delete;
@@ -188,6 +274,11 @@ class ClientMetadataService {
   void removeBucketServerLocation(
       const std::shared_ptr<BucketServerLocation>& serverLocation);
 
+  /**
+   * Drops everything kept for a region that is destroyed or closed.
+   */
+  void removeRegion(const std::string& regionFullPath);
+
  private:
   std::shared_ptr<ClientMetadata> SendClientPRMetadata(
       const char* regionPath, std::shared_ptr<ClientMetadata> cptr);
@@ -195,16 +286,34 @@ class ClientMetadataService {
   std::shared_ptr<ClientMetadata> getClientMetadata(
       const std::shared_ptr<Region>& region);
 
+  /**
+   * Returns the region's metadata from the calling thread's
+   * ClientMetadataSnapshotCache, looking it up in m_regionMetaDataMap only if
+   * the region's generation changed since it was cached.
+   */
+  std::shared_ptr<ClientMetadata> getClientMetadata(ThinClientRegion& region);
+
+  /** Called with m_regionMetadataLock held exclusively. */
+  void metadataChanged(const std::string& regionFullPath);
+
  private:
   std::thread m_thread;
   boost::shared_mutex m_regionMetadataLock;
   RegionMetadataMapType m_regionMetaDataMap;
+  // Generations of the regions that routed a key, by region path. Guarded by
+  // m_regionMetadataLock. A region's generation is renewed whenever its entry
+  // in m_regionMetaDataMap changes. Published ClientMetadata instances are
+  // never modified.
+  std::map<std::string, std::shared_ptr<ClientMetadataGeneration>>
+      m_regionGenerations;
   std::atomic<bool> m_run;
   ThinClientPoolDM* m_pool;
   CacheImpl* m_cache;
   std::deque<std::string> m_regionQueue;
   std::mutex m_regionQueueMutex;
   std::condition_variable m_regionQueueCondition;
+  // Guarded by m_regionQueueMutex.
+  MetadataRefreshSchedule m_refreshSchedule;
   boost::shared_mutex m_PRbucketStatusLock;
   std::map<std::string, std::unique_ptr<PRbuckets>> m_bucketStatus;
   std::chrono::milliseconds m_bucketWaitTimeout;
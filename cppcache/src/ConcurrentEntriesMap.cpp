@@ -21,6 +21,7 @@
 
 #include "RegionInternal.hpp"
 #include "TableOfPrimes.hpp"
+#include "ValueCompressor.hpp"
 
 namespace apache {
 namespace geode {
@@ -46,6 +47,12 @@ ConcurrentEntriesMap::ConcurrentEntriesMap(
   } else {
     m_concurrency = TableOfPrimes::nextLargerPrimeForConcurrency(concurrency);
   }
+  if (region != nullptr) {
+    if (auto compressor = region->getAttributes().getCompressor()) {
+      m_valueCompressor = std::unique_ptr<ValueCompressor>(
+          new ValueCompressor(region, std::move(compressor)));
+    }
+  }
 }
 
 void ConcurrentEntriesMap::open(uint32_t initialCapacity) {
@@ -70,8 +77,29 @@ void ConcurrentEntriesMap::clear() {
   m_size = 0;
 }
 
+void ConcurrentEntriesMap::reserve(uint32_t size) {
+  if (size == 0) {
+    return;
+  }
+  uint32_t segSize = 1 + (size - 1) / m_concurrency;
+  for (uint32_t index = 0; index < m_concurrency; index++) {
+    m_segments[index].reserve(segSize);
+  }
+}
+
 ConcurrentEntriesMap::~ConcurrentEntriesMap() noexcept { delete[] m_segments; }
 
+std::shared_ptr<Cacheable> ConcurrentEntriesMap::toStored(
+    const std::shared_ptr<Cacheable>& value) const {
+  return m_valueCompressor ? m_valueCompressor->compress(value) : value;
+}
+
+void ConcurrentEntriesMap::fromStored(std::shared_ptr<Cacheable>& value) const {
+  if (m_valueCompressor) {
+    value = m_valueCompressor->decompress(value);
+  }
+}
+
 GfErrType ConcurrentEntriesMap::create(
     const std::shared_ptr<CacheableKey>& key,
     const std::shared_ptr<Cacheable>& newValue,
@@ -79,8 +107,9 @@ GfErrType ConcurrentEntriesMap::create(
     int updateCount, int destroyTracker,
     std::shared_ptr<VersionTag> versionTag) {
   GfErrType err = GF_NOERR;
-  if ((err = segmentFor(key)->create(key, newValue, me, oldValue, updateCount,
-                                     destroyTracker, versionTag)) == GF_NOERR &&
+  if ((err = segmentFor(key)->create(key, toStored(newValue), me, oldValue,
+                                     updateCount, destroyTracker,
+                                     versionTag)) == GF_NOERR &&
       oldValue == nullptr) {
     ++m_size;
   }
@@ -107,10 +136,14 @@ GfErrType ConcurrentEntriesMap::put(const std::shared_ptr<CacheableKey>& key,
                                     int updateCount, int destroyTracker,
                                     std::shared_ptr<VersionTag> versionTag,
                                     bool& isUpdate, DataInput* delta) {
+  // Deltas apply to the deserialized value, fetch the full value instead.
+  if (m_valueCompressor && delta != nullptr) {
+    return GF_INVALID_DELTA;
+  }
   GfErrType err = GF_NOERR;
-  if ((err = segmentFor(key)->put(key, newValue, me, oldValue, updateCount,
-                                  destroyTracker, isUpdate, versionTag,
-                                  delta)) != GF_NOERR) {
+  if ((err = segmentFor(key)->put(key, toStored(newValue), me, oldValue,
+                                  updateCount, destroyTracker, isUpdate,
+                                  versionTag, delta)) != GF_NOERR) {
     return err;
   }
   if (!isUpdate) {
@@ -122,12 +155,22 @@ GfErrType ConcurrentEntriesMap::put(const std::shared_ptr<CacheableKey>& key,
 bool ConcurrentEntriesMap::get(const std::shared_ptr<CacheableKey>& key,
                                std::shared_ptr<Cacheable>& value,
                                std::shared_ptr<MapEntryImpl>& me) {
-  return segmentFor(key)->getEntry(key, me, value);
+  auto found = segmentFor(key)->getEntry(key, me, value);
+  fromStored(value);
+  return found;
 }
 
 void ConcurrentEntriesMap::getEntry(const std::shared_ptr<CacheableKey>& key,
                                     std::shared_ptr<MapEntryImpl>& result,
                                     std::shared_ptr<Cacheable>& value) const {
+  getStoredEntry(key, result, value);
+  fromStored(value);
+}
+
+void ConcurrentEntriesMap::getStoredEntry(
+    const std::shared_ptr<CacheableKey>& key,
+    std::shared_ptr<MapEntryImpl>& result,
+    std::shared_ptr<Cacheable>& value) const {
   segmentFor(key)->getEntry(key, result, value);
 }
 
@@ -163,18 +206,32 @@ void ConcurrentEntriesMap::getKeys(
 
 void ConcurrentEntriesMap::getEntries(
     std::vector<std::shared_ptr<RegionEntry>>& result) const {
-  result.reserve(this->size());
+  auto first = result.size();
+  result.reserve(first + this->size());
   for (int index = 0; index < m_concurrency; ++index) {
     m_segments[index].getEntries(result);
   }
+  if (m_valueCompressor) {
+    for (auto i = first; i < result.size(); ++i) {
+      auto value = result[i]->getValue();
+      fromStored(value);
+      result[i] = m_region->createRegionEntry(result[i]->getKey(), value);
+    }
+  }
 }
 
 void ConcurrentEntriesMap::getValues(
     std::vector<std::shared_ptr<Cacheable>>& result) const {
-  result.reserve(this->size());
+  auto first = result.size();
+  result.reserve(first + this->size());
   for (int index = 0; index < m_concurrency; ++index) {
     m_segments[index].getValues(result);
   }
+  if (m_valueCompressor) {
+    for (auto i = first; i < result.size(); ++i) {
+      fromStored(result[i]);
+    }
+  }
 }
 
 bool ConcurrentEntriesMap::empty() const { return m_size == 0; }
@@ -21,6 +21,7 @@
 #define GEODE_CONCURRENTENTRIESMAP_H_
 
 #include <atomic>
+#include <memory>
 
 #include <geode/RegionEntry.hpp>
 #include <geode/internal/geode_globals.hpp>
@@ -34,6 +35,7 @@ namespace geode {
 namespace client {
 
 class RegionInternal;
+class ValueCompressor;
 
 /**
  * @brief Concurrent entries map.
@@ -47,6 +49,14 @@ class ConcurrentEntriesMap : public EntriesMap {
   RegionInternal* m_region;
   std::atomic<int32_t> m_numDestroyTrackers;
   bool m_concurrencyChecksEnabled;
+  std::unique_ptr<ValueCompressor> m_valueCompressor;
+
+  /**
+   * Return value in the form stored by the segments, compressed when the
+   * region has a Compressor.
+   */
+  std::shared_ptr<Cacheable> toStored(
+      const std::shared_ptr<Cacheable>& value) const;
 
   /**
    * Return a reference to the segment for which the given key would
@@ -89,6 +99,8 @@ class ConcurrentEntriesMap : public EntriesMap {
 
   void clear() override;
 
+  void reserve(uint32_t size) override;
+
   GfErrType put(const std::shared_ptr<CacheableKey>& key,
                 const std::shared_ptr<Cacheable>& newValue,
                 std::shared_ptr<MapEntryImpl>& me,
@@ -118,6 +130,12 @@ class ConcurrentEntriesMap : public EntriesMap {
                 std::shared_ptr<MapEntryImpl>& result,
                 std::shared_ptr<Cacheable>& value) const override;
 
+  void getStoredEntry(const std::shared_ptr<CacheableKey>& key,
+                      std::shared_ptr<MapEntryImpl>& result,
+                      std::shared_ptr<Cacheable>& value) const override;
+
+  void fromStored(std::shared_ptr<Cacheable>& value) const override;
+
   /**
    * @brief remove the entry for key from the map.
    */
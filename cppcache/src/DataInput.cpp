@@ -21,6 +21,7 @@
 #include "CacheImpl.hpp"
 #include "CacheRegionHelper.hpp"
 #include "SerializationRegistry.hpp"
+#include "util/BigEndian.hpp"
 #include "util/JavaModifiedUtf8.hpp"
 #include "util/string.hpp"
 
@@ -49,10 +50,11 @@ Cache* DataInput::getCache() const { return m_cache->getCache(); }
 template <class _Traits, class _Allocator>
 void DataInput::readJavaModifiedUtf8(
     std::basic_string<char, _Traits, _Allocator>& value) {
-  // TODO string OPTIMIZE skip intermediate utf16 string
-  std::u16string utf16;
-  readJavaModifiedUtf8(utf16);
-  value = to_utf8(utf16);
+  uint16_t length = readInt16();
+  _GEODE_CHECK_BUFFER_SIZE(length);
+  value = internal::JavaModifiedUtf8::toUtf8(
+      reinterpret_cast<const char*>(m_buf), length);
+  advanceCursor(length);
 }
 template APACHE_GEODE_EXPLICIT_TEMPLATE_EXPORT void
 DataInput::readJavaModifiedUtf8(std::string&);
@@ -80,6 +82,11 @@ void DataInput::readJavaModifiedUtf8(
 template APACHE_GEODE_EXPLICIT_TEMPLATE_EXPORT void
 DataInput::readJavaModifiedUtf8(std::u32string&);
 
+void DataInput::decodeBigEndian(const uint8_t* in, size_t count, size_t size,
+                                void* values) {
+  internal::BigEndian::read(in, count, size, values);
+}
+
 template <class _Traits, class _Allocator>
 void DataInput::readUtf16Huge(
     std::basic_string<char, _Traits, _Allocator>& value) {
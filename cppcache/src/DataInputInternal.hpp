@@ -37,6 +37,15 @@ class DataInputInternal : public DataInput {
   inline static Pool* getPool(const DataInput& dataInput) {
     return dataInput.getPool();
   }
+
+  /**
+   * Lets dataInput hand out views of buffer, the allocation it reads from,
+   * instead of copies, see DataInput::readBytesShared.
+   */
+  inline static void setBufferOwner(DataInput& dataInput,
+                                    std::shared_ptr<const uint8_t> buffer) {
+    dataInput.m_bufferOwner = std::move(buffer);
+  }
 };
 
 }  // namespace client
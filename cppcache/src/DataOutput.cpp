@@ -22,6 +22,7 @@
 #include "CacheImpl.hpp"
 #include "CacheRegionHelper.hpp"
 #include "SerializationRegistry.hpp"
+#include "util/BigEndian.hpp"
 #include "util/JavaModifiedUtf8.hpp"
 #include "util/Log.hpp"
 #include "util/string.hpp"
@@ -139,15 +140,42 @@ Cache* DataOutput::getCache() const { return m_cache->getCache(); }
 template <class _Traits, class _Allocator>
 void DataOutput::writeJavaModifiedUtf8(
     const std::basic_string<char, _Traits, _Allocator>& value) {
-  /*
-   * OPTIMIZE convert from UTF-8 to CESU-8/Java Modified UTF-8 directly
-   * http://www.unicode.org/reports/tr26/
-   */
+  // Converts from UTF-8 to CESU-8/Java Modified UTF-8 directly, see
+  // http://www.unicode.org/reports/tr26/
+  constexpr size_t maxLength = (std::numeric_limits<uint16_t>::max)();
   if (value.empty()) {
     writeInt(static_cast<uint16_t>(0));
+    return;
+  }
+
+  auto data = value.data();
+  auto len = value.length();
+  size_t encodedLen;
+  if (len * 2 <= maxLength) {
+    // No UTF-8 sequence more than doubles in length, encode in a single pass.
+    ensureCapacity(2 + len * 2);
+    encodedLen =
+        internal::JavaModifiedUtf8::encode(data, len, m_buf + 2, len * 2);
+    if (encodedLen != std::string::npos) {
+      writeNoCheck(static_cast<uint8_t>(encodedLen >> 8));
+      writeNoCheck(static_cast<uint8_t>(encodedLen));
+      m_buf += encodedLen;
+      return;
+    }
   } else {
-    writeJavaModifiedUtf8(to_utf16(value));
+    encodedLen = internal::JavaModifiedUtf8::encode(data, len, nullptr, 0);
+    if (encodedLen != std::string::npos) {
+      encodedLen = (std::min)(encodedLen, maxLength);
+      writeInt(static_cast<uint16_t>(encodedLen));
+      ensureCapacity(encodedLen);
+      internal::JavaModifiedUtf8::encode(data, len, m_buf, encodedLen);
+      m_buf += encodedLen;
+      return;
+    }
   }
+
+  // Not well formed UTF-8, leave it to the converter.
+  writeJavaModifiedUtf8(to_utf16(value));
 }
 template APACHE_GEODE_EXPLICIT_TEMPLATE_EXPORT void
 DataOutput::writeJavaModifiedUtf8(const std::string&);
@@ -182,6 +210,16 @@ size_t DataOutput::getJavaModifiedUtf8EncodedLength(const char16_t* data,
   return internal::JavaModifiedUtf8::encodedLength(data, length);
 }
 
+size_t DataOutput::encodeJavaModifiedUtf8(const char16_t* data, size_t length,
+                                          uint8_t* out, size_t limit) {
+  return internal::JavaModifiedUtf8::encode(data, length, out, limit);
+}
+
+void DataOutput::encodeBigEndian(const void* values, size_t count,
+                                 size_t size, uint8_t* out) {
+  internal::BigEndian::write(values, count, size, out);
+}
+
 template <class _Traits, class _Allocator>
 void DataOutput::writeUtf16Huge(
     const std::basic_string<char, _Traits, _Allocator>& value) {
@@ -39,6 +39,7 @@ std::shared_ptr<CacheableVector> DefaultResultCollector::getResult(
 
 void DefaultResultCollector::addResult(
     const std::shared_ptr<Cacheable>& result) {
+  std::lock_guard<std::mutex> lk(readyMutex);
   resultList->push_back(result);
 }
 
@@ -50,7 +51,10 @@ void DefaultResultCollector::endResults() {
   readyCondition.notify_all();
 }
 
-void DefaultResultCollector::clearResults() { resultList->clear(); }
+void DefaultResultCollector::clearResults() {
+  std::lock_guard<std::mutex> lk(readyMutex);
+  resultList->clear();
+}
 
 }  // namespace client
 }  // namespace geode
@@ -90,9 +90,31 @@ class EntriesMap {
   virtual void getEntry(const std::shared_ptr<CacheableKey>& key,
                         std::shared_ptr<MapEntryImpl>& result,
                         std::shared_ptr<Cacheable>& value) const = 0;
+  /**
+   * @brief get MapEntry for key with its value in the form kept by the map,
+   * for callers that pass the value to fromStored only if they use it.
+   */
+  virtual void getStoredEntry(const std::shared_ptr<CacheableKey>& key,
+                              std::shared_ptr<MapEntryImpl>& result,
+                              std::shared_ptr<Cacheable>& value) const = 0;
+  /**
+   * @brief replace a value in the form kept by the map with the region's
+   * value. The old values returned by put, create, invalidate, remove and
+   * addTrackerForEntry are in the kept form, so that a compressed value is
+   * only decompressed when an event or a caller needs it. Values already in
+   * the region's form are left as is.
+   */
+  virtual void fromStored(std::shared_ptr<Cacheable>& value) const = 0;
+
   /** @brief remove all entries in the map. */
   virtual void clear() = 0;
 
+  /**
+   * @brief grow the map to hold size entries without rehashing, ahead of a
+   * bulk load. Never shrinks the map.
+   */
+  virtual void reserve(uint32_t size) = 0;
+
   /**
    * @brief remove the entry for key from the map;
    *   returns false and nullptr MapEntry if absent
@@ -17,7 +17,9 @@
 
 #include "EvictionController.hpp"
 
+#include <algorithm>
 #include <chrono>
+#include <vector>
 
 #include <boost/thread/lock_types.hpp>
 
@@ -30,6 +32,17 @@
 namespace {
 const char* const NC_EC_Thread = "NC EC Thread";
 const std::chrono::seconds EVICTION_TIMEOUT{1};
+const size_t MAX_SLOTS = 64;
+const int64_t MIN_FLUSH_SIZE = 512;
+// Largest fraction of the entries evicted in one round, so that region locks
+// are not held for long and usage is checked again between rounds.
+const float MAX_EVICTION_SLICE = 0.05f;
+
+size_t threadSlot() {
+  static std::atomic<size_t> next{0};
+  static thread_local const size_t slot = next++;
+  return slot;
+}
 }  // namespace
 
 namespace apache {
@@ -43,7 +56,26 @@ EvictionController::EvictionController(int64_t max_heap_size,
       running_{false},
       max_heap_size_{max_heap_size << 20ULL},
       heap_size_delta_{heap_size_delta / 100.0f},
-      heap_size_{0} {
+      heap_size_{0},
+      signaled_{false} {
+  auto delta = static_cast<int64_t>(max_heap_size_ * heap_size_delta_);
+  low_water_mark_ = max_heap_size_ - delta;
+  high_water_mark_ = max_heap_size_ - delta / 2;
+
+  size_t slots = 1;
+  auto threads = static_cast<size_t>(std::thread::hardware_concurrency());
+  while (slots < 2 * threads && slots < MAX_SLOTS) {
+    slots <<= 1;
+  }
+  slots_ = std::unique_ptr<Slot[]>(new Slot[slots]);
+  for (size_t i = 0; i < slots; ++i) {
+    slots_[i].pending = 0;
+  }
+  slot_mask_ = slots - 1;
+  // Bounds the changes not yet added up to about 0.1% of the limit.
+  flush_size_ = std::max(
+      MIN_FLUSH_SIZE, max_heap_size_ / static_cast<int64_t>(1024 * slots));
+
   LOGINFO("Maximum heap size for Heap LRU set to %ld bytes", max_heap_size_);
 }
 
@@ -56,6 +88,9 @@ void EvictionController::start() {
 
 void EvictionController::stop() {
   running_ = false;
+  {
+    std::lock_guard<std::mutex> guard(mutex_);
+  }
   cv_.notify_one();
   thread_.join();
 
@@ -64,49 +99,89 @@ void EvictionController::stop() {
 }
 
 void EvictionController::svc() {
-  std::mutex mutex;
   DistributedSystemImpl::setThreadName(NC_EC_Thread);
 
   while (running_) {
     {
-      std::unique_lock<std::mutex> lock(mutex);
-      cv_.wait(lock,
-               [this] { return !running_ || heap_size_ > max_heap_size_; });
+      std::unique_lock<std::mutex> lock(mutex_);
+      // The timeout also picks up changes too small to have been added up.
+      cv_.wait_for(lock, EVICTION_TIMEOUT,
+                   [this] { return !running_ || signaled_; });
     }
+    signaled_ = false;
 
-    checkHeapSize();
+    if (running_) {
+      checkHeapSize();
+    }
   }
 }
 
 void EvictionController::incrementHeapSize(int64_t delta) {
-  heap_size_ += delta;
-  cv_.notify_one();
+  auto& slot = slots_[threadSlot() & slot_mask_];
+  auto pending =
+      slot.pending.fetch_add(delta, std::memory_order_relaxed) + delta;
+  if (pending < flush_size_ && pending > -flush_size_) {
+    return;
+  }
 
-  // We could block here if we wanted to prevent any further memory use
-  // until the evictions had been completed.
+  pending = slot.pending.exchange(0, std::memory_order_relaxed);
+  auto heap_size = heap_size_.fetch_add(pending) + pending;
+  if (heap_size > high_water_mark_ && !signaled_.exchange(true)) {
+    // Taking the mutex ensures the eviction thread is either waiting or has
+    // yet to check signaled_, so the notification cannot be lost.
+    {
+      std::lock_guard<std::mutex> guard(mutex_);
+    }
+    cv_.notify_one();
+  }
 }
 
-void EvictionController::checkHeapSize() {
+int64_t EvictionController::getHeapSize() const {
   int64_t heap_size = heap_size_;
-  if (heap_size <= max_heap_size_) {
+  for (size_t i = 0; i <= slot_mask_; ++i) {
+    heap_size += slots_[i].pending.load(std::memory_order_relaxed);
+  }
+  return heap_size;
+}
+
+int64_t EvictionController::collectHeapSize() {
+  for (size_t i = 0; i <= slot_mask_; ++i) {
+    heap_size_ += slots_[i].pending.exchange(0, std::memory_order_relaxed);
+  }
+  return heap_size_;
+}
+
+void EvictionController::checkHeapSize() {
+  auto heap_size = collectHeapSize();
+  if (heap_size <= high_water_mark_) {
     return;
   }
 
-  float percentage =
-      static_cast<float>(heap_size - max_heap_size_) / max_heap_size_ +
-      heap_size_delta_;
+  while (running_ && heap_size > low_water_mark_) {
+    float percentage = std::min(
+        MAX_EVICTION_SLICE,
+        static_cast<float>(heap_size - low_water_mark_) / heap_size);
 
-  LOGFINE(
-      "EvictionController::process_delta: evicting %.03f%% of the entries. "
-      "Heap size is: %lld / %lld",
-      percentage * 100.0f, heap_size, max_heap_size_);
+    LOGFINE(
+        "EvictionController::checkHeapSize: evicting %.03f%% of the entries. "
+        "Heap size is: %lld / %lld",
+        percentage * 100.0f, heap_size, max_heap_size_);
 
-  evict(percentage);
+    evict(percentage);
+
+    auto previous = heap_size;
+    heap_size = collectHeapSize();
+    if (heap_size >= previous) {
+      // Nothing left to evict or puts are outpacing eviction, wait for the
+      // next signal.
+      break;
+    }
+  }
 }
 
 void EvictionController::registerRegion(const std::string& name) {
   boost::unique_lock<decltype(regions_mutex_)> lock(regions_mutex_);
-  if (regions_.insert(name).second) {
+  if (regions_.emplace(name, std::weak_ptr<RegionInternal>()).second) {
     LOGFINE("Registered region with Heap LRU eviction controller: name is " +
             name);
   }
@@ -121,28 +196,39 @@ void EvictionController::unregisterRegion(const std::string& name) {
 }
 
 void EvictionController::evict(float percentage) {
-  // TODO:  Shouldn't we take the CacheImpl::m_regions
-  // lock here? Otherwise we might invoke eviction on a region
-  // that has been destroyed or is being destroyed.
-  // Its important to not hold this lock for too long
-  // because it prevents new regions from getting created or destroyed
-  // On the flip side, this requires a copy of the registered region list
-  // every time eviction is ordered and that might not be cheap
-  //@TODO: Discuss with team
-
-  std::vector<std::string> regions;
+  std::vector<std::shared_ptr<RegionInternal>> regions;
+  std::vector<std::string> unresolved;
   {
     boost::shared_lock<decltype(regions_mutex_)> lock(regions_mutex_);
     regions.reserve(regions_.size());
-    regions.insert(regions.end(), regions_.begin(), regions_.end());
+    for (const auto& entry : regions_) {
+      if (auto region = entry.second.lock()) {
+        regions.push_back(std::move(region));
+      } else {
+        unresolved.push_back(entry.first);
+      }
+    }
   }
 
-  for (const auto& regionName : regions) {
+  // Regions register while they are being created, so their handle is looked
+  // up by name the first time they are evicted.
+  for (const auto& regionName : unresolved) {
     if (auto region = std::dynamic_pointer_cast<RegionInternal>(
             cache_->getRegion(regionName))) {
-      region->evict(percentage);
+      {
+        boost::unique_lock<decltype(regions_mutex_)> lock(regions_mutex_);
+        auto found = regions_.find(regionName);
+        if (found != regions_.end()) {
+          found->second = region;
+        }
+      }
+      regions.push_back(std::move(region));
     }
   }
+
+  for (const auto& region : regions) {
+    region->evict(percentage);
+  }
 }
 
 }  // namespace client
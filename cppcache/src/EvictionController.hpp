@@ -22,10 +22,11 @@
 
 #include <atomic>
 #include <condition_variable>
+#include <memory>
 #include <mutex>
-#include <set>
 #include <string>
 #include <thread>
+#include <unordered_map>
 
 #include <boost/thread/shared_mutex.hpp>
 
@@ -34,31 +35,26 @@ namespace geode {
 namespace client {
 
 class CacheImpl;
+class RegionInternal;
 
 /**
  * This class ensures that the cache consumes only as much memory as
  * specified by the heap-lru-limit. Every region that is created in the
- * system registers with the EvictionController. Everytime there is any
- * activity that changes the memory usage in the region, it puts a message
- * into a queue that the EvictionController waits on. The message contains
- * the full region name, the total size of the region (inclusive of keys and
- * values) and the total number of entries.The EvictionController thread picks
- * up the message, updates the total memory size as well as the size of the
- * region in question. It determines whether memory usage is within limits.
- * If so, it goes back to waiting on the queue. If memory usage is out of bounds
- * it does the following.
- *  1> Figures out the delta between specified and actual
- *  2> Determines the size percentage that needs to be evicted
- *  3> Determines the nmber of entries per region (based on size per entry) that
-       needs to be evicted. This is a slice of the total eviction that is
- needed.
-    4> Invokes a method on each region to trigger eviction of entries.The evict
-       method on the region will return the total size evicted for the entries.
-    5> Goes back and checks queue size and recalculates the heap size usage
+ * system registers with the EvictionController. Every time an entry of the
+ * region is created, updated, evicted or removed, the region reports the
+ * change in its heap size.
  *
+ * Changes are accumulated in a slot picked by the calling thread, so that
+ * threads putting concurrently do not contend on one counter, and are added
+ * to the total once they exceed a small fraction of the limit. The eviction
+ * thread is only woken when the total crosses the high water mark, halfway
+ * between the limit and the low water mark heap-lru-delta percent below it.
+ * It then evicts the same fraction of the entries of every region, a slice at
+ * a time, until usage is back under the low water mark. Evicting ahead of the
+ * limit leaves room for the puts that arrive while eviction is running.
  *
- * When a region is destroyed, it deregisters itself with the EvictionController
- * Format of object that is put into the region map (int size, int numEntries)
+ * When a region is destroyed, it deregisters itself with the
+ * EvictionController.
  */
 class EvictionController {
  public:
@@ -78,8 +74,18 @@ class EvictionController {
   void registerRegion(const std::string& name);
   void unregisterRegion(const std::string& name);
 
+  /** Heap size of all regions, including changes not yet added up. */
+  int64_t getHeapSize() const;
+
  private:
+  // Padded so that each slot has its own cache line.
+  struct Slot {
+    std::atomic<int64_t> pending;
+    char padding[64 - sizeof(std::atomic<int64_t>)];
+  };
+
   void checkHeapSize();
+  int64_t collectHeapSize();
 
  private:
   CacheImpl* cache_;
@@ -89,10 +95,20 @@ class EvictionController {
 
   int64_t max_heap_size_;
   float heap_size_delta_;
+  int64_t high_water_mark_;
+  int64_t low_water_mark_;
   std::atomic<int64_t> heap_size_;
+
+  std::unique_ptr<Slot[]> slots_;
+  size_t slot_mask_;
+  int64_t flush_size_;
+
+  std::mutex mutex_;
   std::condition_variable cv_;
+  std::atomic<bool> signaled_;
 
-  std::set<std::string> regions_;
+  // Regions are resolved by name once, then evicted through their handle.
+  std::unordered_map<std::string, std::weak_ptr<RegionInternal>> regions_;
   boost::shared_mutex regions_mutex_;
 };
 
@@ -21,6 +21,7 @@
 
 #include <geode/DefaultResultCollector.hpp>
 #include <geode/ExceptionTypes.hpp>
+#include <geode/StreamingResultCollector.hpp>
 #include <geode/internal/geode_globals.hpp>
 
 #include "CacheImpl.hpp"
@@ -96,7 +97,25 @@ std::shared_ptr<ResultCollector> ExecutionImpl::execute(
 
 std::shared_ptr<ResultCollector> ExecutionImpl::execute(
     const std::string& func, std::chrono::milliseconds timeout) {
+  try {
+    return executeFunction(func, timeout);
+  } catch (...) {
+    // A consumer streaming the results on another thread would otherwise
+    // wait for results that never arrive.
+    if (auto streaming =
+            std::dynamic_pointer_cast<StreamingResultCollector>(m_rc)) {
+      streaming->setException(std::current_exception());
+    }
+    throw;
+  }
+}
+
+std::shared_ptr<ResultCollector> ExecutionImpl::executeFunction(
+    const std::string& func, std::chrono::milliseconds timeout) {
   LOGDEBUG("ExecutionImpl::execute: ");
+  auto poolDM = std::dynamic_pointer_cast<ThinClientPoolDM>(m_pool);
+  statistics::ScopedLatencyRecorder latencyRecorder(
+      poolDM ? poolDM->getStats().getFunctionExecutionLatency() : nullptr);
   GuardUserAttributes gua;
   if (m_authenticatedView != nullptr) {
     LOGDEBUG("ExecutionImpl::execute function on authenticated cache");
@@ -111,6 +111,9 @@ class ExecutionImpl {
   static FunctionToFunctionAttributes m_func_attrs;
   //  std::vector<int8_t> m_attributes;
 
+  std::shared_ptr<ResultCollector> executeFunction(
+      const std::string& func, std::chrono::milliseconds timeout);
+
   std::shared_ptr<CacheableVector> executeOnPool(
       const std::string& func, uint8_t getResult, int32_t retryAttempts,
       std::chrono::milliseconds timeout = DEFAULT_QUERY_RESPONSE_TIMEOUT);
@@ -0,0 +1,155 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "InitialImageLoader.hpp"
+
+#include <algorithm>
+
+#include <geode/SystemProperties.hpp>
+
+#include "CacheImpl.hpp"
+#include "EntriesMap.hpp"
+#include "RegionStats.hpp"
+#include "TableOfPrimes.hpp"
+#include "ThinClientRegion.hpp"
+#include "ThreadPool.hpp"
+#include "Utils.hpp"
+#include "VersionTag.hpp"
+#include "util/Log.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+class InitialImageLoader::LoadWork : public Callable {
+ public:
+  LoadWork(InitialImageLoader& loader, std::vector<Entry> batch)
+      : loader_(loader), batch_(std::move(batch)) {}
+
+  void call() override {
+    auto start = std::chrono::steady_clock::now();
+    try {
+      loader_.load(batch_);
+    } catch (const std::exception& e) {
+      LOGERROR("InitialImageLoader: failed to add initial values: %s",
+               e.what());
+    } catch (...) {
+      LOGERROR("InitialImageLoader: failed to add initial values");
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    std::lock_guard<decltype(loader_.mutex_)> guard(loader_.mutex_);
+    loader_.loadTime_ += elapsed;
+    loader_.pending_--;
+    loader_.loaded_.notify_all();
+  }
+
+ private:
+  InitialImageLoader& loader_;
+  std::vector<Entry> batch_;
+};
+
+InitialImageLoader::InitialImageLoader(ThinClientRegion& region,
+                                       int32_t destroyTracker)
+    : region_(region),
+      destroyTracker_(destroyTracker),
+      segments_(TableOfPrimes::nextLargerPrimeForConcurrency(
+          std::min(region.getAttributes().getConcurrencyLevel(),
+                   TableOfPrimes::getMaxPrimeForConcurrency()))),
+      pending_(0),
+      loadTime_(std::chrono::steady_clock::duration::zero()) {
+  auto threads = std::min<size_t>(region.getCacheImpl()
+                                      ->getDistributedSystem()
+                                      .getSystemProperties()
+                                      .threadPoolSize(),
+                                  segments_);
+  batches_.resize(std::max<size_t>(threads, 1));
+  maxPending_ = 2 * batches_.size();
+}
+
+InitialImageLoader::~InitialImageLoader() noexcept {
+  try {
+    wait();
+  } catch (...) {
+  }
+}
+
+void InitialImageLoader::reserve(size_t count) {
+  if (auto entries = region_.getEntryMap()) {
+    entries->reserve(static_cast<uint32_t>(
+        std::min<size_t>(entries->size() + count, UINT32_MAX)));
+  }
+}
+
+void InitialImageLoader::add(const std::shared_ptr<CacheableKey>& key,
+                             const std::shared_ptr<Cacheable>& value,
+                             const std::shared_ptr<VersionTag>& versionTag) {
+  // Same segment count and selection as ConcurrentEntriesMap, so that no two
+  // loader threads contend for a segment.
+  auto segment = static_cast<uint32_t>(key->hashcode()) % segments_;
+  batches_[segment % batches_.size()].push_back({key, value, versionTag});
+}
+
+void InitialImageLoader::flush() {
+  auto& threadPool = region_.getCacheImpl()->getThreadPool();
+  for (auto& batch : batches_) {
+    if (batch.empty()) {
+      continue;
+    }
+    {
+      std::unique_lock<decltype(mutex_)> lock(mutex_);
+      loaded_.wait(lock, [this] { return pending_ < maxPending_; });
+      pending_++;
+    }
+    threadPool.perform(std::make_shared<LoadWork>(*this, std::move(batch)));
+    batch = std::vector<Entry>();
+  }
+}
+
+void InitialImageLoader::wait() {
+  flush();
+
+  std::unique_lock<decltype(mutex_)> lock(mutex_);
+  loaded_.wait(lock, [this] { return pending_ == 0; });
+  if (loadTime_ > std::chrono::steady_clock::duration::zero()) {
+    region_.getRegionStats()->incInterestInitialLoadTime(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(loadTime_)
+            .count());
+    loadTime_ = std::chrono::steady_clock::duration::zero();
+  }
+}
+
+void InitialImageLoader::load(const std::vector<Entry>& batch) {
+  for (const auto& entry : batch) {
+    std::shared_ptr<Cacheable> oldValue;
+    auto err = region_.putLocal("registerInterest", false, entry.key,
+                                entry.value, oldValue, true, -1,
+                                destroyTracker_, entry.versionTag);
+    if (err == GF_CACHE_CONCURRENT_MODIFICATION_EXCEPTION) {
+      LOGDEBUG(
+          "InitialImageLoader: key [%s] not added because the cache already "
+          "contains an entry with a higher version.",
+          Utils::nullSafeToString(entry.key).c_str());
+    }
+  }
+  region_.getRegionStats()->incInterestInitialEntries(
+      static_cast<int32_t>(batch.size()));
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
@@ -0,0 +1,99 @@
+#pragma once
+
+#ifndef GEODE_INITIALIMAGELOADER_H_
+#define GEODE_INITIALIMAGELOADER_H_
+
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <geode/CacheableKey.hpp>
+#include <geode/Serializable.hpp>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+class ThinClientRegion;
+class VersionTag;
+
+/**
+ * Adds the initial values of an interest registration to the local cache.
+ *
+ * Values are still deserialized by the thread reading the reply chunks, but
+ * the entries are then grouped by entries map segment and added by threads of
+ * the cache thread pool, each owning a disjoint set of segments, while the
+ * next chunk is read.
+ */
+class InitialImageLoader {
+ public:
+  InitialImageLoader(ThinClientRegion& region, int32_t destroyTracker);
+
+  /** Waits for the entries that are still being added. */
+  ~InitialImageLoader() noexcept;
+
+  InitialImageLoader(const InitialImageLoader&) = delete;
+  InitialImageLoader& operator=(const InitialImageLoader&) = delete;
+
+  /** Grows the region's entries map for count more entries. */
+  void reserve(size_t count);
+
+  void add(const std::shared_ptr<CacheableKey>& key,
+           const std::shared_ptr<Cacheable>& value,
+           const std::shared_ptr<VersionTag>& versionTag);
+
+  /**
+   * Hands the entries added since the last flush to the loader threads. Blocks
+   * while too many batches are pending.
+   */
+  void flush();
+
+  /** Flushes and waits until every entry added is in the local cache. */
+  void wait();
+
+ private:
+  struct Entry {
+    std::shared_ptr<CacheableKey> key;
+    std::shared_ptr<Cacheable> value;
+    std::shared_ptr<VersionTag> versionTag;
+  };
+  class LoadWork;
+
+  void load(const std::vector<Entry>& batch);
+
+  ThinClientRegion& region_;
+  int32_t destroyTracker_;
+  uint8_t segments_;
+  std::vector<std::vector<Entry>> batches_;
+  size_t maxPending_;
+  size_t pending_;
+  std::mutex mutex_;
+  std::condition_variable loaded_;
+  std::chrono::steady_clock::duration loadTime_;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_INITIALIMAGELOADER_H_
@@ -97,9 +97,7 @@ bool LRUOverFlowToDiskAction::evict(
   mePtr->setValueI(CacheableToken::overflowed());
 
   if (m_entriesMapPtr != nullptr) {
-    int64_t newSize =
-        CacheableToken::overflowed()->objectSize() - valuePtr->objectSize();
-    m_entriesMapPtr->updateMapSize(newSize);
+    m_entriesMapPtr->chargeEntry(mePtr, keyPtr, CacheableToken::overflowed());
   }
   return true;
 }
@@ -24,12 +24,28 @@
 #include "ExpiryTaskManager.hpp"
 #include "LRUEntryProperties.hpp"
 #include "MapSegment.hpp"
+#include "ValueCompressor.hpp"
 #include "util/concurrent/spinlock_mutex.hpp"
 
 namespace apache {
 namespace geode {
 namespace client {
 
+namespace {
+
+// Estimated heap used by an entry besides its key and value: the map entry
+// and its shared_ptr control block, the segment's hash node and the LRU
+// queue node.
+const int64_t ENTRY_OVERHEAD =
+    sizeof(LRUMapEntry) + 2 * sizeof(void*) +
+    sizeof(std::pair<const std::shared_ptr<CacheableKey>,
+                     std::shared_ptr<MapEntry>>) +
+    2 * sizeof(void*) + sizeof(LRUQueue::type) + 2 * sizeof(void*);
+
+const uint32_t UNSIZED_SAMPLE_INTERVAL = 16;
+
+}  // namespace
+
 /**
  * @brief LRUAction for testing map outside of a region....
  */
@@ -69,7 +85,9 @@ LRUEntriesMap::LRUEntriesMap(ExpiryTaskManager* expiryTaskManager,
       m_limit(limit),
       m_pmPtr(nullptr),
       m_validEntries(0),
-      m_heapLRUEnabled(heapLRUEnabled) {
+      m_heapLRUEnabled(heapLRUEnabled),
+      m_unsizedValues(0),
+      m_unsizedValueSize(0) {
   m_currentMapSize = 0;
   m_action = nullptr;
   m_evictionControllerPtr = nullptr;
@@ -120,14 +138,15 @@ GfErrType LRUEntriesMap::create(const std::shared_ptr<CacheableKey>& key,
                                 std::shared_ptr<VersionTag> versionTag) {
   MapSegment* segmentRPtr = segmentFor(key);
   GfErrType err = GF_NOERR;
+  auto storedValue = toStored(newValue);
   {  // SYNCHRONIZE_SEGMENT(segmentRPtr);
     std::shared_ptr<MapEntryImpl> mePtr;
-    if ((err = segmentRPtr->create(key, newValue, me, oldValue, updateCount,
+    if ((err = segmentRPtr->create(key, storedValue, me, oldValue, updateCount,
                                    destroyTracker, versionTag)) != GF_NOERR) {
       return err;
     }
     // TODO:  can newValue ever be a token ??
-    if (!CacheableToken::isToken(newValue)) {
+    if (!CacheableToken::isToken(storedValue)) {
       m_validEntries++;
     }
     //  oldValue can be an invalid token when "createIfInvalid" is true
@@ -143,17 +162,7 @@ GfErrType LRUEntriesMap::create(const std::shared_ptr<CacheableKey>& key,
     lru_queue_.push(mePtr);
     me = mePtr;
   }
-  if (m_evictionControllerPtr != nullptr) {
-    int64_t newSize =
-        static_cast<int64_t>(Utils::checkAndGetObjectSize(newValue));
-    newSize += static_cast<int64_t>(Utils::checkAndGetObjectSize(key));
-    if (oldValue != nullptr) {
-      newSize -= static_cast<int64_t>(oldValue->objectSize());
-    } else {
-      newSize -= static_cast<int64_t>(sizeof(void*));
-    }
-    updateMapSize(newSize);
-  }
+  chargeEntry(me, key, storedValue);
   err = processLRU();
   return err;
 }
@@ -227,7 +236,7 @@ GfErrType LRUEntriesMap::invalidate(const std::shared_ptr<CacheableKey>& key,
     // TODO: there is also a race between segment remove and destroy here
     // need to assess the effect of this; also assess the affect of above
     // mentioned race
-    oldValue = m_pmPtr->read(key, persistenceInfo);
+    oldValue = readFromDisk(key, persistenceInfo);
     if (oldValue != nullptr) {
       m_pmPtr->destroy(key, persistenceInfo);
     }
@@ -235,18 +244,8 @@ GfErrType LRUEntriesMap::invalidate(const std::shared_ptr<CacheableKey>& key,
   if (!isOldValueToken) {
     --m_validEntries;
     lru_queue_.remove(me);
-    auto newSize = CacheableToken::invalid()->objectSize();
-    if (oldValue != nullptr) {
-      newSize -= oldValue->objectSize();
-    } else {
-      newSize -= sizeof(void*);
-    }
-    if (m_evictionControllerPtr != nullptr) {
-      if (newSize != 0) {
-        updateMapSize(newSize);
-      }
-    }
   }
+  chargeEntry(me, key, CacheableToken::invalid());
   return err;
 }
 
@@ -257,9 +256,14 @@ GfErrType LRUEntriesMap::put(const std::shared_ptr<CacheableKey>& key,
                              int updateCount, int destroyTracker,
                              std::shared_ptr<VersionTag> versionTag,
                              bool& isUpdate, DataInput* delta) {
+  // Deltas apply to the deserialized value, fetch the full value instead.
+  if (m_valueCompressor && delta != nullptr) {
+    return GF_INVALID_DELTA;
+  }
   MapSegment* segmentRPtr = segmentFor(key);
   GfErrType err = GF_NOERR;
   bool segmentLocked = false;
+  auto storedValue = toStored(newValue);
   {
     if (m_action != nullptr &&
         m_action->getType() == LRUAction::OVERFLOW_TO_DISK) {
@@ -267,7 +271,7 @@ GfErrType LRUEntriesMap::put(const std::shared_ptr<CacheableKey>& key,
       segmentLocked = true;
     }
     std::shared_ptr<MapEntryImpl> mePtr;
-    if ((err = segmentRPtr->put(key, newValue, me, oldValue, updateCount,
+    if ((err = segmentRPtr->put(key, storedValue, me, oldValue, updateCount,
                                 destroyTracker, isUpdate, versionTag, delta)) !=
         GF_NOERR) {
       if (segmentLocked == true) segmentRPtr->unlock();
@@ -294,7 +298,7 @@ GfErrType LRUEntriesMap::put(const std::shared_ptr<CacheableKey>& key,
         segmentLocked = true;
       }
       auto&& persistenceInfo = me->getLRUProperties().persistence_info();
-      oldValue = m_pmPtr->read(key, persistenceInfo);
+      oldValue = readFromDisk(key, persistenceInfo);
       if (oldValue != nullptr) {
         m_pmPtr->destroy(key, persistenceInfo);
       }
@@ -303,10 +307,10 @@ GfErrType LRUEntriesMap::put(const std::shared_ptr<CacheableKey>& key,
     // std::lock_guard<spinlock_mutex> mapGuard( lock );
 
     // TODO:  when can newValue be a token ??
-    if (CacheableToken::isToken(newValue) && !isOldValueToken) {
+    if (CacheableToken::isToken(storedValue) && !isOldValueToken) {
       --m_validEntries;
     }
-    if (!CacheableToken::isToken(newValue) && isOldValueToken) {
+    if (!CacheableToken::isToken(storedValue) && isOldValueToken) {
       ++m_validEntries;
     }
 
@@ -321,7 +325,7 @@ GfErrType LRUEntriesMap::put(const std::shared_ptr<CacheableKey>& key,
       lru_queue_.push(mePtr);
       me = mePtr;
     } else {
-      if (!CacheableToken::isToken(newValue) && isOldValueToken) {
+      if (!CacheableToken::isToken(storedValue) && isOldValueToken) {
         std::shared_ptr<Cacheable> tmpValue;
         segmentRPtr->getEntry(key, mePtr, tmpValue);
         lru_queue_.push(mePtr);
@@ -329,28 +333,7 @@ GfErrType LRUEntriesMap::put(const std::shared_ptr<CacheableKey>& key,
       }
     }
   }
-  if (m_evictionControllerPtr != nullptr) {
-    int64_t newSize =
-        static_cast<int64_t>(Utils::checkAndGetObjectSize(newValue));
-    /*
-    if (newSize == 0) {
-      LOGWARN("Object size for class ID %d should not be zero when HeapLRU is
-    enabled", newValue->classId());
-      LOGDEBUG("Type ID is %d for the object returning zero HeapLRU size",
-    newValue->typeId());
-    }
-    */
-    if (isUpdate == false) {
-      newSize += static_cast<int64_t>(Utils::checkAndGetObjectSize(key));
-    } else {
-      if (oldValue != nullptr) {
-        newSize -= static_cast<int64_t>(oldValue->objectSize());
-      } else {
-        newSize -= static_cast<int64_t>(sizeof(void*));
-      }
-    }
-    updateMapSize(newSize);
-  }
+  chargeEntry(me, key, storedValue);
 
   err = processLRU();
 
@@ -389,7 +372,7 @@ bool LRUEntriesMap::get(const std::shared_ptr<CacheableKey>& key,
     if (CacheableToken::isOverflowed(value)) {
       auto&& persistenceInfo = lru_props.persistence_info();
       try {
-        value = m_pmPtr->read(key, persistenceInfo);
+        value = readFromDisk(key, persistenceInfo);
       } catch (Exception& ex) {
         LOGERROR("read on the persistence layer failed - %s", ex.what());
         return false;
@@ -410,22 +393,14 @@ bool LRUEntriesMap::get(const std::shared_ptr<CacheableKey>& key,
       trigger_lru = true;
       lru_queue_.push(map_entry);
 
-      if (m_evictionControllerPtr != nullptr) {
-        int64_t newSize = 0;
-        if (value != nullptr) {
-          newSize += static_cast<int64_t>(
-              value->objectSize() - CacheableToken::invalid()->objectSize());
-        } else {
-          newSize += sizeof(void*);
-        }
-        updateMapSize(newSize);
-      }
+      chargeEntry(map_entry, key, value);
     } else {
       lru_queue_.move_to_end(map_entry);
     }
   }
 
   me = std::move(map_entry);
+  fromStored(value);
   return !trigger_lru || processLRU() == GF_NOERR;
 }
 
@@ -458,15 +433,13 @@ GfErrType LRUEntriesMap::remove(const std::shared_ptr<CacheableKey>& key,
         // TODO: there is also a race between segment remove and destroy here
         // need to assess the effect of this; also assess the affect of above
         // mentioned race
-        result = m_pmPtr->read(key, persistenceInfo);
+        result = readFromDisk(key, persistenceInfo);
         if (result != nullptr) {
           m_pmPtr->destroy(key, persistenceInfo);
         }
       }
       if (m_evictionControllerPtr != nullptr) {
-        int64_t sizeToRemove = static_cast<int64_t>(key->objectSize());
-        sizeToRemove += static_cast<int64_t>(result->objectSize());
-        updateMapSize(-sizeToRemove);
+        updateMapSize(-lru_prop.exchange_heap_size(0));
       }
     }
   }
@@ -474,6 +447,46 @@ GfErrType LRUEntriesMap::remove(const std::shared_ptr<CacheableKey>& key,
   return err;
 }
 
+void LRUEntriesMap::chargeEntry(const std::shared_ptr<MapEntryImpl>& me,
+                                const std::shared_ptr<CacheableKey>& key,
+                                const std::shared_ptr<Cacheable>& value) {
+  if (me == nullptr || m_evictionControllerPtr == nullptr) {
+    return;
+  }
+  auto heapSize = ENTRY_OVERHEAD + heapSizeOf(key) + heapSizeOf(value);
+  // The entry remembers what it was charged, so that updates, evictions and
+  // removals give back exactly that, whatever the sizes of the values.
+  updateMapSize(heapSize - me->getLRUProperties().exchange_heap_size(heapSize));
+}
+
+int64_t LRUEntriesMap::heapSizeOf(const std::shared_ptr<Cacheable>& value) {
+  if (value == nullptr || CacheableToken::isToken(value)) {
+    return 0;
+  }
+  auto size = static_cast<int64_t>(Utils::checkAndGetObjectSize(value));
+  if (size > 0 || m_region == nullptr) {
+    return size;
+  }
+
+  // The type does not implement objectSize(), so estimate it from the
+  // serialized size of a sample of such values.
+  if (m_unsizedValues++ % UNSIZED_SAMPLE_INTERVAL == 0) {
+    try {
+      auto output = m_region->getCacheImpl()->createDataOutput(
+          m_region->getPool().get());
+      output.writeObject(value);
+      auto sampled = static_cast<int64_t>(output.getBufferLength());
+      auto average = m_unsizedValueSize.load();
+      m_unsizedValueSize =
+          average == 0 ? sampled : average + (sampled - average) / 8;
+    } catch (const Exception& ex) {
+      LOGDEBUG("Could not serialize value to estimate its size: %s",
+               ex.what());
+    }
+  }
+  return m_unsizedValueSize;
+}
+
 void LRUEntriesMap::updateMapSize(int64_t size) {
   // TODO: check and remove null check since this has already been done
   // by all the callers
@@ -482,6 +495,13 @@ void LRUEntriesMap::updateMapSize(int64_t size) {
     m_evictionControllerPtr->incrementHeapSize(size);
   }
 }
+std::shared_ptr<Cacheable> LRUEntriesMap::readFromDisk(
+    const std::shared_ptr<CacheableKey>& key,
+    const std::shared_ptr<void>& persistenceInfo) const {
+  auto value = m_pmPtr->read(key, persistenceInfo);
+  return m_valueCompressor ? m_valueCompressor->fromDisk(value) : value;
+}
+
 std::shared_ptr<Cacheable> LRUEntriesMap::getFromDisk(
     const std::shared_ptr<CacheableKey>& key,
     std::shared_ptr<MapEntryImpl>& me) const {
@@ -490,7 +510,7 @@ std::shared_ptr<Cacheable> LRUEntriesMap::getFromDisk(
   try {
     LOGDEBUG("Reading value from persistence layer for key: %s",
              key->toString().c_str());
-    tmpObj = m_pmPtr->read(key, persistenceInfo);
+    tmpObj = readFromDisk(key, persistenceInfo);
   } catch (Exception& ex) {
     LOGERROR("read on the persistence layer failed - %s", ex.what());
     return nullptr;
@@ -56,6 +56,15 @@ class LRUEntriesMap : public ConcurrentEntriesMap {
   std::string m_name;
   std::atomic<uint32_t> m_validEntries;
   bool m_heapLRUEnabled;
+  // Values of types that do not implement objectSize(), and the running
+  // average of the serialized size of a sample of them.
+  std::atomic<uint32_t> m_unsizedValues;
+  std::atomic<int64_t> m_unsizedValueSize;
+
+  // Read an overflowed value, in the form kept by the segments.
+  std::shared_ptr<Cacheable> readFromDisk(
+      const std::shared_ptr<CacheableKey>& key,
+      const std::shared_ptr<void>& persistenceInfo) const;
 
  public:
   LRUEntriesMap(const LRUEntriesMap&) = delete;
@@ -95,6 +104,15 @@ class LRUEntriesMap : public ConcurrentEntriesMap {
   void processLRU(int32_t numEntriesToEvict);
   GfErrType evictionHelper();
   void updateMapSize(int64_t size);
+
+  /**
+   * Charges the estimated heap size of the entry, including the map and entry
+   * overhead, to the eviction controller in place of what it was charged
+   * before.
+   */
+  void chargeEntry(const std::shared_ptr<MapEntryImpl>& me,
+                   const std::shared_ptr<CacheableKey>& key,
+                   const std::shared_ptr<Cacheable>& value);
   inline void setPersistenceManager(
       std::shared_ptr<PersistenceManager>& pmPtr) {
     m_pmPtr = pmPtr;
@@ -127,6 +145,8 @@ class LRUEntriesMap : public ConcurrentEntriesMap {
 
   void clear() override;
 
+ private:
+  int64_t heapSizeOf(const std::shared_ptr<Cacheable>& value);
 };  // class LRUEntriesMap
 
 }  // namespace client
@@ -20,6 +20,8 @@
 #ifndef GEODE_LRUENTRYPROPERTIES_H_
 #define GEODE_LRUENTRYPROPERTIES_H_
 
+#include <atomic>
+#include <cstdint>
 #include <list>
 #include <memory>
 
@@ -37,7 +39,7 @@ class LRUEntryProperties {
   using list_iterator = std::list<std::shared_ptr<MapEntryImpl>>::iterator;
 
  public:
-  inline LRUEntryProperties() : persistence_info_(nullptr) {}
+  inline LRUEntryProperties() : persistence_info_(nullptr), heap_size_(0) {}
 
   inline const std::shared_ptr<void>& persistence_info() const {
     return persistence_info_;
@@ -51,6 +53,14 @@ class LRUEntryProperties {
 
   list_iterator iterator() const { return iter_; }
 
+  /**
+   * Sets the heap size charged to the eviction controller for this entry and
+   * returns the size charged before.
+   */
+  inline int64_t exchange_heap_size(int64_t heapSize) {
+    return heap_size_.exchange(heapSize, std::memory_order_relaxed);
+  }
+
  protected:
   // this constructor deliberately skips initializing any fields
   inline explicit LRUEntryProperties(bool) {}
@@ -58,6 +68,7 @@ class LRUEntryProperties {
  private:
   std::shared_ptr<void> persistence_info_;
   list_iterator iter_;
+  std::atomic<int64_t> heap_size_;
 };
 
 }  // namespace client
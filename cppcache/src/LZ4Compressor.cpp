@@ -0,0 +1,99 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <lz4.h>
+
+#include <geode/ExceptionTypes.hpp>
+#include <geode/LZ4Compressor.hpp>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+namespace {
+
+// Each block is preceded by its uncompressed length, little endian.
+constexpr size_t HEADER_SIZE = 4;
+
+// An LZ4 sequence expands to at most 255 bytes per input byte.
+constexpr size_t MAX_EXPANSION = 255;
+
+}  // namespace
+
+std::vector<int8_t> LZ4Compressor::compress(const int8_t* input,
+                                            size_t length) {
+  if (length > static_cast<size_t>(LZ4_MAX_INPUT_SIZE)) {
+    throw IllegalArgumentException("LZ4Compressor: input too large");
+  }
+
+  auto inputSize = static_cast<int>(length);
+  auto bound = LZ4_compressBound(inputSize);
+  std::vector<int8_t> out(HEADER_SIZE + static_cast<size_t>(bound));
+  for (size_t i = 0; i < HEADER_SIZE; i++) {
+    out[i] = static_cast<int8_t>((length >> (8 * i)) & 0xff);
+  }
+
+  auto compressed = LZ4_compress_default(
+      reinterpret_cast<const char*>(input),
+      reinterpret_cast<char*>(out.data() + HEADER_SIZE), inputSize, bound);
+  if (compressed <= 0) {
+    throw IllegalArgumentException("LZ4Compressor: compression failed");
+  }
+  out.resize(HEADER_SIZE + static_cast<size_t>(compressed));
+  return out;
+}
+
+std::vector<int8_t> LZ4Compressor::decompress(const int8_t* input,
+                                              size_t length) {
+  if (length < HEADER_SIZE + 1) {
+    throw IllegalArgumentException("LZ4Compressor: truncated input");
+  }
+  auto compressedSize = length - HEADER_SIZE;
+  if (compressedSize > static_cast<size_t>(LZ4_MAX_INPUT_SIZE)) {
+    throw IllegalArgumentException("LZ4Compressor: input too large");
+  }
+
+  auto in = reinterpret_cast<const uint8_t*>(input);
+  size_t outputLength = 0;
+  for (size_t i = 0; i < HEADER_SIZE; i++) {
+    outputLength |= static_cast<size_t>(in[i]) << (8 * i);
+  }
+  // Check the length before allocating it, it is not trusted.
+  if (outputLength > compressedSize * MAX_EXPANSION ||
+      outputLength > static_cast<size_t>(LZ4_MAX_INPUT_SIZE)) {
+    throw IllegalArgumentException("LZ4Compressor: corrupt input");
+  }
+
+  std::vector<int8_t> out(outputLength);
+  auto decompressed = LZ4_decompress_safe(
+      reinterpret_cast<const char*>(input + HEADER_SIZE),
+      reinterpret_cast<char*>(out.data()), static_cast<int>(compressedSize),
+      static_cast<int>(outputLength));
+  if (decompressed < 0 ||
+      static_cast<size_t>(decompressed) != outputLength) {
+    throw IllegalArgumentException("LZ4Compressor: corrupt input");
+  }
+  return out;
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+apache::geode::client::Compressor* createLZ4Compressor() {
+  return new apache::geode::client::LZ4Compressor();
+}
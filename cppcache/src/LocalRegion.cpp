@@ -101,7 +101,8 @@ LocalRegion::LocalRegion(const std::string& name, CacheImpl* cacheImpl,
   }
 
   m_regionStats = new RegionStats(
-      cacheImpl->getStatisticsManager().getStatisticsFactory(), m_fullPath);
+      cacheImpl->getStatisticsManager().getStatisticsFactory(), m_fullPath,
+      m_enableTimeStatistics ? &cacheImpl->getStatisticsManager() : nullptr);
   auto p = cacheImpl->getPoolManager().find(m_regionAttributes.getPoolName());
   setPool(p);
 }
@@ -344,7 +345,7 @@ std::shared_ptr<Cacheable> LocalRegion::get(
   int64_t sampleStartNanos = startStatOpTime();
   GfErrType err = getNoThrow(key, rptr, aCallbackArgument);
   updateStatOpTime(m_regionStats->getStat(), m_regionStats->getGetTimeId(),
-                   sampleStartNanos);
+                   sampleStartNanos, m_regionStats->getGetLatency());
 
   // rptr = handleReplay(err, rptr);
 
@@ -362,7 +363,7 @@ void LocalRegion::put(const std::shared_ptr<CacheableKey>& key,
   GfErrType err = putNoThrow(key, value, aCallbackArgument, oldValue, -1,
                              CacheEventFlags::NORMAL, versionTag);
   updateStatOpTime(m_regionStats->getStat(), m_regionStats->getPutTimeId(),
-                   sampleStartNanos);
+                   sampleStartNanos, m_regionStats->getPutLatency());
   //  handleReplay(err, nullptr);
   throwExceptionIfError("Region::put", err);
 }
@@ -601,7 +602,7 @@ HashMapOfCacheable LocalRegion::getAll_internal(
                                 aCallbackArgument);
 
   updateStatOpTime(m_regionStats->getStat(), m_regionStats->getGetAllTimeId(),
-                   sampleStartNanos);
+                   sampleStartNanos, m_regionStats->getGetAllLatency());
 
   throwExceptionIfError("Region::getAll", err);
 
@@ -1000,6 +1001,7 @@ GfErrType LocalRegion::getNoThrow(
                Utils::nullSafeToString(keyPtr).c_str(), err);
       err = GF_NOERR;
       if (oldValue != nullptr && !CacheableToken::isInvalid(oldValue)) {
+        fromStored(oldValue);
         LOGDEBUG("Region::get: returning updated value [%s] for key [%s]",
                  Utils::nullSafeToString(oldValue).c_str(),
                  Utils::nullSafeToString(keyPtr).c_str());
@@ -1121,7 +1123,7 @@ class PutActions {
                                   std::shared_ptr<MapEntryImpl>& entry,
                                   std::shared_ptr<Cacheable>& oldValue) const {
     if (cachingEnabled) {
-      m_region.m_entries->getEntry(key, entry, oldValue);
+      m_region.m_entries->getStoredEntry(key, entry, oldValue);
     }
   }
 
@@ -1271,7 +1273,7 @@ class DestroyActions {
                                   std::shared_ptr<MapEntryImpl>& entry,
                                   std::shared_ptr<Cacheable>& oldValue) const {
     if (cachingEnabled) {
-      m_region.m_entries->getEntry(key, entry, oldValue);
+      m_region.m_entries->getStoredEntry(key, entry, oldValue);
     }
   }
 
@@ -1387,7 +1389,7 @@ class RemoveActions {
                                   std::shared_ptr<MapEntryImpl>& entry,
                                   std::shared_ptr<Cacheable>& oldValue) const {
     if (cachingEnabled) {
-      m_region.m_entries->getEntry(key, entry, oldValue);
+      m_region.m_entries->getStoredEntry(key, entry, oldValue);
     }
   }
 
@@ -1592,7 +1594,7 @@ class InvalidateActions {
                                   std::shared_ptr<MapEntryImpl>& entry,
                                   std::shared_ptr<Cacheable>& oldValue) const {
     if (cachingEnabled) {
-      m_region.m_entries->getEntry(key, entry, oldValue);
+      m_region.m_entries->getStoredEntry(key, entry, oldValue);
     }
   }
 
@@ -2001,8 +2003,13 @@ GfErrType LocalRegion::putAllNoThrow(
     }
   }
   // try remote putAll, if any
-  if ((err = putAllNoThrow_remote(map, versionedObjPartListPtr, timeout,
-                                  aCallbackArgument)) != GF_NOERR) {
+  err = putAllNoThrow_remote(map, versionedObjPartListPtr, timeout,
+                             aCallbackArgument);
+  // the keys of a partial result are on the servers, so put them locally too
+  bool partialResult = err == GF_PUTALL_PARTIAL_RESULT_EXCEPTION &&
+                       versionedObjPartListPtr &&
+                       versionedObjPartListPtr->getSucceededKeys();
+  if (err != GF_NOERR && !partialResult) {
     return err;
   }
   // next the local puts
@@ -2010,8 +2017,8 @@ GfErrType LocalRegion::putAllNoThrow(
   std::shared_ptr<VersionTag> versionTag;
 
   if (cachingEnabled) {
-    if (m_isPRSingleHopEnabled) { /*New PRSingleHop Case:: PR Singlehop
-                                     condition*/
+    /*New PRSingleHop Case:: PR Singlehop condition*/
+    if (m_isPRSingleHopEnabled || partialResult) {
       for (size_t keyIndex = 0;
            keyIndex < versionedObjPartListPtr->getSucceededKeys()->size();
            keyIndex++) {
@@ -2035,9 +2042,12 @@ GfErrType LocalRegion::putAllNoThrow(
         if (versionedObjPartListPtr) {
           LOGDEBUG("versionedObjPartListPtr->getVersionedTagptr().size() = %zu",
                    versionedObjPartListPtr->getVersionedTagptr().size());
-          if (versionedObjPartListPtr->getVersionedTagptr().size() > 0) {
+          if (versionedObjPartListPtr->getVersionedTagptr().size() >
+              keyIndex) {
             versionTag =
                 versionedObjPartListPtr->getVersionedTagptr()[keyIndex];
+          } else {
+            versionTag = nullptr;
           }
         }
         std::pair<std::shared_ptr<Cacheable>, int>& p = oldValueMap[key];
@@ -2054,7 +2064,9 @@ GfErrType LocalRegion::putAllNoThrow(
         } else if (localErr == GF_CACHE_LISTENER_EXCEPTION) {
           LOGFINER("Region::putAll: invoke listener error [%d] for key [%s]",
                    localErr, Utils::nullSafeToString(key).c_str());
-          err = localErr;
+          if (!partialResult) {
+            err = localErr;
+          }
         } else if (localErr != GF_NOERR) {
           return localErr;
         }
@@ -2286,7 +2298,7 @@ GfErrType LocalRegion::invalidateLocal(
     }
   } else {  // if (getProcessedMarker())
     if (cachingEnabled) {
-      m_entries->getEntry(keyPtr, me, oldValue);
+      m_entries->getStoredEntry(keyPtr, me, oldValue);
     }
   }
   return err;
@@ -2468,6 +2480,12 @@ GfErrType LocalRegion::destroyRegionNoThrow(
   return err;
 }
 
+void LocalRegion::fromStored(std::shared_ptr<Cacheable>& value) const {
+  if (m_entries != nullptr) {
+    m_entries->fromStored(value);
+  }
+}
+
 GfErrType LocalRegion::putLocal(const std::string& name, bool isCreate,
                                 const std::shared_ptr<CacheableKey>& key,
                                 const std::shared_ptr<Cacheable>& value,
@@ -2579,6 +2597,7 @@ bool LocalRegion::invokeCacheWriterForEntryEvent(
   // Check if we have a local cache writer. If so, invoke and return.
   bool bCacheWriterReturn = true;
   if (m_writer != nullptr) {
+    fromStored(oldValue);
     if (oldValue != nullptr && CacheableToken::isInvalid(oldValue)) {
       oldValue = nullptr;
     }
@@ -2700,6 +2719,7 @@ GfErrType LocalRegion::invokeCacheListenerForEntryEvent(
 
   // Check if we have a local cache listener. If so, invoke and return.
   if (m_listener != nullptr) {
+    fromStored(oldValue);
     if (oldValue != nullptr && CacheableToken::isInvalid(oldValue)) {
       oldValue = nullptr;
     }
@@ -3219,9 +3239,9 @@ int64_t LocalRegion::startStatOpTime() {
   return m_enableTimeStatistics ? Utils::startStatOpTime() : 0;
 }
 void LocalRegion::updateStatOpTime(Statistics* statistics, int32_t statId,
-                                   int64_t start) {
+                                   int64_t start, LatencyHistogram* latency) {
   if (m_enableTimeStatistics) {
-    Utils::updateStatOpTime(statistics, statId, start);
+    Utils::updateStatOpTime(statistics, statId, start, latency);
   }
 }
 
@@ -340,7 +340,10 @@ class APACHE_GEODE_EXPORT LocalRegion : public RegionInternal {
 
   //  moved putLocal to public since this is used by a few other
   // classes like CacheableObjectPartList now
-  /** put an entry in local cache without invoking any callbacks */
+  /**
+   * put an entry in local cache without invoking any callbacks; oldValue is
+   * in the form kept by the entries map, see fromStored
+   */
   GfErrType putLocal(const std::string& name, bool isCreate,
                      const std::shared_ptr<CacheableKey>& keyPtr,
                      const std::shared_ptr<Cacheable>& valuePtr,
@@ -349,6 +352,8 @@ class APACHE_GEODE_EXPORT LocalRegion : public RegionInternal {
                      std::shared_ptr<VersionTag> versionTag,
                      DataInput* delta = nullptr,
                      std::shared_ptr<EventId> eventId = nullptr);
+  /** replace a value in the form kept by the entries map with the value */
+  void fromStored(std::shared_ptr<Cacheable>& value) const;
   GfErrType invalidateLocal(const std::string& name,
                             const std::shared_ptr<CacheableKey>& keyPtr,
                             const std::shared_ptr<Cacheable>& value,
@@ -503,7 +508,7 @@ class APACHE_GEODE_EXPORT LocalRegion : public RegionInternal {
 
   int64_t startStatOpTime();
   void updateStatOpTime(Statistics* m_regionStats, int32_t statId,
-                        int64_t start);
+                        int64_t start, LatencyHistogram* latency = nullptr);
 
   /* protected attributes */
   std::string m_name;
@@ -0,0 +1,90 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "LocatorServerListCache.hpp"
+
+#include "Utils.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+bool LocatorServerListCache::getServer(ServerLocation& server,
+                                       const std::set<ServerLocation>& excluded,
+                                       const std::string& serverGroup,
+                                       std::chrono::milliseconds timeToLive,
+                                       const Fetch& fetch,
+                                       clock::time_point now) {
+  std::unique_lock<decltype(mutex_)> lock(mutex_);
+  const auto generation = generation_;
+  while (refreshing_) {
+    refreshed_.wait(lock);
+  }
+  if (serverGroup_ == serverGroup && now < expiry_) {
+    return pick(server, excluded);
+  }
+  if (generation_ != generation) {
+    // The fetch we waited for failed, let the locators decide.
+    return false;
+  }
+
+  refreshing_ = true;
+  lock.unlock();
+
+  std::vector<ServerLocation> servers;
+  try {
+    servers = fetch();
+  } catch (...) {
+    servers.clear();
+  }
+
+  lock.lock();
+  refreshing_ = false;
+  generation_++;
+  refreshed_.notify_all();
+  if (servers.empty()) {
+    return false;
+  }
+
+  serverGroup_ = serverGroup;
+  servers_ = std::move(servers);
+  // Start at a random server so that clients warming up at the same time do
+  // not all connect to the first server of the list.
+  RandGen randGen;
+  next_ = randGen(servers_.size());
+  expiry_ = now + timeToLive;
+  return pick(server, excluded);
+}
+
+bool LocatorServerListCache::pick(ServerLocation& server,
+                                  const std::set<ServerLocation>& excluded) {
+  const auto size = servers_.size();
+  for (size_t i = 0; i < size; ++i) {
+    const auto& candidate = servers_[next_++ % size];
+    if (excluded.find(candidate) == excluded.end()) {
+      server = candidate;
+      return true;
+    }
+  }
+  // Every cached server failed for this caller, the list is likely stale.
+  expiry_ = clock::time_point{};
+  return false;
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
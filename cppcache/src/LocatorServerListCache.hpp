@@ -0,0 +1,88 @@
+#pragma once
+
+#ifndef GEODE_LOCATORSERVERLISTCACHE_H_
+#define GEODE_LOCATORSERVERLISTCACHE_H_
+
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "ServerLocation.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * Server list fetched from the locators in one request and kept for
+ * locator-cache-ttl, so that growing a pool does not query a locator for
+ * every new connection. The servers are handed out round robin, starting at a
+ * random one.
+ *
+ * The list is fetched again once it expired, when it was fetched for another
+ * server group, and after every cached server was excluded by a caller, which
+ * happens when they failed. Concurrent callers wait for an ongoing fetch
+ * instead of querying the locators themselves.
+ */
+class LocatorServerListCache {
+ public:
+  using clock = std::chrono::steady_clock;
+  using Fetch = std::function<std::vector<ServerLocation>()>;
+
+  LocatorServerListCache() = default;
+
+  LocatorServerListCache(const LocatorServerListCache&) = delete;
+  LocatorServerListCache& operator=(const LocatorServerListCache&) = delete;
+
+  /**
+   * Picks a server that is not in excluded from the list cached for
+   * serverGroup, calling fetch for a new list first if needed.
+   * @return true if server was set, false if the caller should ask the
+   *         locators for a server
+   */
+  bool getServer(ServerLocation& server,
+                 const std::set<ServerLocation>& excluded,
+                 const std::string& serverGroup,
+                 std::chrono::milliseconds timeToLive, const Fetch& fetch,
+                 clock::time_point now = clock::now());
+
+ private:
+  bool pick(ServerLocation& server, const std::set<ServerLocation>& excluded);
+
+  std::mutex mutex_;
+  std::condition_variable refreshed_;
+  bool refreshing_ = false;
+  uint64_t generation_ = 0;
+  std::string serverGroup_;
+  std::vector<ServerLocation> servers_;
+  clock::time_point expiry_;
+  size_t next_ = 0;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_LOCATORSERVERLISTCACHE_H_
@@ -59,6 +59,17 @@ void MapSegment::clear() {
   m_map.clear();
 }
 
+void MapSegment::reserve(uint32_t size) {
+  std::lock_guard<decltype(m_spinlock)> lk(m_spinlock);
+  uint32_t primeIndex;
+  auto mapSize = TableOfPrimes::nextLargerPrime(size, primeIndex);
+  if (primeIndex > m_primeIndex) {
+    LOGFINER("Growing MapSegment to size %d.", mapSize);
+    m_primeIndex = primeIndex;
+    m_map.reserve(mapSize);
+  }
+}
+
 void MapSegment::lock() { m_segmentMutex.lock(); }
 
 void MapSegment::unlock() { m_segmentMutex.unlock(); }
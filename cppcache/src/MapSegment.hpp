@@ -202,6 +202,11 @@ class MapSegment {
   void close();
   void clear();
 
+  /**
+   * @brief grow the segment to hold size entries without rehashing.
+   */
+  void reserve(uint32_t size);
+
   /**
    * @brief put a new value in the map, failing if key already exists.
    * return error code if key already existing or something goes wrong.
@@ -0,0 +1,102 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "NegativeLookupCache.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+NegativeLookupCache::NegativeLookupCache(uint32_t entriesLimit,
+                                         std::chrono::milliseconds timeToLive)
+    : entriesLimit_(entriesLimit), timeToLive_(timeToLive), generation_(0) {}
+
+bool NegativeLookupCache::contains(const std::shared_ptr<CacheableKey>& key) {
+  std::lock_guard<decltype(mutex_)> guard(mutex_);
+  auto found = entries_.find(key);
+  if (found == entries_.end()) {
+    return false;
+  }
+  if (timeToLive_ > std::chrono::milliseconds::zero() &&
+      found->second.expiry <= clock::now()) {
+    erase(found);
+    return false;
+  }
+  return true;
+}
+
+uint64_t NegativeLookupCache::generation() const {
+  std::lock_guard<decltype(mutex_)> guard(mutex_);
+  return generation_;
+}
+
+void NegativeLookupCache::add(const std::shared_ptr<CacheableKey>& key,
+                              uint64_t generation) {
+  if (entriesLimit_ == 0) {
+    return;
+  }
+  const auto now = clock::now();
+
+  std::lock_guard<decltype(mutex_)> guard(mutex_);
+  if (generation != generation_) {
+    return;
+  }
+
+  auto found = entries_.find(key);
+  if (found != entries_.end()) {
+    erase(found);
+  }
+  while (!order_.empty() &&
+         (entries_.size() >= entriesLimit_ ||
+          (timeToLive_ > std::chrono::milliseconds::zero() &&
+           entries_.find(order_.front())->second.expiry <= now))) {
+    erase(entries_.find(order_.front()));
+  }
+
+  auto position = order_.insert(order_.end(), key);
+  entries_.emplace(key, Entry{now + timeToLive_, position});
+}
+
+void NegativeLookupCache::remove(const std::shared_ptr<CacheableKey>& key) {
+  std::lock_guard<decltype(mutex_)> guard(mutex_);
+  ++generation_;
+  auto found = entries_.find(key);
+  if (found != entries_.end()) {
+    erase(found);
+  }
+}
+
+void NegativeLookupCache::clear() {
+  std::lock_guard<decltype(mutex_)> guard(mutex_);
+  ++generation_;
+  entries_.clear();
+  order_.clear();
+}
+
+size_t NegativeLookupCache::size() const {
+  std::lock_guard<decltype(mutex_)> guard(mutex_);
+  return entries_.size();
+}
+
+void NegativeLookupCache::erase(decltype(entries_)::iterator found) {
+  order_.erase(found->second.position);
+  entries_.erase(found);
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
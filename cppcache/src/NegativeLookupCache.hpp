@@ -0,0 +1,108 @@
+#pragma once
+
+#ifndef GEODE_NEGATIVELOOKUPCACHE_H_
+#define GEODE_NEGATIVELOOKUPCACHE_H_
+
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include <geode/CacheableKey.hpp>
+#include <geode/internal/functional.hpp>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * Remembers, for a bounded time, the keys a server reported as absent so that
+ * repeated gets of a missing key are answered without a round trip.
+ *
+ * Keys are forgotten when they expire, when the limit is reached (oldest
+ * first) and when the region learns that the key may now exist: a put, a
+ * create or a subscription event. A lookup that raced with such an update is
+ * not remembered, see generation().
+ */
+class NegativeLookupCache {
+ public:
+  /**
+   * @param entriesLimit maximum number of keys remembered
+   * @param timeToLive how long a key is remembered, zero for as long as it is
+   *   not updated or evicted
+   */
+  NegativeLookupCache(uint32_t entriesLimit,
+                      std::chrono::milliseconds timeToLive);
+
+  NegativeLookupCache(const NegativeLookupCache&) = delete;
+  NegativeLookupCache& operator=(const NegativeLookupCache&) = delete;
+
+  /** Returns true if key is known to be absent on the server. */
+  bool contains(const std::shared_ptr<CacheableKey>& key);
+
+  /**
+   * Returns the current generation, to be taken before the lookup is sent and
+   * passed to add once the server answered.
+   */
+  uint64_t generation() const;
+
+  /**
+   * Remembers that key is absent, unless a key was removed or the cache was
+   * cleared since generation was taken.
+   */
+  void add(const std::shared_ptr<CacheableKey>& key, uint64_t generation);
+
+  void remove(const std::shared_ptr<CacheableKey>& key);
+
+  void clear();
+
+  size_t size() const;
+
+ private:
+  using clock = std::chrono::steady_clock;
+  using Order = std::list<std::shared_ptr<CacheableKey>>;
+
+  struct Entry {
+    clock::time_point expiry;
+    Order::iterator position;
+  };
+
+  const size_t entriesLimit_;
+  const std::chrono::milliseconds timeToLive_;
+
+  mutable std::mutex mutex_;
+  uint64_t generation_;
+  // Oldest first, which with a single time to live is also expiry order.
+  Order order_;
+  std::unordered_map<std::shared_ptr<CacheableKey>, Entry,
+                     dereference_hash<std::shared_ptr<CacheableKey>>,
+                     dereference_equal_to<std::shared_ptr<CacheableKey>>>
+      entries_;
+
+  void erase(decltype(entries_)::iterator found);
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_NEGATIVELOOKUPCACHE_H_
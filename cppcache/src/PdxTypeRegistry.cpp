@@ -17,6 +17,9 @@
 
 #include "PdxTypeRegistry.hpp"
 
+#include <array>
+#include <functional>
+
 #include <boost/thread/lock_types.hpp>
 
 #include <geode/PoolManager.hpp>
@@ -31,12 +34,50 @@ namespace apache {
 namespace geode {
 namespace client {
 
+namespace {
+
+std::atomic<uint64_t> pdxTypeRegistryEpochs{0};
+
+uint64_t nextPdxTypeRegistryEpoch() { return ++pdxTypeRegistryEpochs; }
+
+/**
+ * Types recently looked up by the current thread, direct mapped by type id
+ * and class name. Epochs are unique across registries, so the cache is
+ * emptied whenever the thread turns to another registry or the one it used
+ * was cleared.
+ */
+struct PdxTypeCache {
+  static constexpr size_t ID_SLOTS = 64;
+  static constexpr size_t NAME_SLOTS = 16;
+
+  uint64_t epoch = 0;
+  std::array<std::pair<int32_t, std::shared_ptr<PdxType>>, ID_SLOTS> byId;
+  std::array<std::pair<std::string, std::shared_ptr<PdxType>>, NAME_SLOTS>
+      byName;
+
+  static PdxTypeCache& forEpoch(uint64_t epoch) {
+    static thread_local PdxTypeCache cache;
+    if (cache.epoch != epoch) {
+      cache.byId.fill({});
+      cache.byName.fill({});
+      cache.epoch = epoch;
+    }
+    return cache;
+  }
+};
+
+constexpr size_t PdxTypeCache::ID_SLOTS;
+constexpr size_t PdxTypeCache::NAME_SLOTS;
+
+}  // namespace
+
 PdxTypeRegistry::PdxTypeRegistry(CacheImpl* cache)
     : cache_(cache),
       typeIdToPdxType_(),
       remoteTypeIdToMergedPdxType_(),
       localTypeToPdxType_(),
       pdxTypeToTypeIdMap_(),
+      epoch_(nextPdxTypeRegistryEpoch()),
       enumToInt_(CacheableHashMap::create()),
       intToEnum_(CacheableHashMap::create()) {}
 
@@ -112,6 +153,8 @@ void PdxTypeRegistry::clear() {
     if (enumToInt_) enumToInt_->clear();
 
     pdxTypeToTypeIdMap_.clear();
+
+    epoch_.store(nextPdxTypeRegistryEpoch(), std::memory_order_release);
   }
   {
     boost::unique_lock<decltype(preserved_data_mutex_)> guard{
@@ -127,9 +170,18 @@ void PdxTypeRegistry::addPdxType(int32_t typeId,
 }
 
 std::shared_ptr<PdxType> PdxTypeRegistry::getPdxType(int32_t typeId) const {
+  auto& cache =
+      PdxTypeCache::forEpoch(epoch_.load(std::memory_order_acquire));
+  auto& cached =
+      cache.byId[static_cast<uint32_t>(typeId) % PdxTypeCache::ID_SLOTS];
+  if (cached.second && cached.first == typeId) {
+    return cached.second;
+  }
+
   boost::shared_lock<decltype(types_mutex_)> guard{types_mutex_};
   auto&& iter = typeIdToPdxType_.find(typeId);
   if (iter != typeIdToPdxType_.end()) {
+    cached = {typeId, iter->second};
     return iter->second;
   }
   return nullptr;
@@ -143,9 +195,18 @@ void PdxTypeRegistry::addLocalPdxType(const std::string& localType,
 
 std::shared_ptr<PdxType> PdxTypeRegistry::getLocalPdxType(
     const std::string& localType) const {
+  auto& cache =
+      PdxTypeCache::forEpoch(epoch_.load(std::memory_order_acquire));
+  auto& cached = cache.byName[std::hash<std::string>{}(localType) %
+                              PdxTypeCache::NAME_SLOTS];
+  if (cached.second && cached.first == localType) {
+    return cached.second;
+  }
+
   boost::shared_lock<decltype(types_mutex_)> guard{types_mutex_};
   auto&& it = localTypeToPdxType_.find(localType);
   if (it != localTypeToPdxType_.end()) {
+    cached = {localType, it->second};
     return it->second;
   }
   return nullptr;
@@ -159,6 +220,7 @@ void PdxTypeRegistry::setMergedType(int32_t remoteTypeId,
 
 std::shared_ptr<PdxType> PdxTypeRegistry::getMergedType(
     int32_t remoteTypeId) const {
+  boost::shared_lock<decltype(types_mutex_)> guard{types_mutex_};
   auto&& it = remoteTypeIdToMergedPdxType_.find(remoteTypeId);
   if (it != remoteTypeIdToMergedPdxType_.end()) {
     return it->second;
@@ -20,6 +20,7 @@
 #ifndef GEODE_PDXTYPEREGISTRY_H_
 #define GEODE_PDXTYPEREGISTRY_H_
 
+#include <atomic>
 #include <map>
 #include <unordered_map>
 
@@ -73,6 +74,10 @@ class APACHE_GEODE_EXPORT PdxTypeRegistry
 
   mutable boost::shared_mutex preserved_data_mutex_;
 
+  // Types are only ever added or cleared, so threads may keep those they
+  // looked up until clear() moves the epoch on.
+  std::atomic<uint64_t> epoch_;
+
   bool pdxIgnoreUnreadFields_;
 
   bool pdxReadSerialized_;
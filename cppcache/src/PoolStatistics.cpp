@@ -27,7 +27,9 @@ using statistics::StatisticsManager;
 constexpr const char* PoolStats::STATS_NAME;
 constexpr const char* PoolStats::STATS_DESC;
 
-PoolStats::PoolStats(StatisticsFactory* factory, const std::string& poolName) {
+PoolStats::PoolStats(StatisticsFactory* factory, const std::string& poolName,
+                     StatisticsManager* latencyHistograms)
+    : m_latencyHistograms(latencyHistograms) {
   auto statsType = factory->findType(STATS_NAME);
 
   if (statsType == nullptr) {
@@ -181,6 +183,37 @@ PoolStats::PoolStats(StatisticsFactory* factory, const std::string& poolName) {
   getStats()->setInt(m_processedDeltaMessagesTimeId, 0);
   getStats()->setInt(m_queryExecutionsId, 0);
   getStats()->setLong(m_queryExecutionTimeId, 0);
+
+  if (m_latencyHistograms) {
+    auto histogram =
+        [&](const char* operation) -> std::unique_ptr<LatencyHistogram> {
+          auto latency = std::unique_ptr<LatencyHistogram>(
+              new LatencyHistogram(
+                  factory,
+                  std::string(STATS_NAME) + "_" + operation + "Latency",
+                  poolName));
+          m_latencyHistograms->addLatencyHistogram(latency.get());
+          return latency;
+        };
+    m_queryLatency = histogram("query");
+    m_functionExecutionLatency = histogram("functionExecution");
+    m_connectionCheckoutLatency = histogram("connectionCheckout");
+  }
+}
+
+void PoolStats::close() {
+  getStats()->close();
+  if (m_latencyHistograms) {
+    m_latencyHistograms->removeLatencyHistogram(m_queryLatency.get());
+    m_latencyHistograms->removeLatencyHistogram(
+        m_functionExecutionLatency.get());
+    m_latencyHistograms->removeLatencyHistogram(
+        m_connectionCheckoutLatency.get());
+    m_latencyHistograms = nullptr;
+    m_queryLatency->close();
+    m_functionExecutionLatency->close();
+    m_connectionCheckoutLatency->close();
+  }
 }
 
 PoolStats::~PoolStats() {
@@ -19,10 +19,12 @@
 #ifndef GEODE_POOLSTATISTICS_H_
 #define GEODE_POOLSTATISTICS_H_
 
+#include <memory>
 #include <string>
 
 #include <geode/internal/geode_globals.hpp>
 
+#include "statistics/LatencyHistogram.hpp"
 #include "statistics/Statistics.hpp"
 #include "statistics/StatisticsFactory.hpp"
 #include "statistics/StatisticsManager.hpp"
@@ -31,20 +33,26 @@ namespace apache {
 namespace geode {
 namespace client {
 
+using statistics::LatencyHistogram;
 using statistics::StatisticDescriptor;
 using statistics::Statistics;
 using statistics::StatisticsType;
 
 class PoolStats {
  public:
-  /** hold statistics for a pool.. */
-  PoolStats(statistics::StatisticsFactory* factory,
-            const std::string& poolName);
+  /**
+   * hold statistics for a pool. Latency histograms for query, function
+   * execution and connection checkout are only created, and registered with
+   * latencyHistograms for the OpenMetrics exporter, when latencyHistograms is
+   * not nullptr.
+   */
+  PoolStats(statistics::StatisticsFactory* factory, const std::string& poolName,
+            statistics::StatisticsManager* latencyHistograms = nullptr);
 
   /** disable stat collection for this item. */
   virtual ~PoolStats();
 
-  void close() { getStats()->close(); }
+  void close();
 
   void setLocators(int32_t curVal) { getStats()->setInt(m_locatorsId, curVal); }
 
@@ -139,9 +147,26 @@ class PoolStats {
 
   inline int32_t getQueryExecutionTimeId() { return m_queryExecutionTimeId; }
 
+  /** @return query latency histogram, nullptr unless enabled */
+  inline LatencyHistogram* getQueryLatency() { return m_queryLatency.get(); }
+
+  /** @return function execution latency histogram, nullptr unless enabled */
+  inline LatencyHistogram* getFunctionExecutionLatency() {
+    return m_functionExecutionLatency.get();
+  }
+
+  /** @return connection checkout latency histogram, nullptr unless enabled */
+  inline LatencyHistogram* getConnectionCheckoutLatency() {
+    return m_connectionCheckoutLatency.get();
+  }
+
  private:
   // volatile apache::geode::statistics::Statistics* m_poolStats;
   apache::geode::statistics::Statistics* m_poolStats;
+  statistics::StatisticsManager* m_latencyHistograms;
+  std::unique_ptr<LatencyHistogram> m_queryLatency;
+  std::unique_ptr<LatencyHistogram> m_functionExecutionLatency;
+  std::unique_ptr<LatencyHistogram> m_connectionCheckoutLatency;
 
   int32_t m_locatorsId;
   int32_t m_serversId;
@@ -41,6 +41,8 @@ RegionAttributes::RegionAttributes()
       m_entryIdleTimeoutExpirationAction(ExpirationAction::INVALIDATE),
       m_lruEvictionAction(ExpirationAction::LOCAL_DESTROY),
       m_lruEntriesLimit(0),
+      m_negativeCacheEntriesLimit(0),
+      m_negativeCacheTimeToLive(std::chrono::seconds(1)),
       m_caching(true),
       m_maxValueDistLimit(100 * 1024),
       m_entryIdleTimeout(0),
@@ -55,7 +57,8 @@ RegionAttributes::RegionAttributes()
       m_persistenceProperties(nullptr),
       m_persistenceManager(nullptr),
       m_isClonable(false),
-      m_isConcurrencyChecksEnabled(true) {}
+      m_isConcurrencyChecksEnabled(true),
+      m_isSubscriptionConflationEnabled(false) {}
 
 RegionAttributes::~RegionAttributes() noexcept = default;
 
@@ -126,6 +129,23 @@ std::shared_ptr<PartitionResolver> RegionAttributes::getPartitionResolver()
   return m_partitionResolver;
 }
 
+std::shared_ptr<Compressor> RegionAttributes::getCompressor() const {
+  if (!m_compressor &&
+      (!m_compressorLibrary.empty() || !m_compressorFactory.empty())) {
+    if (CacheXmlParser::managedCompressorFn_ &&
+        m_compressorFactory.find('.') != std::string::npos) {
+      // this is a managed library
+      m_compressor.reset((CacheXmlParser::managedCompressorFn_)(
+          m_compressorLibrary.c_str(), m_compressorFactory.c_str()));
+    } else {
+      auto funcptr = Utils::getFactoryFunction<Compressor*()>(
+          m_compressorLibrary, m_compressorFactory);
+      m_compressor.reset(funcptr());
+    }
+  }
+  return m_compressor;
+}
+
 std::shared_ptr<PersistenceManager> RegionAttributes::getPersistenceManager()
     const {
   if (!m_persistenceManager && !m_persistenceLibrary.empty()) {
@@ -159,6 +179,10 @@ const std::string& RegionAttributes::getPartitionResolverFactory() const {
   return m_partitionResolverFactory;
 }
 
+const std::string& RegionAttributes::getCompressorFactory() const {
+  return m_compressorFactory;
+}
+
 const std::string& RegionAttributes::getPersistenceFactory() const {
   return m_persistenceFactory;
 }
@@ -178,6 +202,10 @@ const std::string& RegionAttributes::getPartitionResolverLibrary() const {
   return m_partitionResolverLibrary;
 }
 
+const std::string& RegionAttributes::getCompressorLibrary() const {
+  return m_compressorLibrary;
+}
+
 const std::string& RegionAttributes::getEndpoints() const {
   return m_endpoints;
 }
@@ -242,6 +270,15 @@ uint32_t RegionAttributes::getLruEntriesLimit() const {
   return m_lruEntriesLimit;
 }
 
+uint32_t RegionAttributes::getNegativeCacheEntriesLimit() const {
+  return m_negativeCacheEntriesLimit;
+}
+
+std::chrono::milliseconds RegionAttributes::getNegativeCacheTimeToLive()
+    const {
+  return m_negativeCacheTimeToLive;
+}
+
 DiskPolicyType RegionAttributes::getDiskPolicy() const { return m_diskPolicy; }
 
 std::shared_ptr<Serializable> RegionAttributes::createDeserializable() {
@@ -300,6 +337,8 @@ void RegionAttributes::toData(DataOutput& out) const {
   apache::geode::client::impl::writeString(out, m_cacheListenerFactory);
   apache::geode::client::impl::writeString(out, m_partitionResolverLibrary);
   apache::geode::client::impl::writeString(out, m_partitionResolverFactory);
+  apache::geode::client::impl::writeString(out, m_compressorLibrary);
+  apache::geode::client::impl::writeString(out, m_compressorFactory);
   out.writeInt(static_cast<int32_t>(m_diskPolicy));
   apache::geode::client::impl::writeString(out, m_endpoints);
   apache::geode::client::impl::writeString(out, m_persistenceLibrary);
@@ -307,6 +346,10 @@ void RegionAttributes::toData(DataOutput& out) const {
   out.writeObject(m_persistenceProperties);
   apache::geode::client::impl::writeString(out, m_poolName);
   apache::geode::client::impl::writeBool(out, m_isConcurrencyChecksEnabled);
+  out.writeInt(static_cast<int32_t>(m_negativeCacheEntriesLimit));
+  out.writeInt(static_cast<int32_t>(m_negativeCacheTimeToLive.count()));
+  apache::geode::client::impl::writeBool(out,
+                                         m_isSubscriptionConflationEnabled);
 }
 
 void RegionAttributes::fromData(DataInput& in) {
@@ -340,6 +383,8 @@ void RegionAttributes::fromData(DataInput& in) {
   apache::geode::client::impl::readString(in, m_cacheListenerFactory);
   apache::geode::client::impl::readString(in, m_partitionResolverLibrary);
   apache::geode::client::impl::readString(in, m_partitionResolverFactory);
+  apache::geode::client::impl::readString(in, m_compressorLibrary);
+  apache::geode::client::impl::readString(in, m_compressorFactory);
   m_diskPolicy = static_cast<DiskPolicyType>(in.readInt32());
   apache::geode::client::impl::readString(in, m_endpoints);
   apache::geode::client::impl::readString(in, m_persistenceLibrary);
@@ -348,6 +393,10 @@ void RegionAttributes::fromData(DataInput& in) {
       std::dynamic_pointer_cast<Properties>(in.readObject());
   apache::geode::client::impl::readString(in, m_poolName);
   apache::geode::client::impl::readBool(in, &m_isConcurrencyChecksEnabled);
+  m_negativeCacheEntriesLimit = in.readInt32();
+  m_negativeCacheTimeToLive = std::chrono::milliseconds(in.readInt32());
+  apache::geode::client::impl::readBool(in,
+                                        &m_isSubscriptionConflationEnabled);
 }
 
 /** Return true if all the attributes are equal to those of other. */
@@ -378,6 +427,12 @@ bool RegionAttributes::operator==(const RegionAttributes& other) const {
   if (m_concurrencyLevel != other.m_concurrencyLevel) return false;
   if (m_lruEntriesLimit != other.m_lruEntriesLimit) return false;
   if (m_lruEvictionAction != other.m_lruEvictionAction) return false;
+  if (m_negativeCacheEntriesLimit != other.m_negativeCacheEntriesLimit) {
+    return false;
+  }
+  if (m_negativeCacheTimeToLive != other.m_negativeCacheTimeToLive) {
+    return false;
+  }
   if (m_caching != other.m_caching) return false;
   if (m_clientNotificationEnabled != other.m_clientNotificationEnabled) {
     return false;
@@ -407,6 +462,12 @@ bool RegionAttributes::operator==(const RegionAttributes& other) const {
   if (m_partitionResolverFactory != other.m_partitionResolverFactory) {
     return false;
   }
+  if (m_compressorLibrary != other.m_compressorLibrary) {
+    return false;
+  }
+  if (m_compressorFactory != other.m_compressorFactory) {
+    return false;
+  }
   if (m_diskPolicy != other.m_diskPolicy) {
     return false;
   }
@@ -422,6 +483,10 @@ bool RegionAttributes::operator==(const RegionAttributes& other) const {
   if (m_isConcurrencyChecksEnabled != other.m_isConcurrencyChecksEnabled) {
     return false;
   }
+  if (m_isSubscriptionConflationEnabled !=
+      other.m_isSubscriptionConflationEnabled) {
+    return false;
+  }
 
   return true;
 }
@@ -454,6 +519,11 @@ void RegionAttributes::validateSerializableAttributes() {
         "PartitionResolver must be set with setPartitionResolver(library, "
         "factory) in members of type SERVER");
   }
+  if (m_compressor != nullptr) {
+    throw IllegalStateException(
+        "Compressor must be set with setCompressor(library, factory) in "
+        "members of type SERVER");
+  }
   if (m_persistenceManager != nullptr) {
     throw IllegalStateException(
         "persistenceManager must be set with setPersistenceManager(library, "
@@ -473,6 +543,12 @@ void RegionAttributes::setPartitionResolver(const std::string& lib,
   m_partitionResolverFactory = func;
 }
 
+void RegionAttributes::setCompressor(const std::string& lib,
+                                     const std::string& func) {
+  m_compressorLibrary = lib;
+  m_compressorFactory = func;
+}
+
 void RegionAttributes::setCacheLoader(const std::string& lib,
                                       const std::string& func) {
   m_cacheLoaderLibrary = lib;
@@ -506,6 +582,15 @@ void RegionAttributes::setCachingEnabled(bool enable) { m_caching = enable; }
 void RegionAttributes::setLruEntriesLimit(int limit) {
   m_lruEntriesLimit = limit;
 }
+
+void RegionAttributes::setNegativeCacheEntriesLimit(uint32_t limit) {
+  m_negativeCacheEntriesLimit = limit;
+}
+
+void RegionAttributes::setNegativeCacheTimeToLive(
+    std::chrono::milliseconds timeToLive) {
+  m_negativeCacheTimeToLive = timeToLive;
+}
 void RegionAttributes::setDiskPolicy(DiskPolicyType diskPolicy) {
   m_diskPolicy = diskPolicy;
 }
@@ -518,6 +603,10 @@ void RegionAttributes::setConcurrencyChecksEnabled(bool enable) {
   m_isConcurrencyChecksEnabled = enable;
 }
 
+void RegionAttributes::setSubscriptionConflationEnabled(bool enable) {
+  m_isSubscriptionConflationEnabled = enable;
+}
+
 }  // namespace client
 }  // namespace geode
 }  // namespace apache
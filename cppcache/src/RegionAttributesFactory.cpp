@@ -61,6 +61,11 @@ RegionAttributesFactory& RegionAttributesFactory::setPartitionResolver(
   m_regionAttributes.m_partitionResolver = aResolver;
   return *this;
 }
+RegionAttributesFactory& RegionAttributesFactory::setCompressor(
+    const std::shared_ptr<Compressor>& aCompressor) {
+  m_regionAttributes.m_compressor = aCompressor;
+  return *this;
+}
 
 RegionAttributesFactory& RegionAttributesFactory::setCacheLoader(
     const std::string& lib, const std::string& func) {
@@ -86,6 +91,12 @@ RegionAttributesFactory& RegionAttributesFactory::setPartitionResolver(
   return *this;
 }
 
+RegionAttributesFactory& RegionAttributesFactory::setCompressor(
+    const std::string& lib, const std::string& func) {
+  m_regionAttributes.setCompressor(lib, func);
+  return *this;
+}
+
 RegionAttributesFactory& RegionAttributesFactory::setEntryIdleTimeout(
     ExpirationAction action, std::chrono::seconds idleTimeout) {
   m_regionAttributes.m_entryIdleTimeout = idleTimeout;
@@ -185,6 +196,23 @@ RegionAttributesFactory& RegionAttributesFactory::setLruEntriesLimit(
   return *this;
 }
 
+RegionAttributesFactory& RegionAttributesFactory::setNegativeCacheEntriesLimit(
+    const uint32_t entriesLimit) {
+  m_regionAttributes.setNegativeCacheEntriesLimit(entriesLimit);
+  return *this;
+}
+
+RegionAttributesFactory& RegionAttributesFactory::setNegativeCacheTimeToLive(
+    std::chrono::milliseconds timeToLive) {
+  if (timeToLive < std::chrono::milliseconds::zero()) {
+    throw IllegalArgumentException(
+        "RegionAttributesFactory::setNegativeCacheTimeToLive: "
+        "timeToLive must not be negative");
+  }
+  m_regionAttributes.setNegativeCacheTimeToLive(timeToLive);
+  return *this;
+}
+
 RegionAttributesFactory& RegionAttributesFactory::setDiskPolicy(
     const DiskPolicyType diskPolicy) {
   if (diskPolicy == DiskPolicyType::PERSIST) {
@@ -232,6 +260,12 @@ RegionAttributesFactory& RegionAttributesFactory::setConcurrencyChecksEnabled(
   return *this;
 }
 
+RegionAttributesFactory&
+RegionAttributesFactory::setSubscriptionConflationEnabled(bool enable) {
+  m_regionAttributes.setSubscriptionConflationEnabled(enable);
+  return *this;
+}
+
 }  // namespace client
 }  // namespace geode
 }  // namespace apache
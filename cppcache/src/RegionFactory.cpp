@@ -100,6 +100,11 @@ RegionFactory& RegionFactory::setPartitionResolver(
   m_regionAttributesFactory->setPartitionResolver(aResolver);
   return *this;
 }
+RegionFactory& RegionFactory::setCompressor(
+    const std::shared_ptr<Compressor>& aCompressor) {
+  m_regionAttributesFactory->setCompressor(aCompressor);
+  return *this;
+}
 
 RegionFactory& RegionFactory::setCacheLoader(const std::string& lib,
                                              const std::string& func) {
@@ -125,6 +130,12 @@ RegionFactory& RegionFactory::setPartitionResolver(const std::string& lib,
   return *this;
 }
 
+RegionFactory& RegionFactory::setCompressor(const std::string& lib,
+                                            const std::string& func) {
+  m_regionAttributesFactory->setCompressor(lib, func);
+  return *this;
+}
+
 RegionFactory& RegionFactory::setEntryIdleTimeout(
     ExpirationAction action, std::chrono::seconds idleTimeout) {
   m_regionAttributesFactory->setEntryIdleTimeout(action, idleTimeout);
@@ -170,11 +181,29 @@ RegionFactory& RegionFactory::setConcurrencyChecksEnabled(bool enable) {
   m_regionAttributesFactory->setConcurrencyChecksEnabled(enable);
   return *this;
 }
+
+RegionFactory& RegionFactory::setSubscriptionConflationEnabled(bool enable) {
+  m_regionAttributesFactory->setSubscriptionConflationEnabled(enable);
+  return *this;
+}
+
 RegionFactory& RegionFactory::setLruEntriesLimit(const uint32_t entriesLimit) {
   m_regionAttributesFactory->setLruEntriesLimit(entriesLimit);
   return *this;
 }
 
+RegionFactory& RegionFactory::setNegativeCacheEntriesLimit(
+    const uint32_t entriesLimit) {
+  m_regionAttributesFactory->setNegativeCacheEntriesLimit(entriesLimit);
+  return *this;
+}
+
+RegionFactory& RegionFactory::setNegativeCacheTimeToLive(
+    std::chrono::milliseconds timeToLive) {
+  m_regionAttributesFactory->setNegativeCacheTimeToLive(timeToLive);
+  return *this;
+}
+
 RegionFactory& RegionFactory::setDiskPolicy(const DiskPolicyType diskPolicy) {
   m_regionAttributesFactory->setDiskPolicy(diskPolicy);
   return *this;
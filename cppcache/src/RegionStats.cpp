@@ -22,17 +22,20 @@ namespace geode {
 namespace client {
 
 using statistics::StatisticsFactory;
+using statistics::StatisticsManager;
 
 constexpr const char* RegionStats::STATS_NAME;
 constexpr const char* RegionStats::STATS_DESC;
 
 RegionStats::RegionStats(StatisticsFactory* factory,
-                         const std::string& regionName) {
+                         const std::string& regionName,
+                         StatisticsManager* latencyHistograms)
+    : m_latencyHistograms(latencyHistograms) {
   auto statsType = factory->findType(STATS_NAME);
 
   if (!statsType) {
     const bool largerIsBetter = true;
-    std::vector<std::shared_ptr<StatisticDescriptor>> stats(25);
+    std::vector<std::shared_ptr<StatisticDescriptor>> stats(39);
     stats[0] = factory->createIntCounter(
         "creates", "The total number of cache creates for this region",
         "entries", largerIsBetter);
@@ -127,6 +130,74 @@ RegionStats::RegionStats(StatisticsFactory* factory,
         "removeAllTime",
         "Total time spent doing removeAlls operations for this region",
         "Nanoseconds", !largerIsBetter);
+    stats[25] = factory->createIntCounter(
+        "singleHopMisroutes",
+        "The total number of single hop operations the server had to forward "
+        "because the client metadata for this region was out of date",
+        "operations", !largerIsBetter);
+    stats[26] = factory->createIntCounter(
+        "metaDataBucketUpdates",
+        "The total number of buckets whose server locations changed in "
+        "metadata refreshes for this region",
+        "buckets", !largerIsBetter);
+    stats[27] = factory->createIntCounter(
+        "interestInitialEntries",
+        "The total number of initial values of interest registrations added "
+        "to this region",
+        "entries", largerIsBetter);
+    stats[28] = factory->createLongCounter(
+        "interestInitialLoadTime",
+        "Total time spent adding initial values of interest registrations "
+        "to this region",
+        "Nanoseconds", !largerIsBetter);
+    stats[29] = factory->createIntCounter(
+        "compressions",
+        "The total number of values compressed into the local cache of this "
+        "region",
+        "operations", !largerIsBetter);
+    stats[30] = factory->createLongCounter(
+        "compressTime",
+        "Total time spent compressing values for the local cache of this "
+        "region",
+        "Nanoseconds", !largerIsBetter);
+    stats[31] = factory->createIntCounter(
+        "decompressions",
+        "The total number of values decompressed from the local cache of this "
+        "region",
+        "operations", !largerIsBetter);
+    stats[32] = factory->createLongCounter(
+        "decompressTime",
+        "Total time spent decompressing values from the local cache of this "
+        "region",
+        "Nanoseconds", !largerIsBetter);
+    stats[33] = factory->createLongCounter(
+        "preCompressedBytes",
+        "The total serialized size of the values compressed for this region",
+        "bytes", !largerIsBetter);
+    stats[34] = factory->createLongCounter(
+        "postCompressedBytes",
+        "The total compressed size of the values compressed for this region",
+        "bytes", !largerIsBetter);
+    stats[35] = factory->createIntCounter(
+        "negativeCacheHits",
+        "The total number of gets of this region answered by its negative "
+        "lookup cache, without asking the server",
+        "operations", largerIsBetter);
+    stats[36] = factory->createIntCounter(
+        "negativeCacheMisses",
+        "The total number of gets of this region sent to the server because "
+        "the key was not in its negative lookup cache",
+        "operations", !largerIsBetter);
+    stats[37] = factory->createIntCounter(
+        "subscriptionEventsQueued",
+        "The total number of create and update subscription events queued "
+        "for this region because subscription-conflation-enabled is set",
+        "events", !largerIsBetter);
+    stats[38] = factory->createIntCounter(
+        "subscriptionEventsConflated",
+        "The total number of queued subscription events for this region that "
+        "were replaced by a later update of the same key before being applied",
+        "events", largerIsBetter);
     statsType = factory->createType(STATS_NAME, STATS_DESC, std::move(stats));
   }
 
@@ -148,6 +219,22 @@ RegionStats::RegionStats(StatisticsFactory* factory,
   m_overflowsId = statsType->nameToId("overflows");
   m_retrievesId = statsType->nameToId("retrieves");
   m_metaDataRefreshId = statsType->nameToId("metaDataRefreshCount");
+  m_singleHopMisroutesId = statsType->nameToId("singleHopMisroutes");
+  m_metaDataBucketUpdatesId = statsType->nameToId("metaDataBucketUpdates");
+  m_interestInitialEntriesId = statsType->nameToId("interestInitialEntries");
+  m_interestInitialLoadTimeId = statsType->nameToId("interestInitialLoadTime");
+  m_compressionsId = statsType->nameToId("compressions");
+  m_compressTimeId = statsType->nameToId("compressTime");
+  m_decompressionsId = statsType->nameToId("decompressions");
+  m_decompressTimeId = statsType->nameToId("decompressTime");
+  m_preCompressedBytesId = statsType->nameToId("preCompressedBytes");
+  m_postCompressedBytesId = statsType->nameToId("postCompressedBytes");
+  m_negativeCacheHitsId = statsType->nameToId("negativeCacheHits");
+  m_negativeCacheMissesId = statsType->nameToId("negativeCacheMisses");
+  m_subscriptionEventsQueuedId =
+      statsType->nameToId("subscriptionEventsQueued");
+  m_subscriptionEventsConflatedId =
+      statsType->nameToId("subscriptionEventsConflated");
   m_LoaderCallsCompletedId = statsType->nameToId("cacheLoaderCallsCompleted");
   m_LoaderCallTimeId = statsType->nameToId("cacheLoaderCallTIme");
   m_WriterCallsCompletedId = statsType->nameToId("cacheWriterCallsCompleted");
@@ -178,6 +265,20 @@ RegionStats::RegionStats(StatisticsFactory* factory,
   m_regionStats->setInt(m_overflowsId, 0);
   m_regionStats->setInt(m_retrievesId, 0);
   m_regionStats->setInt(m_metaDataRefreshId, 0);
+  m_regionStats->setInt(m_singleHopMisroutesId, 0);
+  m_regionStats->setInt(m_metaDataBucketUpdatesId, 0);
+  m_regionStats->setInt(m_interestInitialEntriesId, 0);
+  m_regionStats->setLong(m_interestInitialLoadTimeId, 0);
+  m_regionStats->setInt(m_compressionsId, 0);
+  m_regionStats->setLong(m_compressTimeId, 0);
+  m_regionStats->setInt(m_decompressionsId, 0);
+  m_regionStats->setLong(m_decompressTimeId, 0);
+  m_regionStats->setLong(m_preCompressedBytesId, 0);
+  m_regionStats->setLong(m_postCompressedBytesId, 0);
+  m_regionStats->setInt(m_negativeCacheHitsId, 0);
+  m_regionStats->setInt(m_negativeCacheMissesId, 0);
+  m_regionStats->setInt(m_subscriptionEventsQueuedId, 0);
+  m_regionStats->setInt(m_subscriptionEventsConflatedId, 0);
   m_regionStats->setInt(m_LoaderCallsCompletedId, 0);
   m_regionStats->setInt(m_LoaderCallTimeId, 0);
   m_regionStats->setInt(m_WriterCallsCompletedId, 0);
@@ -185,6 +286,35 @@ RegionStats::RegionStats(StatisticsFactory* factory,
   m_regionStats->setInt(m_ListenerCallsCompletedId, 0);
   m_regionStats->setInt(m_ListenerCallTimeId, 0);
   m_regionStats->setInt(m_clearsId, 0);
+
+  if (m_latencyHistograms) {
+    auto histogram =
+        [&](const char* operation) -> std::unique_ptr<LatencyHistogram> {
+          auto latency = std::unique_ptr<LatencyHistogram>(
+              new LatencyHistogram(
+                  factory,
+                  std::string(STATS_NAME) + "_" + operation + "Latency",
+                  regionName));
+          m_latencyHistograms->addLatencyHistogram(latency.get());
+          return latency;
+        };
+    m_getLatency = histogram("get");
+    m_putLatency = histogram("put");
+    m_getAllLatency = histogram("getAll");
+  }
+}
+
+void RegionStats::close() {
+  m_regionStats->close();
+  if (m_latencyHistograms) {
+    m_latencyHistograms->removeLatencyHistogram(m_getLatency.get());
+    m_latencyHistograms->removeLatencyHistogram(m_putLatency.get());
+    m_latencyHistograms->removeLatencyHistogram(m_getAllLatency.get());
+    m_latencyHistograms = nullptr;
+    m_getLatency->close();
+    m_putLatency->close();
+    m_getAllLatency->close();
+  }
 }
 
 RegionStats::~RegionStats() {
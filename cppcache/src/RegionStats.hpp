@@ -20,31 +20,40 @@
 #ifndef GEODE_REGIONSTATS_H_
 #define GEODE_REGIONSTATS_H_
 
+#include <memory>
 #include <string>
 
 #include <geode/internal/geode_globals.hpp>
 
+#include "statistics/LatencyHistogram.hpp"
 #include "statistics/Statistics.hpp"
 #include "statistics/StatisticsFactory.hpp"
+#include "statistics/StatisticsManager.hpp"
 
 namespace apache {
 namespace geode {
 namespace client {
 
+using statistics::LatencyHistogram;
 using statistics::StatisticDescriptor;
 using statistics::Statistics;
 using statistics::StatisticsType;
 
 class RegionStats {
  public:
-  /** hold statistics for a region.. */
+  /**
+   * hold statistics for a region. Latency histograms for get, put and getAll
+   * are only created, and registered with latencyHistograms for the
+   * OpenMetrics exporter, when latencyHistograms is not nullptr.
+   */
   RegionStats(statistics::StatisticsFactory* factory,
-              const std::string& regionName);
+              const std::string& regionName,
+              statistics::StatisticsManager* latencyHistograms = nullptr);
 
   /** disable stat collection for this item. */
   virtual ~RegionStats();
 
-  void close() { m_regionStats->close(); }
+  void close();
 
   inline void incDestroys() { m_regionStats->incInt(m_destroysId, 1); }
 
@@ -72,6 +81,51 @@ class RegionStats {
     m_regionStats->incInt(m_metaDataRefreshId, 1);
   }
 
+  inline void incSingleHopMisroutes() {
+    m_regionStats->incInt(m_singleHopMisroutesId, 1);
+  }
+
+  inline void incMetaDataBucketUpdates(int32_t buckets) {
+    m_regionStats->incInt(m_metaDataBucketUpdatesId, buckets);
+  }
+
+  inline void incInterestInitialEntries(int32_t entries) {
+    m_regionStats->incInt(m_interestInitialEntriesId, entries);
+  }
+
+  inline void incInterestInitialLoadTime(int64_t nanos) {
+    m_regionStats->incLong(m_interestInitialLoadTimeId, nanos);
+  }
+
+  inline void incCompressions(int64_t preBytes, int64_t postBytes,
+                              int64_t nanos) {
+    m_regionStats->incInt(m_compressionsId, 1);
+    m_regionStats->incLong(m_preCompressedBytesId, preBytes);
+    m_regionStats->incLong(m_postCompressedBytesId, postBytes);
+    m_regionStats->incLong(m_compressTimeId, nanos);
+  }
+
+  inline void incDecompressions(int64_t nanos) {
+    m_regionStats->incInt(m_decompressionsId, 1);
+    m_regionStats->incLong(m_decompressTimeId, nanos);
+  }
+
+  inline void incNegativeCacheHits() {
+    m_regionStats->incInt(m_negativeCacheHitsId, 1);
+  }
+
+  inline void incNegativeCacheMisses() {
+    m_regionStats->incInt(m_negativeCacheMissesId, 1);
+  }
+
+  inline void incSubscriptionEventsQueued() {
+    m_regionStats->incInt(m_subscriptionEventsQueuedId, 1);
+  }
+
+  inline void incSubscriptionEventsConflated() {
+    m_regionStats->incInt(m_subscriptionEventsConflatedId, 1);
+  }
+
   inline void setEntries(int32_t entries) {
     m_regionStats->setInt(m_entriesId, entries);
   }
@@ -114,8 +168,21 @@ class RegionStats {
 
   inline int32_t getClearsId() { return m_clearsId; }
 
+  /** @return get latency histogram, nullptr unless enabled */
+  inline LatencyHistogram* getGetLatency() { return m_getLatency.get(); }
+
+  /** @return put latency histogram, nullptr unless enabled */
+  inline LatencyHistogram* getPutLatency() { return m_putLatency.get(); }
+
+  /** @return getAll latency histogram, nullptr unless enabled */
+  inline LatencyHistogram* getGetAllLatency() { return m_getAllLatency.get(); }
+
  private:
   apache::geode::statistics::Statistics* m_regionStats;
+  statistics::StatisticsManager* m_latencyHistograms;
+  std::unique_ptr<LatencyHistogram> m_getLatency;
+  std::unique_ptr<LatencyHistogram> m_putLatency;
+  std::unique_ptr<LatencyHistogram> m_getAllLatency;
 
   int32_t m_destroysId;
   int32_t m_createsId;
@@ -135,6 +202,20 @@ class RegionStats {
   int32_t m_overflowsId;
   int32_t m_retrievesId;
   int32_t m_metaDataRefreshId;
+  int32_t m_singleHopMisroutesId;
+  int32_t m_metaDataBucketUpdatesId;
+  int32_t m_interestInitialEntriesId;
+  int32_t m_interestInitialLoadTimeId;
+  int32_t m_compressionsId;
+  int32_t m_compressTimeId;
+  int32_t m_decompressionsId;
+  int32_t m_decompressTimeId;
+  int32_t m_preCompressedBytesId;
+  int32_t m_postCompressedBytesId;
+  int32_t m_negativeCacheHitsId;
+  int32_t m_negativeCacheMissesId;
+  int32_t m_subscriptionEventsQueuedId;
+  int32_t m_subscriptionEventsConflatedId;
   int32_t m_LoaderCallsCompletedId;
   int32_t m_LoaderCallTimeId;
   int32_t m_WriterCallsCompletedId;
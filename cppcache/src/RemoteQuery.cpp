@@ -20,6 +20,7 @@
 #include <boost/thread/lock_types.hpp>
 
 #include "ResultSetImpl.hpp"
+#include "SelectResultsStreamImpl.hpp"
 #include "StructSetImpl.hpp"
 #include "TcrConnectionManager.hpp"
 #include "ThinClientPoolDM.hpp"
@@ -114,11 +115,55 @@ std::shared_ptr<SelectResults> RemoteQuery::execute(
   if (pool && enableTimeStatistics) {
     Utils::updateStatOpTime(pool->getStats().getStats(),
                             pool->getStats().getQueryExecutionTimeId(),
-                            sampleStartNanos);
+                            sampleStartNanos,
+                            pool->getStats().getQueryLatency());
   }
   return sr;
 }
 
+std::shared_ptr<SelectResultsStream> RemoteQuery::stream(
+    std::shared_ptr<CacheableVector> paramList,
+    std::chrono::milliseconds timeout, size_t prefetchChunks) {
+  util::PROTOCOL_OPERATION_TIMEOUT_BOUNDS(timeout);
+  auto results = std::make_shared<SelectResultsStreamImpl>(prefetchChunks);
+
+  // The reply is read on the stream's thread, which may outlive this query.
+  auto query = std::make_shared<RemoteQuery>(m_queryString, m_queryService,
+                                             m_tccdm, m_authenticatedView);
+  if (auto pool = dynamic_cast<ThinClientPoolDM*>(m_tccdm)) {
+    pool->addQueryStream(results);
+  }
+  auto stream = results.get();
+  results->start([query, stream, paramList, timeout]() {
+    try {
+      GuardUserAttributes gua;
+      if (query->m_authenticatedView) {
+        gua.setAuthenticatedView(query->m_authenticatedView);
+      }
+      query->streamResults(timeout, *stream, paramList);
+      stream->finish(nullptr);
+    } catch (...) {
+      stream->finish(std::current_exception());
+    }
+  });
+  return results;
+}
+
+void RemoteQuery::streamResults(std::chrono::milliseconds timeout,
+                                SelectResultsStreamImpl& stream,
+                                std::shared_ptr<CacheableVector> paramList) {
+  if (auto pool = dynamic_cast<ThinClientPoolDM*>(m_tccdm)) {
+    pool->getStats().incQueryExecutionId();
+  }
+
+  TcrMessageReply reply(true, m_tccdm);
+  ChunkedQueryStreamResponse resultCollector(reply, stream);
+  reply.setChunkedResultHandler(&resultCollector);
+  auto err =
+      executeNoThrow(timeout, reply, "Query::stream", m_tccdm, paramList);
+  throwExceptionIfError("Query::stream", err);
+}
+
 GfErrType RemoteQuery::executeNoThrow(
     std::chrono::milliseconds timeout, TcrMessageReply& reply, const char* func,
     ThinClientBaseDM* tcdm, std::shared_ptr<CacheableVector> paramList) {
@@ -37,6 +37,7 @@ namespace apache {
 namespace geode {
 namespace client {
 
+class SelectResultsStreamImpl;
 class ThinClientBaseDM;
 
 class RemoteQuery : public Query {
@@ -70,6 +71,11 @@ class RemoteQuery : public Query {
       std::chrono::milliseconds timeout, const char* func,
       ThinClientBaseDM* tcdm, std::shared_ptr<CacheableVector> paramList);
 
+  std::shared_ptr<SelectResultsStream> stream(
+      std::shared_ptr<CacheableVector> paramList = nullptr,
+      std::chrono::milliseconds timeout = DEFAULT_QUERY_RESPONSE_TIMEOUT,
+      size_t prefetchChunks = 4) override;
+
   // nothrow version of execute()
   GfErrType executeNoThrow(std::chrono::milliseconds timeout,
                            TcrMessageReply& reply, const char* func,
@@ -81,6 +87,11 @@ class RemoteQuery : public Query {
   void compile() override;
 
   bool isCompiled() override;
+
+ private:
+  void streamResults(std::chrono::milliseconds timeout,
+                     SelectResultsStreamImpl& stream,
+                     std::shared_ptr<CacheableVector> paramList);
 };
 
 }  // namespace client
@@ -0,0 +1,162 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "SelectResultsStreamImpl.hpp"
+
+#include <geode/ExceptionTypes.hpp>
+#include <geode/Struct.hpp>
+
+#include "StructSetImpl.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+SelectResultsStreamImpl::SelectResultsStreamImpl(size_t prefetchChunks)
+    : prefetchChunks_(prefetchChunks > 0 ? prefetchChunks : 1),
+      cancelled_(false),
+      delivered_(false),
+      finished_(false),
+      closed_(false),
+      position_(0) {}
+
+SelectResultsStreamImpl::~SelectResultsStreamImpl() noexcept { close(); }
+
+bool SelectResultsStreamImpl::next(std::shared_ptr<Serializable>& result) {
+  if (!cancelled_ && position_ < current_.size()) {
+    result = std::move(current_[position_++]);
+    return true;
+  }
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  changed_.wait(lock,
+                [this] { return !chunks_.empty() || finished_ || cancelled_; });
+  if (!chunks_.empty()) {
+    current_ = std::move(chunks_.front());
+    chunks_.pop_front();
+    delivered_ = true;
+    changed_.notify_all();
+    lock.unlock();
+
+    position_ = 0;
+    result = std::move(current_[position_++]);
+    return true;
+  }
+
+  current_.clear();
+  if (error_) {
+    std::rethrow_exception(error_);
+  }
+  return false;
+}
+
+void SelectResultsStreamImpl::cancel() {
+  std::lock_guard<std::mutex> guard(mutex_);
+  cancelled_ = true;
+  chunks_.clear();
+  changed_.notify_all();
+}
+
+void SelectResultsStreamImpl::start(std::function<void()> reader) {
+  std::lock_guard<std::mutex> guard(mutex_);
+  if (closed_) {
+    finished_ = true;
+    error_ = std::make_exception_ptr(
+        CacheClosedException("Query::stream: pool is closed"));
+    return;
+  }
+  thread_ = std::thread(std::move(reader));
+}
+
+void SelectResultsStreamImpl::close() {
+  {
+    std::lock_guard<std::mutex> guard(mutex_);
+    closed_ = true;
+    cancelled_ = true;
+    chunks_.clear();
+    changed_.notify_all();
+  }
+  // thread_ is not assigned anymore once closed_ is set.
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+}
+
+void SelectResultsStreamImpl::push(const std::vector<std::string>& fieldNames,
+                                   CacheableVector& values) {
+  if (values.empty() || cancelled_) {
+    values.clear();
+    return;
+  }
+
+  std::vector<std::shared_ptr<Serializable>> rows;
+  if (fieldNames.empty()) {
+    rows.assign(std::make_move_iterator(values.begin()),
+                std::make_move_iterator(values.end()));
+  } else {
+    const auto numOfFields = fieldNames.size();
+    if (values.size() % numOfFields != 0) {
+      throw MessageException(
+          "Query::stream: Number of values coming from server has to be "
+          "exactly divisible by field count");
+    }
+    if (!structSet_) {
+      structSet_ = std::make_shared<StructSetImpl>(CacheableVector::create(),
+                                                   fieldNames);
+    }
+    rows.reserve(values.size() / numOfFields);
+    for (auto value = values.begin(); value != values.end();
+         value += numOfFields) {
+      std::vector<std::shared_ptr<Serializable>> fieldValues(
+          value, value + numOfFields);
+      rows.push_back(std::make_shared<Struct>(structSet_, fieldValues));
+    }
+  }
+  values.clear();
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  changed_.wait(
+      lock, [this] { return chunks_.size() < prefetchChunks_ || cancelled_; });
+  if (!cancelled_) {
+    chunks_.push_back(std::move(rows));
+    changed_.notify_all();
+  }
+}
+
+void SelectResultsStreamImpl::restart() {
+  std::lock_guard<std::mutex> guard(mutex_);
+  chunks_.clear();
+  if (delivered_ && !cancelled_) {
+    error_ = std::make_exception_ptr(
+        MessageException("Query::stream: query was retried on another server "
+                         "after some of its results were read"));
+    cancelled_ = true;
+  }
+  changed_.notify_all();
+}
+
+void SelectResultsStreamImpl::finish(std::exception_ptr error) {
+  std::lock_guard<std::mutex> guard(mutex_);
+  finished_ = true;
+  if (!error_ && !cancelled_) {
+    error_ = error;
+  }
+  changed_.notify_all();
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
@@ -0,0 +1,113 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#ifndef GEODE_SELECTRESULTSSTREAMIMPL_H_
+#define GEODE_SELECTRESULTSSTREAMIMPL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <geode/CacheableBuiltins.hpp>
+#include <geode/SelectResultsStream.hpp>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+class StructSetImpl;
+
+/**
+ * Hands the results of a query from the thread reading its reply to the
+ * reader of the stream, one chunk of results at a time.
+ */
+class SelectResultsStreamImpl : public SelectResultsStream {
+ public:
+  explicit SelectResultsStreamImpl(size_t prefetchChunks);
+
+  ~SelectResultsStreamImpl() noexcept override;
+
+  SelectResultsStreamImpl(const SelectResultsStreamImpl&) = delete;
+  SelectResultsStreamImpl& operator=(const SelectResultsStreamImpl&) = delete;
+
+  bool next(std::shared_ptr<Serializable>& result) override;
+
+  void cancel() override;
+
+  /**
+   * Runs reader, which reads the reply and then calls finish(), unless the
+   * stream is closed already.
+   */
+  void start(std::function<void()> reader);
+
+  /**
+   * Cancels the stream and waits for its reader to finish. Once closed, the
+   * stream is not started anymore.
+   */
+  void close();
+
+  bool isCancelled() const { return cancelled_; }
+
+  /**
+   * Queues the values read from one chunk, as Structs if fieldNames is not
+   * empty, and clears them. Waits while prefetchChunks chunks are queued.
+   */
+  void push(const std::vector<std::string>& fieldNames,
+            CacheableVector& values);
+
+  /**
+   * Drops the queued chunks when the query is retried on another server. The
+   * stream fails if results have been read already.
+   */
+  void restart();
+
+  void finish(std::exception_ptr error);
+
+ private:
+  const size_t prefetchChunks_;
+  std::mutex mutex_;
+  std::condition_variable changed_;
+  std::deque<std::vector<std::shared_ptr<Serializable>>> chunks_;
+  std::atomic<bool> cancelled_;
+  bool delivered_;
+  bool finished_;
+  bool closed_;
+  std::exception_ptr error_;
+
+  // Owned by the reader of the stream.
+  std::vector<std::shared_ptr<Serializable>> current_;
+  size_t position_;
+
+  // Owned by the thread reading the reply.
+  std::shared_ptr<StructSetImpl> structSet_;
+
+  std::thread thread_;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_SELECTRESULTSSTREAMIMPL_H_
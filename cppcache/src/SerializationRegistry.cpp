@@ -17,7 +17,9 @@
 
 #include "SerializationRegistry.hpp"
 
+#include <atomic>
 #include <functional>
+#include <limits>
 #include <mutex>
 
 #include <geode/CacheableBuiltins.hpp>
@@ -342,6 +344,55 @@ void SerializationRegistry::deserialize(
   }
 }
 
+void SerializationRegistry::serializeUntagged(
+    const std::shared_ptr<Serializable>& obj, DataOutput& output,
+    bool isDelta) const {
+  if (const auto&& pdxSerializable =
+          std::dynamic_pointer_cast<PdxSerializable>(obj)) {
+    serialize(pdxSerializable, output);
+  } else if (const auto&& dataSerializableFixedId =
+                 std::dynamic_pointer_cast<DataSerializableFixedId>(obj)) {
+    serialize(dataSerializableFixedId, output);
+  } else if (const auto&& dataSerializablePrimitive =
+                 std::dynamic_pointer_cast<DataSerializablePrimitive>(obj)) {
+    serialize(dataSerializablePrimitive, output);
+  } else if (const auto&& dataSerializable =
+                 std::dynamic_pointer_cast<DataSerializable>(obj)) {
+    dataSerializableHandler_->serialize(dataSerializable, output, isDelta);
+  } else if (const auto&& dataSerializableInternal =
+                 std::dynamic_pointer_cast<DataSerializableInternal>(obj)) {
+    serialize(dataSerializableInternal, output);
+  } else {
+    throw UnsupportedOperationException(
+        "SerializationRegistry::serialize: Serialization type not "
+        "implemented.");
+  }
+}
+
+void SerializationRegistry::serializeWithoutHeaderUntagged(
+    const std::shared_ptr<Serializable>& obj, DataOutput& output) const {
+  if (const auto&& pdxSerializable =
+          std::dynamic_pointer_cast<PdxSerializable>(obj)) {
+    serializeWithoutHeader(pdxSerializable, output);
+  } else if (const auto&& dataSerializableFixedId =
+                 std::dynamic_pointer_cast<DataSerializableFixedId>(obj)) {
+    serializeWithoutHeader(dataSerializableFixedId, output);
+  } else if (const auto&& dataSerializablePrimitive =
+                 std::dynamic_pointer_cast<DataSerializablePrimitive>(obj)) {
+    serializeWithoutHeader(dataSerializablePrimitive, output);
+  } else if (const auto&& dataSerializable =
+                 std::dynamic_pointer_cast<DataSerializable>(obj)) {
+    serializeWithoutHeader(dataSerializable, output);
+  } else if (const auto&& dataSerializableInternal =
+                 std::dynamic_pointer_cast<DataSerializableInternal>(obj)) {
+    serializeWithoutHeader(dataSerializableInternal, output);
+  } else {
+    throw UnsupportedOperationException(
+        "SerializationRegistry::serializeWithoutHeader: Serialization type "
+        "not implemented.");
+  }
+}
+
 void SerializationRegistry::serializeWithoutHeader(
     const std::shared_ptr<PdxSerializable>& obj, DataOutput& output) const {
   pdxTypeHandler_->serialize(obj, output);
@@ -437,88 +488,166 @@ std::shared_ptr<Serializable> SerializationRegistry::GetEnum(
   return static_cast<ThinClientPoolDM*>(pool.get())->GetEnum(val);
 }
 
-void TheTypeMap::clear() {
-  const std::lock_guard<std::mutex> guard(dataSerializableMapMutex_);
-  dataSerializableMap_.clear();
+namespace {
+
+std::atomic<uint64_t> typeMapVersions{0};
+
+uint64_t nextTypeMapVersion() { return ++typeMapVersions; }
+
+inline bool isByteFixedId(DSFid dsfid) {
+  return static_cast<int32_t>(dsfid) >= std::numeric_limits<int8_t>::min() &&
+         static_cast<int32_t>(dsfid) <= std::numeric_limits<int8_t>::max();
+}
+
+inline size_t byteFixedIdIndex(DSFid dsfid) {
+  return static_cast<size_t>(static_cast<int32_t>(dsfid) -
+                             std::numeric_limits<int8_t>::min());
+}
+
+inline size_t primitiveIndex(DSCode dsCode) {
+  return static_cast<uint8_t>(dsCode);
+}
 
-  const std::lock_guard<std::mutex> guard2(dataSerializableFixedIdMapMutex_);
-  dataSerializableFixedIdMap_.clear();
+}  // namespace
 
-  const std::lock_guard<std::mutex> guard3(pdxSerializableMapMutex_);
-  pdxSerializableMap_.clear();
+TheTypeMap::TheTypeMap()
+    : snapshot_(std::make_shared<Snapshot>()),
+      version_(nextTypeMapVersion()) {
+  setup();
+}
+
+const TheTypeMap::Snapshot& TheTypeMap::snapshot() const {
+  // Versions are unique across all type maps, so a cached snapshot can never
+  // be mistaken for that of another map. A reader racing with a writer may
+  // pair the old version with the new snapshot; it then reloads once more.
+  struct Cached {
+    uint64_t version = 0;
+    std::shared_ptr<const Snapshot> snapshot;
+  };
+  static thread_local Cached cached;
+
+  const auto version = version_.load(std::memory_order_acquire);
+  if (cached.version != version) {
+    cached.snapshot = std::atomic_load(&snapshot_);
+    cached.version = version;
+  }
+  return *cached.snapshot;
+}
+
+template <class Mutator>
+void TheTypeMap::update(Mutator&& mutator) {
+  const std::lock_guard<std::mutex> guard(updateMutex_);
+  auto next = std::make_shared<Snapshot>(*std::atomic_load(&snapshot_));
+  mutator(*next);
+  std::atomic_store(&snapshot_,
+                    std::shared_ptr<const Snapshot>(std::move(next)));
+  version_.store(nextTypeMapVersion(), std::memory_order_release);
+}
+
+void TheTypeMap::clear() {
+  update([](Snapshot& next) {
+    next.dataSerializables.clear();
+    next.dataSerializableFixedIds.clear();
+    next.dataSerializableByteFixedIds.fill(nullptr);
+    next.pdxSerializables.clear();
+  });
 }
 
 void TheTypeMap::findDataSerializable(int32_t id,
                                       TypeFactoryMethod& func) const {
-  const std::lock_guard<std::mutex> guard(dataSerializableMapMutex_);
-  const auto& found = dataSerializableMap_.find(id);
-  if (found != dataSerializableMap_.end()) {
+  const auto& dataSerializables = snapshot().dataSerializables;
+  const auto& found = dataSerializables.find(id);
+  if (found != dataSerializables.end()) {
     func = found->second;
   }
 }
 
+bool TheTypeMap::findDataSerializableClassId(std::type_index type,
+                                             int32_t& id) const {
+  const auto& typeToClassId = snapshot().typeToClassId;
+  const auto& found = typeToClassId.find(type);
+  if (found == typeToClassId.end()) {
+    return false;
+  }
+  id = found->second;
+  return true;
+}
+
 void TheTypeMap::findDataSerializableFixedId(DSFid dsfid,
                                              TypeFactoryMethod& func) const {
-  const std::lock_guard<std::mutex> guard(dataSerializableFixedIdMapMutex_);
-  const auto& found = dataSerializableFixedIdMap_.find(dsfid);
-  if (found != dataSerializableFixedIdMap_.end()) {
+  const auto& current = snapshot();
+  if (isByteFixedId(dsfid)) {
+    const auto& found =
+        current.dataSerializableByteFixedIds[byteFixedIdIndex(dsfid)];
+    if (found) {
+      func = found;
+    }
+    return;
+  }
+
+  const auto& found = current.dataSerializableFixedIds.find(dsfid);
+  if (found != current.dataSerializableFixedIds.end()) {
     func = found->second;
   }
 }
 
 void TheTypeMap::findDataSerializablePrimitive(DSCode dsCode,
                                                TypeFactoryMethod& func) const {
-  const std::lock_guard<std::mutex> guard(dataSerializablePrimitiveMapMutex_);
-  const auto& found = dataSerializablePrimitiveMap_.find(dsCode);
-  if (found != dataSerializablePrimitiveMap_.end()) {
-    func = found->second;
+  const auto& found =
+      snapshot().dataSerializablePrimitives[primitiveIndex(dsCode)];
+  if (found) {
+    func = found;
   }
 }
 
 void TheTypeMap::bindDataSerializable(TypeFactoryMethod func, int32_t id) {
   auto obj = func();
 
-  if (const auto dataSerializable =
-          std::dynamic_pointer_cast<DataSerializable>(obj)) {
-    typeToClassId_.emplace(dataSerializable->getType(), id);
-  } else {
+  const auto dataSerializable =
+      std::dynamic_pointer_cast<DataSerializable>(obj);
+  if (!dataSerializable) {
     throw UnsupportedOperationException(
         "TheTypeMap::bind: Serialization type not implemented.");
   }
 
-  const std::lock_guard<std::mutex> guard(dataSerializableMapMutex_);
-  const auto& result = dataSerializableMap_.emplace(id, func);
-  if (!result.second) {
-    LOGERROR("A class with ID %d is already registered.", id);
-    throw IllegalStateException("A class with given ID is already registered.");
-  }
+  update([&](Snapshot& next) {
+    next.typeToClassId.emplace(dataSerializable->getType(), id);
+
+    const auto& result = next.dataSerializables.emplace(id, func);
+    if (!result.second) {
+      LOGERROR("A class with ID %d is already registered.", id);
+      throw IllegalStateException(
+          "A class with given ID is already registered.");
+    }
+  });
 }
 
 void TheTypeMap::rebindDataSerializable(int32_t id, TypeFactoryMethod func) {
-  const std::lock_guard<std::mutex> guard(dataSerializableMapMutex_);
-  dataSerializableMap_[id] = func;
+  update([&](Snapshot& next) { next.dataSerializables[id] = func; });
 }
 
 void TheTypeMap::unbindDataSerializable(int32_t id) {
-  const std::lock_guard<std::mutex> guard(dataSerializableMapMutex_);
-  dataSerializableMap_.erase(id);
+  update([&](Snapshot& next) { next.dataSerializables.erase(id); });
 }
 
 void TheTypeMap::bindDataSerializablePrimitive(TypeFactoryMethod func,
                                                DSCode dsCode) {
-  const std::lock_guard<std::mutex> guard(dataSerializablePrimitiveMapMutex_);
-  const auto& result = dataSerializablePrimitiveMap_.emplace(dsCode, func);
-  if (!result.second) {
-    LOGERROR("A class with DSCode %d is already registered.", dsCode);
-    throw IllegalStateException(
-        "A class with given DSCode is already registered.");
-  }
+  update([&](Snapshot& next) {
+    auto& slot = next.dataSerializablePrimitives[primitiveIndex(dsCode)];
+    if (slot) {
+      LOGERROR("A class with DSCode %d is already registered.", dsCode);
+      throw IllegalStateException(
+          "A class with given DSCode is already registered.");
+    }
+    slot = func;
+  });
 }
 
 void TheTypeMap::rebindDataSerializablePrimitive(DSCode dsCode,
                                                  TypeFactoryMethod func) {
-  const std::lock_guard<std::mutex> guard(dataSerializablePrimitiveMapMutex_);
-  dataSerializablePrimitiveMap_[dsCode] = func;
+  update([&](Snapshot& next) {
+    next.dataSerializablePrimitives[primitiveIndex(dsCode)] = func;
+  });
 }
 
 void TheTypeMap::bindDataSerializableFixedId(TypeFactoryMethod func) {
@@ -534,46 +663,67 @@ void TheTypeMap::bindDataSerializableFixedId(TypeFactoryMethod func) {
         "type.");
   }
 
-  const std::lock_guard<std::mutex> guard(dataSerializableFixedIdMapMutex_);
-  const auto& result = dataSerializableFixedIdMap_.emplace(id, func);
-  if (!result.second) {
-    LOGERROR("A fixed class with ID %d is already registered.", id);
-    throw IllegalStateException(
-        "A fixed class with given ID is already registered.");
-  }
+  update([&](Snapshot& next) {
+    bool registered;
+    if (isByteFixedId(id)) {
+      auto& slot = next.dataSerializableByteFixedIds[byteFixedIdIndex(id)];
+      registered = static_cast<bool>(slot);
+      if (!registered) {
+        slot = func;
+      }
+    } else {
+      registered = !next.dataSerializableFixedIds.emplace(id, func).second;
+    }
+
+    if (registered) {
+      LOGERROR("A fixed class with ID %d is already registered.", id);
+      throw IllegalStateException(
+          "A fixed class with given ID is already registered.");
+    }
+  });
 }
 
 void TheTypeMap::rebindDataSerializableFixedId(internal::DSFid id,
                                                TypeFactoryMethod func) {
-  const std::lock_guard<std::mutex> guard(dataSerializableFixedIdMapMutex_);
-  dataSerializableFixedIdMap_[id] = func;
+  update([&](Snapshot& next) {
+    if (isByteFixedId(id)) {
+      next.dataSerializableByteFixedIds[byteFixedIdIndex(id)] = func;
+    } else {
+      next.dataSerializableFixedIds[id] = func;
+    }
+  });
 }
 
 void TheTypeMap::unbindDataSerializableFixedId(internal::DSFid id) {
-  const std::lock_guard<std::mutex> guard(dataSerializableFixedIdMapMutex_);
-  dataSerializableFixedIdMap_.erase(id);
+  update([&](Snapshot& next) {
+    if (isByteFixedId(id)) {
+      next.dataSerializableByteFixedIds[byteFixedIdIndex(id)] = nullptr;
+    } else {
+      next.dataSerializableFixedIds.erase(id);
+    }
+  });
 }
 
 void TheTypeMap::bindPdxSerializable(TypeFactoryMethodPdx func) {
   auto obj = func();
-  const std::lock_guard<std::mutex> guard(pdxSerializableMapMutex_);
   auto&& objFullName = obj->getClassName();
 
-  const auto& result = pdxSerializableMap_.emplace(objFullName, func);
-  if (!result.second) {
-    LOGERROR("A object with FullName " + objFullName +
-             " is already registered.");
-    throw IllegalStateException(
-        "A Object with given FullName is already registered.");
-  }
+  update([&](Snapshot& next) {
+    const auto& result = next.pdxSerializables.emplace(objFullName, func);
+    if (!result.second) {
+      LOGERROR("A object with FullName " + objFullName +
+               " is already registered.");
+      throw IllegalStateException(
+          "A Object with given FullName is already registered.");
+    }
+  });
 }
 
 TypeFactoryMethodPdx TheTypeMap::findPdxSerializable(
     const std::string& objFullName) const {
-  const std::lock_guard<std::mutex> guard(pdxSerializableMapMutex_);
-
-  const auto& found = pdxSerializableMap_.find(objFullName);
-  if (found != pdxSerializableMap_.end()) {
+  const auto& pdxSerializables = snapshot().pdxSerializables;
+  const auto& found = pdxSerializables.find(objFullName);
+  if (found != pdxSerializables.end()) {
     return found->second;
   }
 
@@ -582,13 +732,11 @@ TypeFactoryMethodPdx TheTypeMap::findPdxSerializable(
 
 void TheTypeMap::rebindPdxSerializable(std::string objFullName,
                                        TypeFactoryMethodPdx func) {
-  const std::lock_guard<std::mutex> guard(pdxSerializableMapMutex_);
-  pdxSerializableMap_[objFullName] = func;
+  update([&](Snapshot& next) { next.pdxSerializables[objFullName] = func; });
 }
 
 void TheTypeMap::unbindPdxSerializable(const std::string& objFullName) {
-  const std::lock_guard<std::mutex> guard(pdxSerializableMapMutex_);
-  pdxSerializableMap_.erase(objFullName);
+  update([&](Snapshot& next) { next.pdxSerializables.erase(objFullName); });
 }
 
 void PdxTypeHandler::serialize(
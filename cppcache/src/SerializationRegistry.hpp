@@ -20,6 +20,8 @@
 #ifndef GEODE_SERIALIZATIONREGISTRY_H_
 #define GEODE_SERIALIZATIONREGISTRY_H_
 
+#include <array>
+#include <atomic>
 #include <functional>
 #include <iostream>
 #include <memory>
@@ -74,23 +76,41 @@ namespace client {
 using internal::DataSerializableInternal;
 using internal::DataSerializablePrimitive;
 
+/**
+ * Factory registry shared by every thread that (de)serializes through a cache.
+ *
+ * Types are registered during startup and looked up on every read, so the
+ * maps live in an immutable snapshot that writers copy, modify and publish
+ * under a single mutex. Readers keep the last snapshot they saw in a thread
+ * local and only reload it when the published version changes, so a lookup
+ * takes no lock and touches no shared reference count.
+ */
 class TheTypeMap {
-  std::unordered_map<internal::DSCode, TypeFactoryMethod>
-      dataSerializablePrimitiveMap_;
-  std::unordered_map<int32_t, TypeFactoryMethod> dataSerializableMap_;
-  std::unordered_map<internal::DSFid, TypeFactoryMethod>
-      dataSerializableFixedIdMap_;
-  std::unordered_map<std::string, TypeFactoryMethodPdx> pdxSerializableMap_;
-  mutable std::mutex dataSerializablePrimitiveMapMutex_;
-  mutable std::mutex dataSerializableMapMutex_;
-  mutable std::mutex dataSerializableFixedIdMapMutex_;
-  mutable std::mutex pdxSerializableMapMutex_;
+  struct Snapshot {
+    /** Primitive factories indexed by the unsigned wire value of the DSCode.
+     */
+    std::array<TypeFactoryMethod, 256> dataSerializablePrimitives;
+    /** Fixed id factories for ids that fit in a byte, indexed by id + 128. */
+    std::array<TypeFactoryMethod, 256> dataSerializableByteFixedIds;
+    std::unordered_map<internal::DSFid, TypeFactoryMethod>
+        dataSerializableFixedIds;
+    std::unordered_map<int32_t, TypeFactoryMethod> dataSerializables;
+    std::unordered_map<std::string, TypeFactoryMethodPdx> pdxSerializables;
+    std::unordered_map<std::type_index, int32_t> typeToClassId;
+  };
+
+  std::shared_ptr<const Snapshot> snapshot_;
+  std::atomic<uint64_t> version_;
+  std::mutex updateMutex_;
+
+  const Snapshot& snapshot() const;
+
+  template <class Mutator>
+  void update(Mutator&& mutator);
 
  public:
-  std::unordered_map<std::type_index, int32_t> typeToClassId_;
-
   TheTypeMap(const TheTypeMap&) = delete;
-  TheTypeMap() { setup(); }
+  TheTypeMap();
 
   ~TheTypeMap() noexcept = default;
 
@@ -106,6 +126,8 @@ class TheTypeMap {
 
   void unbindDataSerializable(int32_t id);
 
+  bool findDataSerializableClassId(std::type_index type, int32_t& id) const;
+
   void findDataSerializableFixedId(internal::DSFid id,
                                    TypeFactoryMethod& func) const;
 
@@ -132,8 +154,6 @@ class TheTypeMap {
   void bindDataSerializablePrimitive(TypeFactoryMethod func, DSCode id);
 
   void rebindDataSerializablePrimitive(DSCode dsCode, TypeFactoryMethod func);
-
- private:
 };
 
 class Pool;
@@ -178,49 +198,56 @@ class APACHE_GEODE_EXPORT SerializationRegistry {
                         DataOutput& output, bool isDelta = false) const {
     if (obj == nullptr) {
       output.write(static_cast<int8_t>(DSCode::NullObj));
-    } else if (auto&& pdxSerializable =
-                   std::dynamic_pointer_cast<PdxSerializable>(obj)) {
-      serialize(pdxSerializable, output);
-    } else if (const auto&& dataSerializableFixedId =
-                   std::dynamic_pointer_cast<DataSerializableFixedId>(obj)) {
-      serialize(dataSerializableFixedId, output);
-    } else if (const auto&& dataSerializablePrimitive =
-                   std::dynamic_pointer_cast<DataSerializablePrimitive>(obj)) {
-      serialize(dataSerializablePrimitive, output);
-    } else if (const auto&& dataSerializable =
-                   std::dynamic_pointer_cast<DataSerializable>(obj)) {
-      dataSerializableHandler_->serialize(dataSerializable, output, isDelta);
-    } else if (const auto&& dataSerializableInternal =
-                   std::dynamic_pointer_cast<DataSerializableInternal>(obj)) {
-      serialize(dataSerializableInternal, output);
-    } else {
-      throw UnsupportedOperationException(
-          "SerializationRegistry::serialize: Serialization type not "
-          "implemented.");
+      return;
+    }
+
+    switch (obj->serializationKind_) {
+      case internal::SerializationKind::PdxSerializable:
+        serialize(interfaceOf<PdxSerializable>(obj), output);
+        break;
+      case internal::SerializationKind::DataSerializableFixedId:
+        serialize(interfaceOf<DataSerializableFixedId>(obj), output);
+        break;
+      case internal::SerializationKind::DataSerializablePrimitive:
+        serialize(interfaceOf<DataSerializablePrimitive>(obj), output);
+        break;
+      case internal::SerializationKind::DataSerializable:
+        dataSerializableHandler_->serialize(
+            interfaceOf<DataSerializable>(obj), output, isDelta);
+        break;
+      case internal::SerializationKind::DataSerializableInternal:
+        serialize(interfaceOf<DataSerializableInternal>(obj), output);
+        break;
+      case internal::SerializationKind::Unknown:
+        serializeUntagged(obj, output, isDelta);
+        break;
     }
   }
 
   inline void serializeWithoutHeader(const std::shared_ptr<Serializable>& obj,
                                      DataOutput& output) const {
-    if (const auto&& pdxSerializable =
-            std::dynamic_pointer_cast<PdxSerializable>(obj)) {
-      serializeWithoutHeader(pdxSerializable, output);
-    } else if (const auto&& dataSerializableFixedId =
-                   std::dynamic_pointer_cast<DataSerializableFixedId>(obj)) {
-      serializeWithoutHeader(dataSerializableFixedId, output);
-    } else if (const auto&& dataSerializablePrimitive =
-                   std::dynamic_pointer_cast<DataSerializablePrimitive>(obj)) {
-      serializeWithoutHeader(dataSerializablePrimitive, output);
-    } else if (const auto&& dataSerializable =
-                   std::dynamic_pointer_cast<DataSerializable>(obj)) {
-      serializeWithoutHeader(dataSerializable, output);
-    } else if (const auto&& dataSerializableInternal =
-                   std::dynamic_pointer_cast<DataSerializableInternal>(obj)) {
-      serializeWithoutHeader(dataSerializableInternal, output);
-    } else {
-      throw UnsupportedOperationException(
-          "SerializationRegistry::serializeWithoutHeader: Serialization type "
-          "not implemented.");
+    switch (obj->serializationKind_) {
+      case internal::SerializationKind::PdxSerializable:
+        serializeWithoutHeader(interfaceOf<PdxSerializable>(obj), output);
+        break;
+      case internal::SerializationKind::DataSerializableFixedId:
+        serializeWithoutHeader(interfaceOf<DataSerializableFixedId>(obj),
+                               output);
+        break;
+      case internal::SerializationKind::DataSerializablePrimitive:
+        serializeWithoutHeader(interfaceOf<DataSerializablePrimitive>(obj),
+                               output);
+        break;
+      case internal::SerializationKind::DataSerializable:
+        serializeWithoutHeader(interfaceOf<DataSerializable>(obj), output);
+        break;
+      case internal::SerializationKind::DataSerializableInternal:
+        serializeWithoutHeader(interfaceOf<DataSerializableInternal>(obj),
+                               output);
+        break;
+      case internal::SerializationKind::Unknown:
+        serializeWithoutHeaderUntagged(obj, output);
+        break;
     }
   }
 
@@ -280,8 +307,12 @@ class APACHE_GEODE_EXPORT SerializationRegistry {
   }
 
   int32_t getIdForDataSerializableType(std::type_index objectType) const {
-    auto&& typeIterator = theTypeMap_.typeToClassId_.find(objectType);
-    auto&& id = typeIterator->second;
+    int32_t id;
+    if (!theTypeMap_.findDataSerializableClassId(objectType, id)) {
+      throw IllegalStateException(
+          "SerializationRegistry::getIdForDataSerializableType: type is not "
+          "registered.");
+    }
     return id;
   }
 
@@ -294,6 +325,24 @@ class APACHE_GEODE_EXPORT SerializationRegistry {
   std::shared_ptr<Serializable> deserializeDataSerializableFixedId(
       DataInput& input, DSCode dsCode) const;
 
+  /**
+   * Reaches the serialization interface recorded by the constructor of obj
+   * without going through RTTI.
+   */
+  template <class _Interface>
+  static inline std::shared_ptr<_Interface> interfaceOf(
+      const std::shared_ptr<Serializable>& obj) {
+    return std::shared_ptr<_Interface>(
+        obj, reinterpret_cast<_Interface*>(reinterpret_cast<char*>(obj.get()) +
+                                           obj->serializationOffset_));
+  }
+
+  void serializeUntagged(const std::shared_ptr<Serializable>& obj,
+                         DataOutput& output, bool isDelta) const;
+
+  void serializeWithoutHeaderUntagged(const std::shared_ptr<Serializable>& obj,
+                                      DataOutput& output) const;
+
   inline void serialize(const std::shared_ptr<DataSerializableFixedId>& obj,
                         DataOutput& output) const {
     auto id = static_cast<int32_t>(obj->getDSFID());
@@ -0,0 +1,144 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "SslContext.hpp"
+
+#include <openssl/ssl.h>
+
+#include <boost/exception/diagnostic_information.hpp>
+
+#include <geode/ExceptionTypes.hpp>
+
+#include "util/Log.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+namespace {
+
+// Asio already uses the app data of both SSL and SSL_CTX for its verify
+// callbacks, so dedicated ex data indices are used instead.
+int contextIndex() {
+  static const int index =
+      SSL_CTX_get_ex_new_index(0, nullptr, nullptr, nullptr, nullptr);
+  return index;
+}
+
+int peerIndex() {
+  static const int index =
+      SSL_get_ex_new_index(0, nullptr, nullptr, nullptr, nullptr);
+  return index;
+}
+
+}  // namespace
+
+SslContext::SslContext(const std::string& trustStore,
+                       const std::string& keyStore,
+                       const std::string& keyStorePassword)
+    : context_{boost::asio::ssl::context::sslv23_client} {
+  LOGDEBUG("SslContext: trustStore = %s, keyStore = %s", trustStore.c_str(),
+           keyStore.c_str());
+
+  try {
+    context_.set_verify_mode(boost::asio::ssl::verify_peer);
+    context_.load_verify_file(trustStore);
+
+    context_.set_password_callback(
+        [keyStorePassword](
+            std::size_t /*max_length*/,
+            boost::asio::ssl::context::password_purpose /*purpose*/) {
+          return keyStorePassword;
+        });
+
+    if (!keyStore.empty()) {
+      context_.use_certificate_chain_file(keyStore);
+      context_.use_private_key_file(
+          keyStore, boost::asio::ssl::context::file_format::pem);
+    }
+  } catch (const boost::exception& ex) {
+    std::string info = boost::diagnostic_information(ex);
+    LOGDEBUG("caught boost exception: %s", info.c_str());
+    throw SslException(info.c_str());
+  }
+
+  // OpenSSL does not resume client sessions on its own, so sessions and
+  // session tickets are captured as they arrive, which for TLS 1.3 is after
+  // the handshake has completed, and offered again on the next connection.
+  auto handle = context_.native_handle();
+  SSL_CTX_set_ex_data(handle, contextIndex(), this);
+  SSL_CTX_set_session_cache_mode(
+      handle, SSL_SESS_CACHE_CLIENT | SSL_SESS_CACHE_NO_INTERNAL_STORE);
+  SSL_CTX_sess_set_new_cb(handle, &SslContext::newSessionCallback);
+}
+
+SslContext::~SslContext() noexcept {
+  for (auto& entry : sessions_) {
+    SSL_SESSION_free(entry.second);
+  }
+}
+
+void SslContext::prepare(SSL* ssl, const std::string& peer) {
+  SSL_set_ex_data(ssl, peerIndex(), const_cast<std::string*>(&peer));
+
+  std::lock_guard<decltype(sessions_mutex_)> guard(sessions_mutex_);
+  auto found = sessions_.find(peer);
+  if (found != sessions_.end()) {
+    SSL_set_session(ssl, found->second);
+  }
+}
+
+void SslContext::removeSession(const std::string& peer) {
+  std::lock_guard<decltype(sessions_mutex_)> guard(sessions_mutex_);
+  auto found = sessions_.find(peer);
+  if (found != sessions_.end()) {
+    SSL_SESSION_free(found->second);
+    sessions_.erase(found);
+  }
+}
+
+int64_t SslContext::getResumedCount() const {
+  return SSL_CTX_sess_hits(
+      const_cast<boost::asio::ssl::context&>(context_).native_handle());
+}
+
+int SslContext::newSessionCallback(SSL* ssl, SSL_SESSION* session) {
+  auto sslContext = static_cast<SslContext*>(
+      SSL_CTX_get_ex_data(SSL_get_SSL_CTX(ssl), contextIndex()));
+  auto peer = static_cast<std::string*>(SSL_get_ex_data(ssl, peerIndex()));
+  if (sslContext == nullptr || peer == nullptr) {
+    return 0;
+  }
+
+  sslContext->storeSession(*peer, session);
+  // Returning 1 keeps the reference to session, released by storeSession,
+  // removeSession or the destructor.
+  return 1;
+}
+
+void SslContext::storeSession(const std::string& peer, SSL_SESSION* session) {
+  std::lock_guard<decltype(sessions_mutex_)> guard(sessions_mutex_);
+  auto& stored = sessions_[peer];
+  if (stored != nullptr) {
+    SSL_SESSION_free(stored);
+  }
+  stored = session;
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
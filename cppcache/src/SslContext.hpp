@@ -0,0 +1,84 @@
+#pragma once
+
+#ifndef GEODE_SSLCONTEXT_H_
+#define GEODE_SSLCONTEXT_H_
+
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <boost/asio/ssl/context.hpp>
+
+#include <geode/internal/geode_globals.hpp>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+/**
+ * TLS client configuration shared by every TcpSslConn of a cache.
+ *
+ * The trust store, certificate chain and private key are loaded once, when the
+ * context is created, instead of for every connection. The context also keeps
+ * the most recent TLS session, or session ticket, received from each peer so
+ * that a reconnect to the same server or locator resumes the session with an
+ * abbreviated handshake.
+ */
+class SslContext {
+ public:
+  /**
+   * @throws SslException if the trust store or key store could not be loaded.
+   */
+  SslContext(const std::string& trustStore, const std::string& keyStore,
+             const std::string& keyStorePassword);
+
+  ~SslContext() noexcept;
+
+  SslContext(const SslContext&) = delete;
+  SslContext& operator=(const SslContext&) = delete;
+
+  boost::asio::ssl::context& context() { return context_; }
+
+  /**
+   * Associates ssl with peer, which must outlive ssl, and offers the session
+   * last used with peer for resumption. Must be called before the handshake.
+   */
+  void prepare(SSL* ssl, const std::string& peer);
+
+  /** Forgets the session for peer, e.g. after a failed handshake. */
+  void removeSession(const std::string& peer);
+
+  /** Number of handshakes since creation that resumed a cached session. */
+  int64_t getResumedCount() const;
+
+ private:
+  boost::asio::ssl::context context_;
+  mutable std::mutex sessions_mutex_;
+  std::unordered_map<std::string, SSL_SESSION*> sessions_;
+
+  static int newSessionCallback(SSL* ssl, SSL_SESSION* session);
+  void storeSession(const std::string& peer, SSL_SESSION* session);
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_SSLCONTEXT_H_
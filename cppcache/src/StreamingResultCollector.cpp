@@ -0,0 +1,153 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <geode/ExceptionTypes.hpp>
+#include <geode/StreamingResultCollector.hpp>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+StreamingResultCollector::StreamingResultCollector(size_t capacity)
+    : capacity_(capacity),
+      ended_(false),
+      cancelled_(false),
+      reExecuted_(false),
+      delivered_(false),
+      resultList_(CacheableVector::create()) {}
+
+StreamingResultCollector::~StreamingResultCollector() noexcept {}
+
+bool StreamingResultCollector::next(std::shared_ptr<Cacheable>& result,
+                                    std::chrono::milliseconds timeout) {
+  if (batch_.empty()) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (!resultAdded_.wait_for(lock, timeout, [this] {
+          return cancelled_ || exception_ || reExecuted_ || ended_ ||
+                 !queue_.empty();
+        })) {
+      throw FunctionExecutionException(
+          "StreamingResultCollector::next: no result received within the "
+          "timeout");
+    }
+    if (exception_ && !cancelled_) {
+      std::rethrow_exception(exception_);
+    }
+    if (reExecuted_) {
+      throw FunctionExecutionException(
+          "StreamingResultCollector::next: function was re-executed after "
+          "some of its results had been returned");
+    }
+    if (cancelled_ || queue_.empty()) {
+      return false;
+    }
+
+    // Take everything queued so far; the lock is not needed again until
+    // this batch is used up.
+    batch_.swap(queue_);
+    delivered_ = true;
+    lock.unlock();
+    resultsTaken_.notify_all();
+  }
+
+  result = std::move(batch_.front());
+  batch_.pop_front();
+  return true;
+}
+
+void StreamingResultCollector::cancel() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    cancelled_ = true;
+    queue_.clear();
+  }
+  batch_.clear();
+  resultAdded_.notify_all();
+  resultsTaken_.notify_all();
+}
+
+void StreamingResultCollector::setException(std::exception_ptr exception) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    exception_ = exception;
+    queue_.clear();
+  }
+  resultAdded_.notify_all();
+  resultsTaken_.notify_all();
+}
+
+std::shared_ptr<CacheableVector> StreamingResultCollector::getResult(
+    std::chrono::milliseconds timeout) {
+  const auto deadline = std::chrono::steady_clock::now() + timeout;
+  std::shared_ptr<Cacheable> result;
+  while (true) {
+    auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+        deadline - std::chrono::steady_clock::now());
+    if (remaining < std::chrono::milliseconds::zero()) {
+      remaining = std::chrono::milliseconds::zero();
+    }
+    if (!next(result, remaining)) {
+      break;
+    }
+    resultList_->push_back(std::move(result));
+  }
+
+  return resultList_;
+}
+
+void StreamingResultCollector::addResult(
+    const std::shared_ptr<Cacheable>& result) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (capacity_ > 0) {
+    resultsTaken_.wait(lock, [this] {
+      return cancelled_ || exception_ || queue_.size() < capacity_;
+    });
+  }
+  if (cancelled_ || exception_) {
+    return;
+  }
+
+  // The consumer only waits while the queue is empty.
+  const bool wasEmpty = queue_.empty();
+  queue_.push_back(result);
+  lock.unlock();
+  if (wasEmpty) {
+    resultAdded_.notify_one();
+  }
+}
+
+void StreamingResultCollector::endResults() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ended_ = true;
+  }
+  resultAdded_.notify_all();
+}
+
+void StreamingResultCollector::clearResults() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    queue_.clear();
+    reExecuted_ = reExecuted_ || delivered_;
+  }
+  resultAdded_.notify_all();
+  resultsTaken_.notify_all();
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
@@ -28,6 +28,12 @@ Struct::Struct(StructSet* ssPtr,
                std::vector<std::shared_ptr<Serializable>>& fieldValues)
     : m_parent(ssPtr), m_fieldValues(fieldValues) {}
 
+Struct::Struct(std::shared_ptr<StructSet> structSet,
+               std::vector<std::shared_ptr<Serializable>>& fieldValues)
+    : m_parent(structSet.get()),
+      m_structSet(std::move(structSet)),
+      m_fieldValues(fieldValues) {}
+
 void Struct::skipClassName(DataInput& input) {
   if (input.read() == static_cast<int8_t>(DSCode::Class)) {
     input.read();  // ignore string type id - assuming its a normal
@@ -109,6 +115,9 @@ const std::shared_ptr<Serializable> Struct::operator[](
 }
 
 const std::shared_ptr<StructSet> Struct::getStructSet() const {
+  if (m_structSet) {
+    return m_structSet;
+  }
   return std::shared_ptr<StructSet>(m_parent);
 }
 
@@ -17,6 +17,7 @@
 
 #include "StructSetImpl.hpp"
 
+#include <memory>
 #include <stdexcept>
 #include <vector>
 
@@ -27,37 +28,55 @@ namespace geode {
 namespace client {
 
 StructSetImpl::StructSetImpl(const std::shared_ptr<CacheableVector>& response,
-                             const std::vector<std::string>& fieldNames) {
+                             const std::vector<std::string>& fieldNames)
+    : m_values(response),
+      m_numFields(fieldNames.size()),
+      m_numRows(m_numFields == 0 ? 0 : response->size() / m_numFields),
+      m_structVector(m_numRows),
+      m_fieldNames(fieldNames) {
   int32_t i = 0;
   for (auto&& fieldName : fieldNames) {
     LOGDEBUG("StructSetImpl: pushing fieldName = %s with index = %d",
              fieldName.c_str(), i);
     m_fieldNameIndexMap.emplace(fieldName, i++);
   }
-
-  const auto numOfValues = response->size();
-  const auto numOfFields = fieldNames.size();
-  m_structVector.reserve(numOfValues / numOfFields);
-
-  size_t valStoredCnt = 0;
-  while (valStoredCnt < numOfValues) {
-    std::vector<std::shared_ptr<Serializable>> tmpVec;
-    for (size_t j = 0; j < numOfFields; j++) {
-      tmpVec.push_back(response->operator[](valStoredCnt++));
-    }
-    m_structVector.push_back(std::make_shared<Struct>(this, tmpVec));
-  }
 }
 
-size_t StructSetImpl::size() const { return m_structVector.size(); }
+size_t StructSetImpl::size() const { return m_numRows; }
 
 const std::shared_ptr<Serializable> StructSetImpl::operator[](
     size_t index) const {
-  if (index >= m_structVector.size()) {
+  if (index >= m_numRows) {
+    throw IllegalArgumentException("Index out of bounds");
+  }
+
+  return getStruct(index);
+}
+
+StructSet::Row StructSetImpl::getRow(size_t index) {
+  if (index >= m_numRows) {
     throw IllegalArgumentException("Index out of bounds");
   }
 
-  return m_structVector.operator[](index);
+  return Row(this, m_values->data() + index * m_numFields,
+             static_cast<int32_t>(m_numFields));
+}
+
+std::shared_ptr<Serializable> StructSetImpl::getStruct(size_t index) const {
+  auto& slot = m_structVector[index];
+  auto structPtr = std::atomic_load(&slot);
+  if (!structPtr) {
+    const auto first = m_values->begin() + index * m_numFields;
+    std::vector<std::shared_ptr<Serializable>> fieldValues(
+        first, first + m_numFields);
+    std::shared_ptr<Serializable> created = std::make_shared<Struct>(
+        const_cast<StructSetImpl*>(this), fieldValues);
+    // Another reader may have created the same row; keep whichever won.
+    if (std::atomic_compare_exchange_strong(&slot, &structPtr, created)) {
+      structPtr = std::move(created);
+    }
+  }
+  return structPtr;
 }
 
 int32_t StructSetImpl::getFieldIndex(const std::string& fieldname) {
@@ -70,14 +89,17 @@ int32_t StructSetImpl::getFieldIndex(const std::string& fieldname) {
 }
 
 const std::string& StructSetImpl::getFieldName(int32_t index) {
-  for (const auto& iter : m_fieldNameIndexMap) {
-    if (iter.second == index) return (iter.first);
+  if (index < 0 || static_cast<size_t>(index) >= m_fieldNames.size()) {
+    throw std::out_of_range("Struct: fieldName not found.");
   }
 
-  throw std::out_of_range("Struct: fieldName not found.");
+  return m_fieldNames[index];
 }
 
 SelectResults::iterator StructSetImpl::begin() {
+  for (size_t i = 0; i < m_numRows; i++) {
+    getStruct(i);
+  }
   return m_structVector.begin();
 }
 
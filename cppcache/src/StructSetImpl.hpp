@@ -23,6 +23,7 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include <geode/CacheableBuiltins.hpp>
 #include <geode/Struct.hpp>
@@ -52,9 +53,20 @@ class StructSetImpl : public StructSet {
 
   SelectResults::iterator end() override;
 
+  Row getRow(size_t index) override;
+
  private:
-  std::vector<std::shared_ptr<Serializable>> m_structVector;
+  std::shared_ptr<Serializable> getStruct(size_t index) const;
+
+  // Field values of all rows, row after row, numFields apart.
+  std::shared_ptr<CacheableVector> m_values;
+  size_t m_numFields;
+  size_t m_numRows;
+
+  // Struct facades, created on first use of operator[] or begin().
+  mutable std::vector<std::shared_ptr<Serializable>> m_structVector;
 
+  std::vector<std::string> m_fieldNames;
   std::unordered_map<std::string, int32_t> m_fieldNameIndexMap;
 };
 
@@ -0,0 +1,78 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "SubscriptionConflationQueue.hpp"
+
+#include <iterator>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+SubscriptionConflationQueue::SubscriptionConflationQueue() : draining_(false) {}
+
+bool SubscriptionConflationQueue::add(Event event, bool& conflated,
+                                      std::shared_ptr<EventId>& superseded) {
+  std::lock_guard<decltype(mutex_)> guard(mutex_);
+  auto found = waiting_.find(event.key);
+  if (found != waiting_.end()) {
+    auto& waiting = *found->second;
+    superseded = std::move(waiting.eventId);
+    waiting.value = std::move(event.value);
+    waiting.callbackArgument = std::move(event.callbackArgument);
+    waiting.versionTag = std::move(event.versionTag);
+    waiting.eventId = std::move(event.eventId);
+    conflated = true;
+  } else {
+    auto key = event.key;
+    events_.push_back(std::move(event));
+    waiting_.emplace(std::move(key), std::prev(events_.end()));
+    conflated = false;
+  }
+
+  if (draining_) {
+    return false;
+  }
+  draining_ = true;
+  return true;
+}
+
+bool SubscriptionConflationQueue::drain(Events& events) {
+  std::lock_guard<decltype(mutex_)> guard(mutex_);
+  if (events_.empty()) {
+    draining_ = false;
+    return false;
+  }
+  events.splice(events.end(), events_);
+  waiting_.clear();
+  return true;
+}
+
+void SubscriptionConflationQueue::takeAll(Events& events) {
+  std::lock_guard<decltype(mutex_)> guard(mutex_);
+  events.splice(events.end(), events_);
+  waiting_.clear();
+}
+
+size_t SubscriptionConflationQueue::size() const {
+  std::lock_guard<decltype(mutex_)> guard(mutex_);
+  return events_.size();
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
@@ -0,0 +1,108 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_SUBSCRIPTIONCONFLATIONQUEUE_H_
+#define GEODE_SUBSCRIPTIONCONFLATIONQUEUE_H_
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include <geode/CacheableKey.hpp>
+#include <geode/Serializable.hpp>
+#include <geode/internal/functional.hpp>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+class EventId;
+class VersionTag;
+
+/**
+ * Holds the create and update subscription events of a region that are
+ * waiting to be applied, keeping only the latest value per key.
+ *
+ * An event for a key that already has one waiting takes its place: the
+ * waiting event keeps its position and kind (create or update) and takes
+ * on the newer value, callback argument, version tag and event id. Events
+ * of any other kind are not queued; the region applies what is waiting
+ * before handling them, so they act as barriers.
+ */
+class SubscriptionConflationQueue {
+ public:
+  struct Event {
+    bool isCreate;
+    std::shared_ptr<CacheableKey> key;
+    std::shared_ptr<Cacheable> value;
+    std::shared_ptr<Serializable> callbackArgument;
+    std::shared_ptr<VersionTag> versionTag;
+    std::shared_ptr<EventId> eventId;
+  };
+
+  using Events = std::list<Event>;
+
+  SubscriptionConflationQueue();
+
+  SubscriptionConflationQueue(const SubscriptionConflationQueue&) = delete;
+  SubscriptionConflationQueue& operator=(const SubscriptionConflationQueue&) =
+      delete;
+
+  /**
+   * Queues event, or merges it into the event waiting for the same key.
+   *
+   * @param conflated set to true if event was merged into a waiting one.
+   * @param superseded set to the event id the waiting event had before the
+   *   merge.
+   * @returns true if no drain is in progress, in which case the caller
+   *   schedules one.
+   */
+  bool add(Event event, bool& conflated, std::shared_ptr<EventId>& superseded);
+
+  /**
+   * Moves all waiting events to events, in order. Used by the drain; once it
+   * finds nothing waiting it returns false and the next add schedules a new
+   * drain.
+   */
+  bool drain(Events& events);
+
+  /**
+   * Moves all waiting events to events, in order, without affecting the
+   * drain.
+   */
+  void takeAll(Events& events);
+
+  size_t size() const;
+
+ private:
+  mutable std::mutex mutex_;
+  bool draining_;
+  Events events_;
+  std::unordered_map<std::shared_ptr<CacheableKey>, Events::iterator,
+                     dereference_hash<std::shared_ptr<CacheableKey>>,
+                     dereference_equal_to<std::shared_ptr<CacheableKey>>>
+      waiting_;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_SUBSCRIPTIONCONFLATIONQUEUE_H_
@@ -16,6 +16,8 @@
  */
 
 #include <cstdlib>
+#include <limits>
+#include <stdexcept>
 #include <string>
 #include <thread>
 
@@ -36,6 +38,8 @@ namespace {
 const char StatisticsSampleInterval[] = "statistic-sample-rate";
 const char StatisticsEnabled[] = "statistic-sampling-enabled";
 const char StatisticsArchiveFile[] = "statistic-archive-file";
+const char StatisticsExporterPort[] = "statistic-exporter-port";
+const char StatisticsExporterSocket[] = "statistic-exporter-socket";
 const char LogFilename[] = "log-file";
 const char LogLevelProperty[] = "log-level";
 
@@ -60,6 +64,11 @@ const char DurableTimeout[] = "durable-timeout";
 const char ConnectTimeout[] = "connect-timeout";
 const char ConnectWaitTimeout[] = "connect-wait-timeout";
 const char BucketWaitTimeout[] = "bucket-wait-timeout";
+const char LocatorCacheTtl[] = "locator-cache-ttl";
+const char MetadataRefreshInterval[] = "metadata-refresh-interval";
+const char PoolWarmupThreads[] = "pool-warmup-threads";
+const char PoolWarmupTimeout[] = "pool-warmup-timeout";
+const char PutAllBatchSize[] = "put-all-batch-size";
 const char ConflateEvents[] = "conflate-events";
 const char SecurityClientDhAlgo[] = "security-client-dhalgo";
 const char SecurityClientKsPath[] = "security-client-kspath";
@@ -75,6 +84,7 @@ const char EnableChunkHandlerThread[] = "enable-chunk-handler-thread";
 const char OnClientDisconnectClearPdxTypeIds[] =
     "on-client-disconnect-clear-pdxType-Ids";
 const char TombstoneTimeoutInMSec[] = "tombstone-timeout";
+const char ZeroCopyByteArrays[] = "zero-copy-byte-arrays";
 const char DefaultConflateEvents[] = "server";
 
 const char DefaultDurableClientId[] = "";
@@ -83,11 +93,18 @@ constexpr auto DefaultDurableTimeout = std::chrono::seconds(300);
 constexpr auto DefaultConnectTimeout = std::chrono::seconds(59);
 constexpr auto DefaultConnectWaitTimeout = std::chrono::seconds::zero();
 constexpr auto DefaultBucketWaitTimeout = std::chrono::seconds::zero();
+constexpr auto DefaultLocatorCacheTtl = std::chrono::seconds::zero();
+constexpr auto DefaultMetadataRefreshInterval = std::chrono::milliseconds(100);
+const uint32_t DefaultPoolWarmupThreads = 8;
+constexpr auto DefaultPoolWarmupTimeout = std::chrono::seconds::zero();
+const uint32_t DefaultPutAllBatchSize = 10000;
 
 constexpr auto DefaultSamplingInterval = std::chrono::seconds(1);
 constexpr auto DefaultSamplingEnabled = false;
 
 const char DefaultStatArchive[] = "statArchive.gfs";
+const uint16_t DefaultStatExporterPort = 0;  // = disabled
+const char DefaultStatExporterSocket[] = "";  // = disabled
 const char DefaultLogFilename[] = "";  // stdout...
 
 const apache::geode::client::LogLevel DefaultLogLevel =
@@ -124,6 +141,7 @@ constexpr auto DefaultTombstoneTimeout = std::chrono::seconds(480);
 // not disable; all region api will use chunk handler thread
 const bool DefaultEnableChunkHandlerThread = false;
 const bool DefaultOnClientDisconnectClearPdxTypeIds = false;
+const bool DefaultZeroCopyByteArrays = false;
 
 }  // namespace
 
@@ -137,6 +155,8 @@ SystemProperties::SystemProperties(
     : m_statisticsSampleInterval(DefaultSamplingInterval),
       m_statisticsEnabled(DefaultSamplingEnabled),
       m_statisticsArchiveFile(DefaultStatArchive),
+      m_statisticsExporterPort(DefaultStatExporterPort),
+      m_statisticsExporterSocket(DefaultStatExporterSocket),
       m_logFilename(DefaultLogFilename),
       m_logLevel(DefaultLogLevel),
       m_sessions(0 /* setup  later in processProperty */),
@@ -162,6 +182,11 @@ SystemProperties::SystemProperties(
       m_connectTimeout(DefaultConnectTimeout),
       m_connectWaitTimeout(DefaultConnectWaitTimeout),
       m_bucketWaitTimeout(DefaultBucketWaitTimeout),
+      m_locatorCacheTtl(DefaultLocatorCacheTtl),
+      m_metadataRefreshInterval(DefaultMetadataRefreshInterval),
+      m_poolWarmupTimeout(DefaultPoolWarmupTimeout),
+      m_poolWarmupThreads(DefaultPoolWarmupThreads),
+      m_putAllBatchSize(DefaultPutAllBatchSize),
       m_autoReadyForEvents(DefaultAutoReadyForEvents),
       m_sslEnabled(DefaultSslEnabled),
       m_timestatisticsEnabled(DefaultTimeStatisticsEnabled),
@@ -174,7 +199,8 @@ SystemProperties::SystemProperties(
       m_tombstoneTimeout(DefaultTombstoneTimeout),
       m_enableChunkHandlerThread(DefaultEnableChunkHandlerThread),
       m_onClientDisconnectClearPdxTypeIds(
-          DefaultOnClientDisconnectClearPdxTypeIds) {
+          DefaultOnClientDisconnectClearPdxTypeIds),
+      m_zeroCopyByteArrays(DefaultZeroCopyByteArrays) {
   // now that defaults are set, consume files and override the defaults.
   class ProcessPropsVisitor : public Properties::Visitor {
     SystemProperties* m_sysProps;
@@ -292,6 +318,17 @@ void SystemProperties::processProperty(const std::string& property,
     parseDurationProperty(property, std::string(value), m_connectTimeout);
   } else if (property == ConnectWaitTimeout) {
     parseDurationProperty(property, std::string(value), m_connectWaitTimeout);
+  } else if (property == LocatorCacheTtl) {
+    parseDurationProperty(property, std::string(value), m_locatorCacheTtl);
+  } else if (property == MetadataRefreshInterval) {
+    parseDurationProperty(property, std::string(value),
+                          m_metadataRefreshInterval);
+  } else if (property == PoolWarmupThreads) {
+    m_poolWarmupThreads = std::stoul(value);
+  } else if (property == PoolWarmupTimeout) {
+    parseDurationProperty(property, std::string(value), m_poolWarmupTimeout);
+  } else if (property == PutAllBatchSize) {
+    m_putAllBatchSize = std::stoul(value);
   } else if (property == BucketWaitTimeout) {
     parseDurationProperty(property, std::string(value), m_bucketWaitTimeout);
   } else if (property == DisableShufflingEndpoint) {
@@ -306,6 +343,19 @@ void SystemProperties::processProperty(const std::string& property,
     m_statisticsEnabled = parseBooleanProperty(property, value);
   } else if (property == StatisticsArchiveFile) {
     m_statisticsArchiveFile = value;
+  } else if (property == StatisticsExporterPort) {
+    try {
+      const auto port = std::stoul(value);
+      if (port > std::numeric_limits<uint16_t>::max()) {
+        throw std::out_of_range(value);
+      }
+      m_statisticsExporterPort = static_cast<uint16_t>(port);
+    } catch (std::logic_error&) {
+      throw IllegalArgumentException("SystemProperties: invalid port " +
+                                     property + "=" + value);
+    }
+  } else if (property == StatisticsExporterSocket) {
+    m_statisticsExporterSocket = value;
   } else if (property == LogFilename) {
     m_logFilename = value;
   } else if (property == LogLevelProperty) {
@@ -351,6 +401,8 @@ void SystemProperties::processProperty(const std::string& property,
     m_enableChunkHandlerThread = parseBooleanProperty(property, value);
   } else if (property == OnClientDisconnectClearPdxTypeIds) {
     m_onClientDisconnectClearPdxTypeIds = parseBooleanProperty(property, value);
+  } else if (property == ZeroCopyByteArrays) {
+    m_zeroCopyByteArrays = parseBooleanProperty(property, value);
   } else {
     throwError("SystemProperties: unknown property: " + property + "=" + value);
   }
@@ -413,6 +465,9 @@ void SystemProperties::logSettings() {
   settings += "\n  heap-lru-limit = ";
   settings += std::to_string(heapLRULimit());
 
+  settings += "\n  locator-cache-ttl = ";
+  settings += to_string(locatorCacheTtl());
+
   settings += "\n  log-disk-space-limit = ";
   settings += std::to_string(logDiskSpaceLimit());
 
@@ -431,6 +486,9 @@ void SystemProperties::logSettings() {
   settings += "\n  max-socket-buffer-size = ";
   settings += std::to_string(maxSocketBufferSize());
 
+  settings += "\n  metadata-refresh-interval = ";
+  settings += to_string(metadataRefreshInterval());
+
   settings += "\n  notify-ack-interval = ";
   settings += to_string(notifyAckInterval());
 
@@ -445,6 +503,15 @@ void SystemProperties::logSettings() {
   settings += "\n  ping-interval = ";
   settings += to_string(pingInterval());
 
+  settings += "\n  pool-warmup-threads = ";
+  settings += std::to_string(poolWarmupThreads());
+
+  settings += "\n  pool-warmup-timeout = ";
+  settings += to_string(poolWarmupTimeout());
+
+  settings += "\n  put-all-batch-size = ";
+  settings += std::to_string(putAllBatchSize());
+
   settings += "\n  redundancy-monitor-interval = ";
   settings += to_string(redundancyMonitorInterval());
 
@@ -463,6 +530,12 @@ void SystemProperties::logSettings() {
   settings += "\n  statistic-archive-file = ";
   settings += statisticsArchiveFile();
 
+  settings += "\n  statistic-exporter-port = ";
+  settings += std::to_string(statisticsExporterPort());
+
+  settings += "\n  statistic-exporter-socket = ";
+  settings += statisticsExporterSocket();
+
   settings += "\n  statistic-sampling-enabled = ";
   settings += statisticsEnabled() ? "true" : "false";
 
@@ -475,6 +548,9 @@ void SystemProperties::logSettings() {
   settings += "\n  tombstone-timeout = ";
   settings += to_string(tombstoneTimeout());
 
+  settings += "\n  zero-copy-byte-arrays = ";
+  settings += zeroCopyByteArrays() ? "true" : "false";
+
   // *** PLEASE ADD IN ALPHABETICAL ORDER - USER VISIBLE ***
 
   LOGCONFIG(settings);
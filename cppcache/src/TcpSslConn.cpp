@@ -36,51 +36,47 @@ namespace apache {
 namespace geode {
 namespace client {
 
-TcpSslConn::TcpSslConn(const std::string& hostname, uint16_t,
+TcpSslConn::TcpSslConn(const std::string& hostname, uint16_t port,
                        const std::string& sniProxyHostname,
                        uint16_t sniProxyPort,
                        std::chrono::microseconds connect_timeout,
-                       int32_t maxBuffSizePool, const std::string& pubkeyfile,
-                       const std::string& privkeyfile,
-                       const std::string& pemPassword)
+                       int32_t maxBuffSizePool,
+                       std::shared_ptr<SslContext> sslContext)
     : TcpConn{sniProxyHostname, sniProxyPort, connect_timeout, maxBuffSizePool},
-      ssl_context_{boost::asio::ssl::context::sslv23_client},
+      ssl_context_{std::move(sslContext)},
+      peer_{hostname + ":" + std::to_string(port)},
       strand_(io_context_) {
-  init(pubkeyfile, privkeyfile, pemPassword, hostname);
+  init(hostname);
 }
 
 TcpSslConn::TcpSslConn(const std::string& hostname, uint16_t port,
                        std::chrono::microseconds connect_timeout,
-                       int32_t maxBuffSizePool, const std::string& pubkeyfile,
-                       const std::string& privkeyfile,
-                       const std::string& pemPassword)
+                       int32_t maxBuffSizePool,
+                       std::shared_ptr<SslContext> sslContext)
     : TcpConn{hostname, port, connect_timeout, maxBuffSizePool},
-      ssl_context_{boost::asio::ssl::context::sslv23_client},
+      ssl_context_{std::move(sslContext)},
+      peer_{hostname + ":" + std::to_string(port)},
       strand_(io_context_) {
-  init(pubkeyfile, privkeyfile, pemPassword);
+  init();
 }
 
 TcpSslConn::TcpSslConn(const std::string& ipaddr,
                        std::chrono::microseconds connect_timeout,
-                       int32_t maxBuffSizePool, const std::string& pubkeyfile,
-                       const std::string& privkeyfile,
-                       const std::string& pemPassword)
+                       int32_t maxBuffSizePool,
+                       std::shared_ptr<SslContext> sslContext)
     : TcpSslConn{
           ipaddr.substr(0, ipaddr.find(':')),
           static_cast<uint16_t>(std::stoi(ipaddr.substr(ipaddr.find(':') + 1))),
           connect_timeout,
           maxBuffSizePool,
-          pubkeyfile,
-          privkeyfile,
-          pemPassword} {}
+          std::move(sslContext)} {}
 
 TcpSslConn::TcpSslConn(const std::string& ipaddr,
                        std::chrono::microseconds connect_timeout,
                        int32_t maxBuffSizePool,
                        const std::string& sniProxyHostname,
-                       uint16_t sniProxyPort, const std::string& pubkeyfile,
-                       const std::string& privkeyfile,
-                       const std::string& pemPassword)
+                       uint16_t sniProxyPort,
+                       std::shared_ptr<SslContext> sslContext)
     : TcpSslConn{
           ipaddr.substr(0, ipaddr.find(':')),
           static_cast<uint16_t>(std::stoi(ipaddr.substr(ipaddr.find(':') + 1))),
@@ -88,49 +84,27 @@ TcpSslConn::TcpSslConn(const std::string& ipaddr,
           sniProxyPort,
           connect_timeout,
           maxBuffSizePool,
-          pubkeyfile,
-          privkeyfile,
-          pemPassword} {}
-
-void TcpSslConn::init(const std::string& pubkeyfile,
-                      const std::string& privkeyfile,
-                      const std::string& pemPassword,
-                      const std::string& sniHostname) {
-  // Most of the SSL configuration provided *through* Asio is on the context.
-  // This configuration is copied into each SSL instance upon construction.
-  // That means you need to get your configuration in order before you
-  // construct the stream and connect the socket.
-  LOGDEBUG(
-      "*** TcpSslConn init, pubkeyfile = %s, pemPassword = %s, sniHostname = "
-      "%s",
-      pubkeyfile.c_str(), pemPassword.c_str(), sniHostname.c_str());
-
-  try {
-    ssl_context_.set_verify_mode(boost::asio::ssl::verify_peer);
-    ssl_context_.load_verify_file(pubkeyfile);
-
-    ssl_context_.set_password_callback(
-        [pemPassword](std::size_t /*max_length*/,
-                      boost::asio::ssl::context::password_purpose /*purpose*/) {
-          return pemPassword;
-        });
+          std::move(sslContext)} {}
 
-    if (!privkeyfile.empty()) {
-      ssl_context_.use_certificate_chain_file(privkeyfile);
-      ssl_context_.use_private_key_file(
-          privkeyfile, boost::asio::ssl::context::file_format::pem);
-    }
+void TcpSslConn::init(const std::string& sniHostname) {
+  // The shared SslContext holds the certificates and cached sessions, both are
+  // copied into each SSL instance upon construction of the stream.
+  LOGDEBUG("*** TcpSslConn init, peer = %s, sniHostname = %s", peer_.c_str(),
+           sniHostname.c_str());
 
+  try {
     auto stream = std::unique_ptr<ssl_stream_type>(
-        new ssl_stream_type{socket_, ssl_context_});
+        new ssl_stream_type{socket_, ssl_context_->context()});
 
     SSL_set_tlsext_host_name(stream->native_handle(), sniHostname.c_str());
+    ssl_context_->prepare(stream->native_handle(), peer_);
 
     stream->handshake(ssl_stream_type::client);
 
     std::stringstream ss;
     ss << "Setup SSL " << socket_.local_endpoint() << " -> "
-       << socket_.remote_endpoint();
+       << socket_.remote_endpoint()
+       << (SSL_session_reused(stream->native_handle()) ? " (resumed)" : "");
     LOGINFO(ss.str());
 
     ss.clear();
@@ -139,6 +113,9 @@ void TcpSslConn::init(const std::string& pubkeyfile,
 
     socket_stream_ = std::move(stream);
   } catch (const boost::exception& ex) {
+    // A cached session the server no longer accepts must not be offered again
+    ssl_context_->removeSession(peer_);
+
     // error handling
     std::string info = boost::diagnostic_information(ex);
     LOGDEBUG("caught boost exception: %s", info.c_str());
@@ -147,6 +124,13 @@ void TcpSslConn::init(const std::string& pubkeyfile,
 }
 
 TcpSslConn::~TcpSslConn() {
+  if (socket_stream_) {
+    // OpenSSL invalidates the session of a connection that was not shut down,
+    // mark it as closed so the session stays resumable for the next one.
+    SSL_set_shutdown(socket_stream_->native_handle(),
+                     SSL_SENT_SHUTDOWN | SSL_RECEIVED_SHUTDOWN);
+  }
+
   std::stringstream ss;
   ss << "Teardown SSL " << socket_.local_endpoint() << " -> ";
   try {
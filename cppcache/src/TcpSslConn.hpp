@@ -20,8 +20,11 @@
 #ifndef GEODE_TCPSSLCONN_H_
 #define GEODE_TCPSSLCONN_H_
 
+#include <memory>
+
 #include <boost/asio/ssl.hpp>
 
+#include "SslContext.hpp"
 #include "TcpConn.hpp"
 
 namespace apache {
@@ -33,7 +36,8 @@ class TcpSslConn : public TcpConn {
   using ssl_stream_type =
       boost::asio::ssl::stream<boost::asio::ip::tcp::socket&>;
 
-  boost::asio::ssl::context ssl_context_;
+  std::shared_ptr<SslContext> ssl_context_;
+  std::string peer_;
   std::unique_ptr<ssl_stream_type> socket_stream_;
   boost::asio::io_context::strand strand_;
 
@@ -50,30 +54,24 @@ class TcpSslConn : public TcpConn {
   TcpSslConn(const std::string& hostname, uint16_t port,
              const std::string& sniProxyHostname, uint16_t sniProxyPort,
              std::chrono::microseconds connect_timeout, int32_t maxBuffSizePool,
-             const std::string& pubkeyfile, const std::string& privkeyfile,
-             const std::string& pemPassword);
+             std::shared_ptr<SslContext> sslContext);
 
   TcpSslConn(const std::string& hostname, uint16_t port,
              std::chrono::microseconds connect_timeout, int32_t maxBuffSizePool,
-             const std::string& pubkeyfile, const std::string& privkeyfile,
-             const std::string& pemPassword);
+             std::shared_ptr<SslContext> sslContext);
 
   TcpSslConn(const std::string& ipaddr,
              std::chrono::microseconds connect_timeout, int32_t maxBuffSizePool,
-             const std::string& pubkeyfile, const std::string& privkeyfile,
-             const std::string& pemPassword);
+             std::shared_ptr<SslContext> sslContext);
 
   TcpSslConn(const std::string& ipaddr, std::chrono::microseconds waitSeconds,
              int32_t maxBuffSizePool, const std::string& sniProxyHostname,
-             uint16_t sniProxyPort, const std::string& publicKeyFile,
-             const std::string& privateKeyFile, const std::string& password);
+             uint16_t sniProxyPort, std::shared_ptr<SslContext> sslContext);
 
   ~TcpSslConn() override;
 
  private:
-  void init(const std::string& pubkeyfile, const std::string& privkeyfile,
-            const std::string& pemPassword,
-            const std::string& sniHostname = "");
+  void init(const std::string& sniHostname = "");
 };
 }  // namespace client
 }  // namespace geode
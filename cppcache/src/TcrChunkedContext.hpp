@@ -69,6 +69,13 @@ class TcrChunkedResult {
    */
   virtual void reset() = 0;
 
+  /**
+   * True if chunks must be handled by the thread reading them from the
+   * connection, even if there is a chunk processor thread. This lets
+   * handleChunk() block to stop the connection from being read further.
+   */
+  virtual bool handleInReadingThread() const { return false; }
+
   void fireHandleChunk(const uint8_t* bytes, int32_t len,
                        uint8_t isLastChunkWithSecurity,
                        const CacheImpl* cacheImpl) {
@@ -145,6 +152,10 @@ class TcrChunkedContext {
 
   inline size_t getLen() const { return m_chunk.size(); }
 
+  inline bool handleInReadingThread() const {
+    return m_result->handleInReadingThread();
+  }
+
   void handleChunk(bool inSameThread) {
     if (m_chunk.empty()) {
       // this is the last chunk for some set of chunks
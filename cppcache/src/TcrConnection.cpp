@@ -470,18 +470,16 @@ void TcrConnection::createConnection(const std::string& address,
                                .getSystemProperties();
 
   if (systemProperties.sslEnabled()) {
+    auto sslContext = m_connectionManager.getCacheImpl()->getSslContext();
     const auto& sniHostname = m_poolDM->getSniProxyHost();
     if (sniHostname.empty()) {
       m_conn.reset(new TcpSslConn(address, connectTimeout, maxBuffSizePool,
-                                  systemProperties.sslTrustStore(),
-                                  systemProperties.sslKeyStore(),
-                                  systemProperties.sslKeystorePassword()));
+                                  std::move(sslContext)));
     } else {
       const auto sniPort = m_poolDM->getSniProxyPort();
-      m_conn.reset(new TcpSslConn(
-          address, connectTimeout, maxBuffSizePool, sniHostname, sniPort,
-          systemProperties.sslTrustStore(), systemProperties.sslKeyStore(),
-          systemProperties.sslKeystorePassword()));
+      m_conn.reset(new TcpSslConn(address, connectTimeout, maxBuffSizePool,
+                                  sniHostname, sniPort,
+                                  std::move(sslContext)));
     }
   } else {
     m_conn.reset(new TcpConn(address, connectTimeout, maxBuffSizePool));
@@ -17,6 +17,8 @@
 
 #include "TcrMessage.hpp"
 
+#include <iterator>
+
 #include <geode/CacheableBuiltins.hpp>
 #include <geode/CacheableObjectArray.hpp>
 #include <geode/SystemProperties.hpp>
@@ -846,6 +848,10 @@ void TcrMessage::writeEventIdPart(int reserveSize,
   eid.writeIdsData(*m_request);
 }
 
+void TcrMessage::writeEventIdPart(EventId& eventId) {
+  eventId.writeIdsData(*m_request);
+}
+
 void TcrMessage::writeMessageLength() {
   auto totalLen = m_request->getBufferLength();
   auto msgLen = totalLen - kHeaderLength;
@@ -1135,11 +1141,19 @@ void TcrMessage::chunkSecurityHeader(int skipPart,
 }
 
 void TcrMessage::handleByteArrayResponse(
-    const char* bytearray, int32_t len, uint16_t endpointMemId,
-    const SerializationRegistry& serializationRegistry,
+    const std::shared_ptr<const char>& bytearray, int32_t len,
+    uint16_t endpointMemId, const SerializationRegistry& serializationRegistry,
     MemberListForVersionStamp& memberListForVersionStamp) {
-  auto input = m_tcdm->getConnectionManager().getCacheImpl()->createDataInput(
-      reinterpret_cast<uint8_t*>(const_cast<char*>(bytearray)), len, getPool());
+  auto cacheImpl = m_tcdm->getConnectionManager().getCacheImpl();
+  auto buffer = reinterpret_cast<const uint8_t*>(bytearray.get());
+  auto input = cacheImpl->createDataInput(buffer, len, getPool());
+  if (cacheImpl->getDistributedSystem()
+          .getSystemProperties()
+          .zeroCopyByteArrays()) {
+    // Byte arrays in the reply keep the buffer alive instead of copying it.
+    DataInputInternal::setBufferOwner(
+        input, std::shared_ptr<const uint8_t>(bytearray, buffer));
+  }
   // TODO:: this need to make sure that pool is there
   //  if(m_tcdm == nullptr)
   //  throw IllegalArgumentException("Pool is nullptr in TcrMessage");
@@ -2337,7 +2351,31 @@ TcrMessagePutAll::TcrMessagePutAll(
   m_region = region;
   m_messageResponseTimeout = messageResponsetimeout;
   m_request.reset(dataOutput);
+  writeRequest(region, map.begin(), map.end(), aCallbackArgument, nullptr);
+}
+
+TcrMessagePutAll::TcrMessagePutAll(
+    DataOutput* dataOutput, const Region* region,
+    HashMapOfCacheable::const_iterator first,
+    HashMapOfCacheable::const_iterator last,
+    std::chrono::milliseconds messageResponsetimeout,
+    ThinClientBaseDM* connectionDM,
+    const std::shared_ptr<Serializable>& aCallbackArgument,
+    EventId& eventId) {
+  m_tcdm = connectionDM;
+  m_regionName = region->getFullPath();
+  m_region = region;
+  m_messageResponseTimeout = messageResponsetimeout;
+  m_request.reset(dataOutput);
+  writeRequest(region, first, last, aCallbackArgument, &eventId);
+}
 
+void TcrMessagePutAll::writeRequest(
+    const Region* region, HashMapOfCacheable::const_iterator first,
+    HashMapOfCacheable::const_iterator last,
+    const std::shared_ptr<Serializable>& aCallbackArgument,
+    EventId* eventId) {
+  const auto size = static_cast<uint32_t>(std::distance(first, last));
   // TODO check the number of parts in this constructor. doubt because in PUT
   // value can be nullptr also.
   uint32_t numOfParts = 0;
@@ -2345,11 +2383,11 @@ TcrMessagePutAll::TcrMessagePutAll(
 
   if (aCallbackArgument != nullptr) {
     m_msgType = TcrMessage::PUT_ALL_WITH_CALLBACK;
-    numOfParts = 6 + static_cast<uint32_t>(map.size()) * 2;
+    numOfParts = 6 + size * 2;
     // skipCallBacks = false;
   } else {
     m_msgType = TcrMessage::PUTALL;
-    numOfParts = 5 + static_cast<uint32_t>(map.size()) * 2;
+    numOfParts = 5 + size * 2;
     // skipCallBacks = true;
   }
 
@@ -2361,7 +2399,11 @@ TcrMessagePutAll::TcrMessagePutAll(
 
   writeHeader(m_msgType, numOfParts);
   writeRegionPart(m_regionName);
-  writeEventIdPart(static_cast<uint32_t>(map.size()) - 1);
+  if (eventId) {
+    writeEventIdPart(*eventId);
+  } else {
+    writeEventIdPart(size - 1);
+  }
   // writeIntPart(skipCallBacks ? 0 : 1);
   writeIntPart(0);
 
@@ -2380,15 +2422,15 @@ TcrMessagePutAll::TcrMessagePutAll(
   }
   writeIntPart(flags);
 
-  writeIntPart(static_cast<int32_t>(map.size()));
+  writeIntPart(static_cast<int32_t>(size));
 
   if (aCallbackArgument != nullptr) {
     writeObjectPart(aCallbackArgument);
   }
 
-  for (const auto& iter : map) {
-    writeObjectPart(iter.first);
-    writeObjectPart(iter.second);
+  for (; first != last; ++first) {
+    writeObjectPart(first->first);
+    writeObjectPart(first->second);
   }
 
   if (m_messageResponseTimeout >= std::chrono::milliseconds::zero()) {
@@ -2988,8 +3030,9 @@ void TcrMessage::setData(const char* bytearray, int32_t len, uint16_t memId,
             getPool())));
   }
   if (bytearray) {
-    DeleteArray<const char> delByteArr(bytearray);
-    handleByteArrayResponse(bytearray, len, memId, serializationRegistry,
+    std::shared_ptr<const char> buffer(bytearray,
+                                       std::default_delete<const char[]>());
+    handleByteArrayResponse(buffer, len, memId, serializationRegistry,
                             memberListForVersionStamp);
   }
 }
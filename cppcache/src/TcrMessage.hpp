@@ -342,7 +342,8 @@ class TcrMessage {
 
   // some private methods to handle things internally.
   void handleByteArrayResponse(
-      const char* bytearray, int32_t len, uint16_t endpointMemId,
+      const std::shared_ptr<const char>& bytearray, int32_t len,
+      uint16_t endpointMemId,
       const SerializationRegistry& serializationRegistry,
       MemberListForVersionStamp& memberListForVersionStamp);
   void readObjectPart(DataInput& input, bool defaultString = false);
@@ -366,6 +367,7 @@ class TcrMessage {
   void writeStringPart(const std::string& str);
   void writeEventIdPart(int reserveSize = 0,
                         bool fullValueAfterDeltaFail = false);
+  void writeEventIdPart(EventId& eventId);
   void writeMessageLength();
   void writeInterestResultPolicyPart(InterestResultPolicy policy);
   void writeIntPart(int32_t intValue);
@@ -680,7 +682,27 @@ class TcrMessagePutAll : public TcrMessage {
                    ThinClientBaseDM* connectionDM,
                    const std::shared_ptr<Serializable>& aCallbackArgument);
 
+  /**
+   * Puts the entries in [first, last) of a map. The event id must reserve a
+   * sequence number for each of them; passing it in lets the request be
+   * serialized on a thread other than the one the putAll was called from.
+   */
+  TcrMessagePutAll(DataOutput* dataOutput, const Region* region,
+                   HashMapOfCacheable::const_iterator first,
+                   HashMapOfCacheable::const_iterator last,
+                   std::chrono::milliseconds messageResponsetimeout,
+                   ThinClientBaseDM* connectionDM,
+                   const std::shared_ptr<Serializable>& aCallbackArgument,
+                   EventId& eventId);
+
   ~TcrMessagePutAll() override = default;
+
+ private:
+  void writeRequest(const Region* region,
+                    HashMapOfCacheable::const_iterator first,
+                    HashMapOfCacheable::const_iterator last,
+                    const std::shared_ptr<Serializable>& aCallbackArgument,
+                    EventId* eventId);
 };
 
 class TcrMessageRemoveAll : public TcrMessage {
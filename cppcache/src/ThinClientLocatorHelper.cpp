@@ -96,16 +96,16 @@ std::unique_ptr<Connector> ThinClientLocatorHelper::createConnection(
   auto buffer_size = m_poolDM->getSocketBufferSize();
 
   if (sys_prop.sslEnabled()) {
+    auto ssl_context =
+        m_poolDM->getConnectionManager().getCacheImpl()->getSslContext();
     if (m_sniProxyHost.empty()) {
-      return std::unique_ptr<Connector>(new TcpSslConn(
-          hostname, static_cast<uint16_t>(port), timeout, buffer_size,
-          sys_prop.sslTrustStore(), sys_prop.sslKeyStore(),
-          sys_prop.sslKeystorePassword()));
+      return std::unique_ptr<Connector>(
+          new TcpSslConn(hostname, static_cast<uint16_t>(port), timeout,
+                         buffer_size, std::move(ssl_context)));
     } else {
       return std::unique_ptr<Connector>(new TcpSslConn(
           hostname, static_cast<uint16_t>(port), m_sniProxyHost, m_sniProxyPort,
-          timeout, buffer_size, sys_prop.sslTrustStore(),
-          sys_prop.sslKeyStore(), sys_prop.sslKeystorePassword()));
+          timeout, buffer_size, std::move(ssl_context)));
     }
   } else {
     return std::unique_ptr<Connector>(new TcpConn(
@@ -231,6 +231,13 @@ GfErrType ThinClientLocatorHelper::getEndpointForNewFwdConn(
       "ThinClientLocatorHelper::getEndpointForNewFwdConn maxAttempts = %zu",
       maxAttempts);
 
+  if (currentServer == nullptr &&
+      getCachedServer(outEndpoint, exclEndPts, serverGrp)) {
+    LOGFINE("Using cached server at [%s:%d]",
+            outEndpoint.getServerName().c_str(), outEndpoint.getPort());
+    return GF_NOERR;
+  }
+
   for (auto attempt = 0ULL; attempt < maxAttempts;) {
     const auto& loc = locators[attempt++ % locatorsSize];
     LOGFINE("Querying locator at [%s:%d] for server from group [%s]",
@@ -275,6 +282,31 @@ GfErrType ThinClientLocatorHelper::getEndpointForNewFwdConn(
   }
 }
 
+bool ThinClientLocatorHelper::getCachedServer(
+    ServerLocation& outEndpoint, const std::set<ServerLocation>& exclEndPts,
+    const std::string& serverGrp) const {
+  const auto ttl = m_poolDM->getConnectionManager()
+                       .getCacheImpl()
+                       ->getDistributedSystem()
+                       .getSystemProperties()
+                       .locatorCacheTtl();
+  if (ttl <= std::chrono::milliseconds::zero()) {
+    return false;
+  }
+
+  return serverListCache_.getServer(
+      outEndpoint, exclEndPts, serverGrp, ttl, [this, &serverGrp]() {
+        std::vector<std::shared_ptr<ServerLocation>> servers;
+        getAllServers(servers, serverGrp);
+        std::vector<ServerLocation> locations;
+        locations.reserve(servers.size());
+        for (const auto& server : servers) {
+          locations.push_back(*server);
+        }
+        return locations;
+      });
+}
+
 GfErrType ThinClientLocatorHelper::updateLocators(
     const std::string& serverGrp) {
   auto locators = getLocators();
@@ -32,6 +32,7 @@
 #include "ErrType.hpp"
 #include "GetAllServersRequest.hpp"
 #include "GetAllServersResponse.hpp"
+#include "LocatorServerListCache.hpp"
 #include "ServerLocation.hpp"
 
 namespace apache {
@@ -105,11 +106,22 @@ class ThinClientLocatorHelper {
       const ServerLocation& location,
       const std::shared_ptr<Serializable>& request) const;
 
+  /**
+   * Picks a server for a new connection from the server list cached for
+   * locator-cache-ttl, see LocatorServerListCache.
+   * @return true if outEndpoint was set, false if the caller should ask the
+   *         locators for a server
+   */
+  bool getCachedServer(ServerLocation& outEndpoint,
+                       const std::set<ServerLocation>& exclEndPts,
+                       const std::string& serverGrp) const;
+
   /**
    * Data members
    */
   mutable boost::shared_mutex mutex_;
   std::vector<ServerLocation> locators_;
+  mutable LocatorServerListCache serverListCache_;
   const ThinClientPoolDM* m_poolDM;
   std::string m_sniProxyHost;
   int m_sniProxyPort;
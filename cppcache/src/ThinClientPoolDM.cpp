@@ -29,6 +29,7 @@
 #include "DistributedSystemImpl.hpp"
 #include "ExecutionImpl.hpp"
 #include "FunctionExpiryTask.hpp"
+#include "SelectResultsStreamImpl.hpp"
 #include "TcrConnectionManager.hpp"
 #include "TcrEndpoint.hpp"
 #include "ThinClientRegion.hpp"
@@ -62,7 +63,10 @@ class GetAllWork : public PooledWork<GfErrType> {
   std::string m_regionName;
   const std::shared_ptr<std::vector<std::shared_ptr<CacheableKey>>> m_keys;
   const std::shared_ptr<Region> m_region;
-  TcrChunkedResult* m_resultCollector;
+  // Results are buffered per worker and merged into m_responseHandler once all
+  // workers have completed, so workers never contend on a shared lock.
+  std::recursive_mutex m_responseLock;
+  ChunkedGetAllResponse* m_resultCollector;
   const std::shared_ptr<Serializable>& m_aCallbackArgument;
 
  public:
@@ -94,12 +98,25 @@ class GetAllWork : public PooledWork<GfErrType> {
       m_userAttribute = UserAttributes::threadLocalUserAttributes;
     }
 
+    std::shared_ptr<HashMapOfCacheable> values;
+    if (m_responseHandler->getValues()) {
+      values = std::make_shared<HashMapOfCacheable>();
+      values->reserve(m_keys->size());
+    }
+    std::shared_ptr<HashMapOfException> exceptions;
+    if (m_responseHandler->getExceptions()) {
+      exceptions = std::make_shared<HashMapOfException>();
+    }
+    std::shared_ptr<std::vector<std::shared_ptr<CacheableKey>>> resultKeys;
+    if (m_responseHandler->getResultKeys()) {
+      resultKeys =
+          std::make_shared<std::vector<std::shared_ptr<CacheableKey>>>();
+    }
+
     m_resultCollector = (new ChunkedGetAllResponse(
         *m_reply, dynamic_cast<ThinClientRegion*>(m_region.get()), m_keys.get(),
-        m_responseHandler->getValues(), m_responseHandler->getExceptions(),
-        m_responseHandler->getResultKeys(),
-        m_responseHandler->getUpdateCounters(), 0, m_addToLocalCache,
-        m_responseHandler->getResponseLock()));
+        values, exceptions, resultKeys, m_responseHandler->getUpdateCounters(),
+        0, m_addToLocalCache, m_responseLock));
 
     m_reply->setChunkedResultHandler(m_resultCollector);
   }
@@ -112,6 +129,10 @@ class GetAllWork : public PooledWork<GfErrType> {
 
   TcrMessage* getReply() { return m_reply; }
 
+  const ChunkedGetAllResponse* getResultCollector() const {
+    return m_resultCollector;
+  }
+
   void init() {}
   GfErrType execute() override {
     GuardUserAttributes gua;
@@ -126,6 +147,21 @@ class GetAllWork : public PooledWork<GfErrType> {
   }
 };
 
+class RestoreConnectionsWork : public PooledWork<int32_t> {
+  ThinClientPoolDM& m_poolDM;
+  std::atomic<bool>& m_isRunning;
+  ThinClientPoolDM::RestoreState& m_state;
+
+ public:
+  RestoreConnectionsWork(ThinClientPoolDM& poolDM, std::atomic<bool>& isRunning,
+                         ThinClientPoolDM::RestoreState& state)
+      : m_poolDM(poolDM), m_isRunning(isRunning), m_state(state) {}
+
+  int32_t execute() override {
+    return m_poolDM.restoreConnections(m_isRunning, m_state);
+  }
+};
+
 const char* ThinClientPoolDM::NC_Ping_Thread = "NC Ping Thread";
 const char* ThinClientPoolDM::NC_MC_Thread = "NC MC Thread";
 #define PRIMARY_QUEUE_NOT_AVAILABLE -2
@@ -156,7 +192,8 @@ ThinClientPoolDM::ThinClientPoolDM(const char* name,
       connected_endpoints_(0),
       m_PoolStatsSampler(nullptr),
       m_clientMetadataService(nullptr),
-      m_primaryServerQueueSize(PRIMARY_QUEUE_NOT_AVAILABLE) {
+      m_primaryServerQueueSize(PRIMARY_QUEUE_NOT_AVAILABLE),
+      m_queryStreamsClosed(false) {
   static bool firstGuard = false;
   if (firstGuard) {
     ClientProxyMembershipID::increaseSynchCounter();
@@ -192,7 +229,9 @@ ThinClientPoolDM::ThinClientPoolDM(const char* name,
                                             m_attrs->m_sniProxyPort, this);
 
   m_stats = new PoolStats(
-      cacheImpl->getStatisticsManager().getStatisticsFactory(), m_poolName);
+      cacheImpl->getStatisticsManager().getStatisticsFactory(), m_poolName,
+      props.getEnableTimeStatistics() ? &cacheImpl->getStatisticsManager()
+                                      : nullptr);
   cacheImpl->getStatisticsManager().forceSample();
 
   if (!props.isEndpointShufflingDisabled()) {
@@ -228,6 +267,23 @@ void ThinClientPoolDM::init() {
 
   ThinClientPoolDM::startBackgroundThreads();
 
+  auto warmupTimeout = cacheImpl->getDistributedSystem()
+                           .getSystemProperties()
+                           .poolWarmupTimeout();
+  if (warmupTimeout > std::chrono::milliseconds::zero() &&
+      m_attrs->getMinConnections() > 0) {
+    std::atomic<bool> isRunning(true);
+    restoreMinConnections(isRunning,
+                          std::chrono::steady_clock::now() + warmupTimeout);
+    if (m_poolSize < m_attrs->getMinConnections()) {
+      LOGWARN(
+          "ThinClientPoolDM::init: pool %s has %d of %d connections after "
+          "waiting %s, creating the rest in the background",
+          m_poolName.c_str(), m_poolSize.load(), m_attrs->getMinConnections(),
+          to_string(warmupTimeout).c_str());
+    }
+  }
+
   LOGDEBUG("ThinClientPoolDM::init: Completed initialization");
 }
 
@@ -519,35 +575,152 @@ void ThinClientPoolDM::cleanStaleConnections(std::atomic<bool>& isRunning) {
 
 void ThinClientPoolDM::cleanStickyConnections(std::atomic<bool>&) {}
 
-void ThinClientPoolDM::restoreMinConnections(std::atomic<bool>& isRunning) {
+void ThinClientPoolDM::restoreMinConnections(
+    std::atomic<bool>& isRunning,
+    std::chrono::steady_clock::time_point deadline) {
   if (!isRunning) {
     return;
   }
 
+  // A blocking warm up in init() and the manage connections thread must not
+  // both top up the pool.
+  std::lock_guard<decltype(restore_mutex_)> guard(restore_mutex_);
+
   LOGDEBUG("Restoring minimum connection level");
 
   int min = m_attrs->getMinConnections();
-  int limit = 2 * min;
+  int32_t needed = min - m_poolSize;
+  int32_t restored = 0;
+
+  if (needed > 0) {
+    RestoreState state;
+    state.nextServer = 0;
+    state.remaining = needed;
+    state.attempts = 2 * min;
+    state.deadline = deadline;
+
+    auto& props = m_connManager.getCacheImpl()
+                      ->getDistributedSystem()
+                      .getSystemProperties();
+    int32_t threads = std::min(
+        needed, static_cast<int32_t>(std::max(props.poolWarmupThreads(), 1u)));
+
+    // Connections created concurrently are spread round robin over the
+    // servers, one locator request for all of them, since a locator would
+    // answer concurrent requests with the same least loaded server.
+    if (needed > 1) {
+      try {
+        auto servers = getServers();
+        for (int32_t i = 0; servers && i < servers->length(); i++) {
+          state.servers.push_back((*servers)[i]->value());
+        }
+        if (!state.servers.empty()) {
+          RandGen randGen;
+          state.nextServer = randGen(state.servers.size());
+        }
+      } catch (const Exception& e) {
+        LOGFINE("Server list unavailable for restoring connections: %s",
+                e.what());
+      }
+    }
+
+    std::vector<std::shared_ptr<RestoreConnectionsWork>> workers;
+    auto& threadPool = m_connManager.getCacheImpl()->getThreadPool();
+    for (int32_t i = 1; i < threads; i++) {
+      auto worker =
+          std::make_shared<RestoreConnectionsWork>(*this, isRunning, state);
+      threadPool.perform(worker);
+      workers.push_back(std::move(worker));
+    }
+
+    restored = restoreConnections(isRunning, state);
+    for (auto& worker : workers) {
+      restored += worker->getResult();
+    }
+  }
 
+  LOGDEBUG("Restored %d connections", restored);
+  LOGDEBUG("Pool size is %zu, pool counter is %d", size(), m_poolSize.load());
+}
+
+int32_t ThinClientPoolDM::restoreConnections(std::atomic<bool>& isRunning,
+                                             RestoreState& state) {
+  auto takeOne = [](std::atomic<int32_t>& counter) {
+    auto value = counter.load();
+    while (value > 0 && !counter.compare_exchange_weak(value, value - 1)) {
+    }
+    return value > 0;
+  };
+
+  int32_t restored = 0;
   std::set<ServerLocation> excludeServers;
 
-  int restored = 0;
+  const auto min = m_attrs->getMinConnections();
+  const auto connectTimeout = getConnectTimeout({});
+
+  try {
+    while (isRunning && takeOne(state.remaining)) {
+      // Other threads create connections too, so the pool may have reached
+      // its minimum since the shortfall was computed.
+      if (m_poolSize >= min) {
+        state.remaining++;
+        break;
+      }
+
+      // No single attempt may outlast the deadline.
+      auto timeout = connectTimeout;
+      if (state.deadline != std::chrono::steady_clock::time_point::max()) {
+        auto left = std::chrono::duration_cast<std::chrono::microseconds>(
+            state.deadline - std::chrono::steady_clock::now());
+        if (left <= std::chrono::microseconds::zero()) {
+          state.remaining++;
+          break;
+        }
+        timeout = std::min(timeout, left);
+      }
+
+      if (!takeOne(state.attempts)) {
+        state.remaining++;
+        break;
+      }
 
-  if (m_poolSize < min) {
-    while (m_poolSize < min && limit-- && isRunning) {
       TcrConnection* conn = nullptr;
       bool maxConnLimit = false;
-      createPoolConnection(conn, excludeServers, maxConnLimit);
+
+      if (!state.servers.empty()) {
+        const auto& server =
+            state.servers[state.nextServer++ % state.servers.size()];
+        if (!excludeServer(server, excludeServers)) {
+          createPoolConnectionToAEndPoint(conn, addEP(server).get(),
+                                          maxConnLimit, false, timeout);
+          if (conn == nullptr) {
+            excludeServers.insert(ServerLocation(server));
+          }
+        }
+      }
+      if (conn == nullptr && !maxConnLimit) {
+        createPoolConnection(conn, excludeServers, maxConnLimit, nullptr,
+                             timeout);
+      }
+
       if (conn) {
         put(conn, false);
         restored++;
         getStats().incMinPoolSizeConnects();
+      } else {
+        state.remaining++;
+        if (maxConnLimit) {
+          break;
+        }
       }
     }
+  } catch (const std::exception& e) {
+    LOGERROR("Failed to restore connections: %s", e.what());
+  } catch (...) {
+    LOGERROR("Failed to restore connections");
   }
 
-  LOGDEBUG("Restored %d connections", restored);
-  LOGDEBUG("Pool size is %zu, pool counter is %d", size(), m_poolSize.load());
+  return restored;
 }
 
 void ThinClientPoolDM::manageConnectionsInternal(std::atomic<bool>& isRunning) {
@@ -791,6 +964,7 @@ void ThinClientPoolDM::destroy(bool keepAlive) {
       m_remoteQueryServicePtr->close();
       m_remoteQueryServicePtr = nullptr;
     }
+    closeQueryStreams();
 
     LOGDEBUG("Closing PoolStatsSampler thread.");
     if (m_PoolStatsSampler) {
@@ -847,6 +1021,36 @@ void ThinClientPoolDM::destroy(bool keepAlive) {
   }
 }
 
+void ThinClientPoolDM::addQueryStream(
+    const std::shared_ptr<SelectResultsStreamImpl>& stream) {
+  std::lock_guard<decltype(m_queryStreamsMutex)> guard(m_queryStreamsMutex);
+  if (m_queryStreamsClosed) {
+    stream->close();
+    return;
+  }
+  m_queryStreams.erase(
+      std::remove_if(m_queryStreams.begin(), m_queryStreams.end(),
+                     [](const std::weak_ptr<SelectResultsStreamImpl>& entry) {
+                       return entry.expired();
+                     }),
+      m_queryStreams.end());
+  m_queryStreams.push_back(stream);
+}
+
+void ThinClientPoolDM::closeQueryStreams() {
+  std::vector<std::weak_ptr<SelectResultsStreamImpl>> streams;
+  {
+    std::lock_guard<decltype(m_queryStreamsMutex)> guard(m_queryStreamsMutex);
+    m_queryStreamsClosed = true;
+    streams.swap(m_queryStreams);
+  }
+  for (auto& entry : streams) {
+    if (auto stream = entry.lock()) {
+      stream->close();
+    }
+  }
+}
+
 bool ThinClientPoolDM::isDestroyed() const {
   // TODO: dummy implementation
   return m_isDestroyed;
@@ -1248,6 +1452,8 @@ GfErrType ThinClientPoolDM::sendSyncRequest(TcrMessage& request,
       if (currentReply->getMessageType() != TcrMessage::RESPONSE) {
         reply.setMessageType(currentReply->getMessageType());
       }
+
+      responseHandler->add(worker->getResultCollector());
     }
     return error;
   } else {
@@ -1494,6 +1700,10 @@ GfErrType ThinClientPoolDM::sendSyncRequest(
             m_connManager.getCacheImpl()->getRegion(request.getRegionName());
 
         if (region != nullptr) {
+          if (auto localRegion =
+                  std::dynamic_pointer_cast<LocalRegion>(region)) {
+            localRegion->getRegionStats()->incSingleHopMisroutes();
+          }
           if (!connFound)  // max limit case then don't refresh otherwise
                            // always refresh
           {
@@ -1661,7 +1871,7 @@ GfErrType ThinClientPoolDM::getConnectionToAnEndPoint(std::string epNameStr,
 // connection to the specified endpoint. Else, throws an error.
 GfErrType ThinClientPoolDM::createPoolConnectionToAEndPoint(
     TcrConnection*& conn, TcrEndpoint* theEP, bool& maxConnLimit,
-    bool appThreadrequest) {
+    bool appThreadrequest, std::chrono::microseconds connectTimeout) {
   GfErrType error = GF_NOERR;
   conn = nullptr;
   int min = 0;
@@ -1692,11 +1902,8 @@ GfErrType ThinClientPoolDM::createPoolConnectionToAEndPoint(
       theEP->name().c_str());
   // if the pool size is within limits, create a new connection.
   error = theEP->createNewConnection(conn, false, false,
-                                     m_connManager.getCacheImpl()
-                                         ->getDistributedSystem()
-                                         .getSystemProperties()
-                                         .connectTimeout(),
-                                     false, appThreadrequest);
+                                     getConnectTimeout(connectTimeout), false,
+                                     appThreadrequest);
   if (conn == nullptr || error != GF_NOERR) {
     LOGFINE("2Failed to connect to %s", theEP->name().c_str());
     if (conn != nullptr) _GEODE_SAFE_DELETE(conn);
@@ -1721,9 +1928,21 @@ void ThinClientPoolDM::reducePoolSize(int num) {
   m_poolSize -= num;
 }
 
+std::chrono::microseconds ThinClientPoolDM::getConnectTimeout(
+    std::chrono::microseconds connectTimeout) const {
+  if (connectTimeout > std::chrono::microseconds::zero()) {
+    return connectTimeout;
+  }
+  return m_connManager.getCacheImpl()
+      ->getDistributedSystem()
+      .getSystemProperties()
+      .connectTimeout();
+}
+
 GfErrType ThinClientPoolDM::createPoolConnection(
     TcrConnection*& conn, std::set<ServerLocation>& excludeServers,
-    bool& maxConnLimit, const TcrConnection* currentserver) {
+    bool& maxConnLimit, const TcrConnection* currentserver,
+    std::chrono::microseconds connectTimeout) {
   GfErrType error = GF_NOERR;
   int max = m_attrs->getMaxConnections();
   if (max == -1) {
@@ -1763,12 +1982,8 @@ GfErrType ThinClientPoolDM::createPoolConnection(
       conn->updateCreationTime();
       break;
     } else {
-      error = ep->createNewConnection(conn, false, false,
-                                      m_connManager.getCacheImpl()
-                                          ->getDistributedSystem()
-                                          .getSystemProperties()
-                                          .connectTimeout(),
-                                      false);
+      error = ep->createNewConnection(
+          conn, false, false, getConnectTimeout(connectTimeout), false);
     }
 
     if (conn == nullptr || error != GF_NOERR) {
@@ -1829,7 +2044,8 @@ TcrConnection* ThinClientPoolDM::getConnectionFromQueue(
   if (enableTimeStatistics) {
     Utils::updateStatOpTime(getStats().getStats(),
                             getStats().getTotalWaitingConnTimeId(),
-                            sampleStartNanos);
+                            sampleStartNanos,
+                            getStats().getConnectionCheckoutLatency());
   }
   getStats().decCurWaitingConnections();
   return mp;
@@ -63,6 +63,7 @@ namespace client {
 class CacheImpl;
 class FunctionExecution;
 class ClientMetadataService;
+class SelectResultsStreamImpl;
 
 class ThinClientPoolDM
     : public ThinClientBaseDM,
@@ -125,7 +126,9 @@ class ThinClientPoolDM
   GfErrType createPoolConnection(TcrConnection*& conn,
                                  std::set<ServerLocation>& excludeServers,
                                  bool& maxConnLimit,
-                                 const TcrConnection* currentServer = nullptr);
+                                 const TcrConnection* currentServer = nullptr,
+                                 std::chrono::microseconds connectTimeout =
+                                     std::chrono::microseconds::zero());
   ThinClientLocatorHelper* getLocatorHelper() { return m_locHelper; }
   void releaseThreadLocalConnection() override;
   virtual void setThreadLocalConnection(TcrConnection* conn);
@@ -187,6 +190,12 @@ class ThinClientPoolDM
   int getPrimaryServerQueueSize() const { return m_primaryServerQueueSize; }
   bool isKeepAlive() const { return m_keepAlive; }
 
+  /**
+   * Registers a query stream whose reply is read through this pool, so that
+   * destroying the pool closes the stream and waits for its reader.
+   */
+  void addQueryStream(const std::shared_ptr<SelectResultsStreamImpl>& stream);
+
  protected:
   ThinClientStickyManager* m_manager;
   std::vector<std::string> m_canonicalHosts;
@@ -235,11 +244,13 @@ class ThinClientPoolDM
       TcrMessage& request, int8_t& version,
       std::shared_ptr<BucketServerLocation>& serverLocation,
       std::set<ServerLocation>& excludeServers);
-  // Create pool connection to a specified endpoint.
-  GfErrType createPoolConnectionToAEndPoint(TcrConnection*& conn,
-                                            TcrEndpoint* theEP,
-                                            bool& maxConnLimit,
-                                            bool appThreadrequest = false);
+  // Create pool connection to a specified endpoint. A zero connectTimeout
+  // uses the connect-timeout system property.
+  GfErrType createPoolConnectionToAEndPoint(
+      TcrConnection*& conn, TcrEndpoint* theEP, bool& maxConnLimit,
+      bool appThreadrequest = false,
+      std::chrono::microseconds connectTimeout =
+          std::chrono::microseconds::zero());
 
  private:
   bool hasExpired(TcrConnection* conn);
@@ -306,7 +317,23 @@ class ThinClientPoolDM
   void manageConnections(std::atomic<bool>& isRunning);
   void manageConnectionsInternal(std::atomic<bool>& isRunning);
   void cleanStaleConnections(std::atomic<bool>& isRunning);
-  void restoreMinConnections(std::atomic<bool>& isRunning);
+  std::chrono::microseconds getConnectTimeout(
+      std::chrono::microseconds connectTimeout) const;
+  void restoreMinConnections(std::atomic<bool>& isRunning,
+                             std::chrono::steady_clock::time_point deadline =
+                                 std::chrono::steady_clock::time_point::max());
+
+  // Work shared by the threads of one restoreMinConnections call.
+  struct RestoreState {
+    std::vector<std::string> servers;
+    std::atomic<size_t> nextServer;
+    std::atomic<int32_t> remaining;
+    std::atomic<int32_t> attempts;
+    std::chrono::steady_clock::time_point deadline;
+  };
+  int32_t restoreConnections(std::atomic<bool>& isRunning,
+                             RestoreState& state);
+  std::mutex restore_mutex_;
   std::atomic<int32_t> m_clientOps;  // Actual Size of Pool
   std::atomic<int32_t> connected_endpoints_;
   std::unique_ptr<statistics::PoolStatsSampler> m_PoolStatsSampler;
@@ -316,9 +343,14 @@ class ThinClientPoolDM
   friend class CacheImpl;
   friend class ThinClientStickyManager;
   friend class FunctionExecution;
+  friend class RestoreConnectionsWork;
   static const char* NC_Ping_Thread;
   static const char* NC_MC_Thread;
   int m_primaryServerQueueSize;
+  std::mutex m_queryStreamsMutex;
+  std::vector<std::weak_ptr<SelectResultsStreamImpl>> m_queryStreams;
+  bool m_queryStreamsClosed;
+  void closeQueryStreams();
   void removeEPFromMetadataIfError(const GfErrType& error,
                                    const TcrEndpoint* ep);
 };
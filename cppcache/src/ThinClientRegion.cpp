@@ -18,6 +18,7 @@
 #include "ThinClientRegion.hpp"
 
 #include <algorithm>
+#include <exception>
 
 #include <boost/regex.hpp>
 #include <boost/thread/lock_types.hpp>
@@ -31,9 +32,12 @@
 #include "CacheImpl.hpp"
 #include "CacheRegionHelper.hpp"
 #include "DataInputInternal.hpp"
+#include "EventId.hpp"
+#include "InitialImageLoader.hpp"
 #include "PutAllPartialResultServerException.hpp"
 #include "RegionGlobalLocks.hpp"
 #include "RemoteQuery.hpp"
+#include "SelectResultsStreamImpl.hpp"
 #include "TcrConnectionManager.hpp"
 #include "TcrDistributionManager.hpp"
 #include "TcrEndpoint.hpp"
@@ -51,6 +55,65 @@ namespace client {
 
 void setThreadLocalExceptionMessage(std::string exMsg);
 
+namespace {
+
+// Adds the results of a putAll batch that succeeded to those of the batches
+// before it. Its keys are added when the servers did not return them, so that
+// after a later batch fails the batches that succeeded can still be applied
+// to the local cache key by key.
+template <typename Iterator>
+void addBatchResults(
+    std::shared_ptr<VersionedCacheableObjectPartList>& results,
+    const std::shared_ptr<VersionedCacheableObjectPartList>& batchResults,
+    Iterator first, Iterator last) {
+  if (batchResults == nullptr) {
+    return;
+  }
+  auto keys = batchResults->getSucceededKeys();
+  if (keys == nullptr || keys->empty()) {
+    auto batchKeys =
+        std::make_shared<std::vector<std::shared_ptr<CacheableKey>>>();
+    for (; first != last; ++first) {
+      batchKeys->push_back(first->first);
+    }
+    batchResults->addAllKeys(batchKeys);
+  }
+  if (results) {
+    results->addAll(batchResults);
+  } else {
+    results = batchResults;
+  }
+}
+
+// Returns the error of a putAll whose batch failed with err. Once earlier
+// batches are on the servers the error is a partial result carrying their
+// keys, so that they are applied to the local cache too.
+GfErrType failedBatchResult(
+    GfErrType err, std::shared_ptr<VersionedCacheableObjectPartList>& results,
+    const std::shared_ptr<VersionedCacheableObjectPartList>& batchResults) {
+  if (results == nullptr) {
+    results = batchResults;
+    return err;
+  }
+  LOGFINE("putAll batch failed with error %d after %zu entries", err,
+          results->getSucceededKeys()->size());
+  if (err == GF_PUTALL_PARTIAL_RESULT_EXCEPTION && batchResults) {
+    results->addAll(batchResults);
+  }
+  return GF_PUTALL_PARTIAL_RESULT_EXCEPTION;
+}
+
+// Returns the time left until deadline, or GF_TIMEOUT in err if none is.
+std::chrono::milliseconds remainingTime(
+    std::chrono::steady_clock::time_point deadline, GfErrType& err) {
+  auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+      deadline - std::chrono::steady_clock::now());
+  err = remaining > std::chrono::milliseconds::zero() ? GF_NOERR : GF_TIMEOUT;
+  return remaining;
+}
+
+}  // namespace
+
 class PutAllWork : public PooledWork<GfErrType> {
   ThinClientPoolDM* m_poolDM;
   std::shared_ptr<BucketServerLocation> m_serverLocation;
@@ -185,6 +248,68 @@ class PutAllWork : public PooledWork<GfErrType> {
   }
 };
 
+// Serializes one batch of a pipelined putAll while the batch before it is
+// sent.
+class PutAllBatchWork : public PooledWork<GfErrType> {
+  ThinClientRegion* m_region;
+  HashMapOfCacheable::const_iterator m_first;
+  HashMapOfCacheable::const_iterator m_last;
+  std::chrono::milliseconds m_timeout;
+  ThinClientBaseDM* m_distMgr;
+  std::shared_ptr<Serializable> m_callbackArgument;
+  EventId m_eventId;
+  std::unique_ptr<TcrMessagePutAll> m_request;
+  std::exception_ptr m_exception;
+
+ public:
+  PutAllBatchWork(const PutAllBatchWork&) = delete;
+  PutAllBatchWork& operator=(const PutAllBatchWork&) = delete;
+  PutAllBatchWork(ThinClientRegion* region,
+                  HashMapOfCacheable::const_iterator first,
+                  HashMapOfCacheable::const_iterator last, uint32_t count,
+                  std::chrono::milliseconds timeout,
+                  ThinClientBaseDM* distMgr,
+                  const std::shared_ptr<Serializable>& aCallbackArgument)
+      : m_region(region),
+        m_first(first),
+        m_last(last),
+        m_timeout(timeout),
+        m_distMgr(distMgr),
+        m_callbackArgument(aCallbackArgument),
+        // Reserved on the calling thread, which owns the sequence numbers.
+        m_eventId(true, count - 1) {}
+
+  ~PutAllBatchWork() noexcept override = default;
+
+  HashMapOfCacheable::const_iterator first() const { return m_first; }
+  HashMapOfCacheable::const_iterator last() const { return m_last; }
+
+  /**
+   * Waits for the batch to be serialized and returns its request, rethrowing
+   * any exception thrown while serializing it.
+   */
+  std::unique_ptr<TcrMessagePutAll> getRequest() {
+    getResult();
+    if (m_exception) {
+      std::rethrow_exception(m_exception);
+    }
+    return std::move(m_request);
+  }
+
+ protected:
+  GfErrType execute(void) override {
+    try {
+      m_request = std::unique_ptr<TcrMessagePutAll>(new TcrMessagePutAll(
+          new DataOutput(m_region->getCacheImpl()->createDataOutput()),
+          m_region, m_first, m_last, m_timeout, m_distMgr, m_callbackArgument,
+          m_eventId));
+    } catch (...) {
+      m_exception = std::current_exception();
+    }
+    return GF_NOERR;
+  }
+};
+
 class RemoveAllWork : public PooledWork<GfErrType> {
   ThinClientPoolDM* m_poolDM;
   std::shared_ptr<BucketServerLocation> m_serverLocation;
@@ -311,6 +436,17 @@ class RemoveAllWork : public PooledWork<GfErrType> {
   }
 };
 
+class ConflatedEventsWork : public Callable {
+ public:
+  explicit ConflatedEventsWork(std::shared_ptr<ThinClientRegion> region)
+      : region_(std::move(region)) {}
+
+  void call() override { region_->drainConflatedEvents(); }
+
+ private:
+  std::shared_ptr<ThinClientRegion> region_;
+};
+
 ThinClientRegion::ThinClientRegion(
     const std::string& name, CacheImpl* cacheImpl,
     const std::shared_ptr<RegionInternal>& rPtr, RegionAttributes attributes,
@@ -318,12 +454,22 @@ ThinClientRegion::ThinClientRegion(
     : LocalRegion(name, cacheImpl, rPtr, attributes, stats, shared),
       m_tcrdm(nullptr),
       m_notifyRelease(false),
-      m_isMetaDataRefreshed(false) {
+      m_isMetaDataRefreshed(false),
+      m_metadataGeneration(std::make_shared<ClientMetadataGeneration>(0)) {
   m_transactionEnabled = true;
   m_isDurableClnt = !cacheImpl->getDistributedSystem()
                          .getSystemProperties()
                          .durableClientId()
                          .empty();
+  if (auto limit = m_regionAttributes.getNegativeCacheEntriesLimit()) {
+    m_negativeLookupCache = std::unique_ptr<NegativeLookupCache>(
+        new NegativeLookupCache(
+            limit, m_regionAttributes.getNegativeCacheTimeToLive()));
+  }
+  if (m_regionAttributes.getSubscriptionConflationEnabled()) {
+    m_conflationQueue = std::unique_ptr<SubscriptionConflationQueue>(
+        new SubscriptionConflationQueue());
+  }
 }
 
 void ThinClientRegion::initTCR() {
@@ -873,6 +1019,21 @@ GfErrType ThinClientRegion::getNoThrow_remote(
     std::shared_ptr<VersionTag>& versionTag) {
   GfErrType err = GF_NOERR;
 
+  // Transactions see their own uncommitted puts, so they bypass the cache.
+  auto negativeLookupCache = TSSTXStateWrapper::get().getTXState()
+                                 ? nullptr
+                                 : m_negativeLookupCache.get();
+  uint64_t generation = 0;
+  if (negativeLookupCache) {
+    if (negativeLookupCache->contains(keyPtr)) {
+      m_regionStats->incNegativeCacheHits();
+      valPtr = nullptr;
+      return GF_NOERR;
+    }
+    m_regionStats->incNegativeCacheMisses();
+    generation = negativeLookupCache->generation();
+  }
+
   /** @brief Create message and send to bridge server */
 
   TcrMessageRequest request(new DataOutput(m_cacheImpl->createDataOutput()),
@@ -886,6 +1047,9 @@ GfErrType ThinClientRegion::getNoThrow_remote(
     case TcrMessage::RESPONSE: {
       valPtr = reply.getValue();
       versionTag = reply.getVersionTag();
+      if (negativeLookupCache && valPtr == nullptr) {
+        negativeLookupCache->add(keyPtr, generation);
+      }
       break;
     }
     case TcrMessage::EXCEPTION: {
@@ -981,6 +1145,8 @@ GfErrType ThinClientRegion::putNoThrow_remote(
       err = m_tcrdm->sendSyncRequest(putRequest, *reply);
     }
   }
+  // Even a failed put may have reached the server.
+  forgetAbsentKey(keyPtr);
   if (err != GF_NOERR) return err;
 
   // put the object into local region
@@ -1237,6 +1403,48 @@ GfErrType ThinClientRegion::singleHopPutAllNoThrow_remote(
     const std::shared_ptr<Serializable>& aCallbackArgument) {
   LOGDEBUG(" ThinClientRegion::singleHopPutAllNoThrow_remote map size = %zu",
            map.size());
+
+  // Large maps are routed a batch at a time to bound the size of the
+  // per-server requests.
+  auto batchSize = getCacheImpl()
+                       ->getDistributedSystem()
+                       .getSystemProperties()
+                       .putAllBatchSize();
+  if (batchSize > 0 && map.size() > batchSize) {
+    // The batches share the timeout of the whole putAll.
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    versionedObjPartList = nullptr;
+    for (auto next = map.begin(); next != map.end();) {
+      HashMapOfCacheable batch;
+      batch.reserve(batchSize);
+      for (; next != map.end() && batch.size() < batchSize; ++next) {
+        batch.emplace(next->first, next->second);
+      }
+
+      std::shared_ptr<VersionedCacheableObjectPartList> batchList;
+      auto err = GF_NOERR;
+      auto remaining = remainingTime(deadline, err);
+      if (err == GF_NOERR) {
+        try {
+          err = singleHopPutAllNoThrow_remote(tcrdm, batch, batchList,
+                                              remaining, aCallbackArgument);
+        } catch (const std::exception& ex) {
+          if (versionedObjPartList == nullptr) {
+            throw;
+          }
+          setThreadLocalExceptionMessage(ex.what());
+          return failedBatchResult(GF_EUNDEF, versionedObjPartList, nullptr);
+        }
+      }
+      if (err != GF_NOERR) {
+        return failedBatchResult(err, versionedObjPartList, batchList);
+      }
+      addBatchResults(versionedObjPartList, batchList, batch.begin(),
+                      batch.end());
+    }
+    return GF_NOERR;
+  }
+
   auto region = shared_from_this();
 
   auto error = GF_NOERR;
@@ -1539,12 +1747,101 @@ GfErrType ThinClientRegion::multiHopPutAllNoThrow_remote(
     const std::shared_ptr<Serializable>& aCallbackArgument) {
   // Multiple hop implementation
   LOGDEBUG("ThinClientRegion::multiHopPutAllNoThrow_remote ");
-  auto err = GF_NOERR;
+
+  auto batchSize = getCacheImpl()
+                       ->getDistributedSystem()
+                       .getSystemProperties()
+                       .putAllBatchSize();
+  if (batchSize > 0 && map.size() > batchSize) {
+    return pipelinedPutAllNoThrow_remote(map, versionedObjPartList, timeout,
+                                         aCallbackArgument, batchSize);
+  }
 
   // Construct request/reply for putAll
   TcrMessagePutAll request(new DataOutput(m_cacheImpl->createDataOutput()),
                            this, map, timeout, m_tcrdm.get(),
                            aCallbackArgument);
+  return sendPutAllNoThrow_remote(request, versionedObjPartList, timeout);
+}
+
+GfErrType ThinClientRegion::pipelinedPutAllNoThrow_remote(
+    const HashMapOfCacheable& map,
+    std::shared_ptr<VersionedCacheableObjectPartList>& versionedObjPartList,
+    std::chrono::milliseconds timeout,
+    const std::shared_ptr<Serializable>& aCallbackArgument,
+    uint32_t batchSize) {
+  LOGDEBUG(
+      "ThinClientRegion::pipelinedPutAllNoThrow_remote map size = %zu, batch "
+      "size = %u",
+      map.size(), batchSize);
+
+  // Each batch is serialized on a pool thread while the batch before it is
+  // sent, so at most two batches are held in memory. Batches follow the map's
+  // iteration order, so their version tags line up with it.
+  auto& threadPool = m_cacheImpl->getThreadPool();
+  auto next = map.begin();
+  auto serializeBatch = [&]() {
+    auto first = next;
+    uint32_t count = 0;
+    for (; next != map.end() && count < batchSize; ++next) {
+      ++count;
+    }
+    auto batch = std::make_shared<PutAllBatchWork>(
+        this, first, next, count, timeout, m_tcrdm.get(), aCallbackArgument);
+    threadPool.perform(batch);
+    return batch;
+  };
+
+  // The batches share the timeout of the whole putAll.
+  const auto deadline = std::chrono::steady_clock::now() + timeout;
+  versionedObjPartList = nullptr;
+  auto err = GF_NOERR;
+  auto batch = serializeBatch();
+  for (;;) {
+    std::shared_ptr<PutAllBatchWork> following;
+    std::shared_ptr<VersionedCacheableObjectPartList> batchList;
+    try {
+      auto request = batch->getRequest();
+      if (next != map.end()) {
+        following = serializeBatch();
+      }
+      auto remaining = remainingTime(deadline, err);
+      if (err == GF_NOERR) {
+        err = sendPutAllNoThrow_remote(*request, batchList, remaining);
+      }
+    } catch (const std::exception& ex) {
+      // The following batch refers to the map, which the caller may free.
+      if (following) {
+        following->getResult();
+      }
+      if (versionedObjPartList == nullptr) {
+        throw;
+      }
+      setThreadLocalExceptionMessage(ex.what());
+      return failedBatchResult(GF_EUNDEF, versionedObjPartList, nullptr);
+    }
+
+    if (err != GF_NOERR) {
+      if (following) {
+        following->getResult();
+      }
+      return failedBatchResult(err, versionedObjPartList, batchList);
+    }
+
+    addBatchResults(versionedObjPartList, batchList, batch->first(),
+                    batch->last());
+    if (!following) {
+      return GF_NOERR;
+    }
+    batch = std::move(following);
+  }
+}
+
+GfErrType ThinClientRegion::sendPutAllNoThrow_remote(
+    TcrMessagePutAll& request,
+    std::shared_ptr<VersionedCacheableObjectPartList>& versionedObjPartList,
+    std::chrono::milliseconds timeout) {
+  auto err = GF_NOERR;
   TcrMessageReply reply(true, m_tcrdm.get());
   request.setTimeout(timeout);
   reply.setTimeout(timeout);
@@ -1605,19 +1902,26 @@ GfErrType ThinClientRegion::putAllNoThrow_remote(
     const std::shared_ptr<Serializable>& aCallbackArgument) {
   LOGDEBUG("ThinClientRegion::putAllNoThrow_remote");
 
+  GfErrType err;
   if (auto poolDM = std::dynamic_pointer_cast<ThinClientPoolDM>(m_tcrdm)) {
     if (poolDM->getPRSingleHopEnabled() && poolDM->getClientMetaDataService() &&
         !TSSTXStateWrapper::get().getTXState()) {
-      return singleHopPutAllNoThrow_remote(
+      err = singleHopPutAllNoThrow_remote(
           poolDM.get(), map, versionedObjPartList, timeout, aCallbackArgument);
     } else {
-      return multiHopPutAllNoThrow_remote(map, versionedObjPartList, timeout,
-                                          aCallbackArgument);
+      err = multiHopPutAllNoThrow_remote(map, versionedObjPartList, timeout,
+                                         aCallbackArgument);
     }
   } else {
     LOGERROR("ThinClientRegion::putAllNoThrow_remote :: Pool Not Specified ");
     return GF_NOTSUP;
   }
+  if (m_negativeLookupCache) {
+    for (const auto& entry : map) {
+      m_negativeLookupCache->remove(entry.first);
+    }
+  }
+  return err;
 }
 
 GfErrType ThinClientRegion::singleHopRemoveAllNoThrow_remote(
@@ -2231,6 +2535,7 @@ GfErrType ThinClientRegion::registerKeysNoThrow(
       getAttributes().getCachingEnabled(), receiveValues, interestPolicy,
       m_tcrdm.get());
   std::recursive_mutex responseLock;
+  std::unique_ptr<InitialImageLoader> initialImageLoader;
   TcrChunkedResult* resultCollector = nullptr;
   if (interestPolicy.ordinal == InterestResultPolicy::KEYS_VALUES.ordinal) {
     auto values = std::make_shared<HashMapOfCacheable>();
@@ -2238,9 +2543,14 @@ GfErrType ThinClientRegion::registerKeysNoThrow(
     MapOfUpdateCounters trackers;
     int32_t destroyTracker = 1;
     if (needToCreateRC) {
-      resultCollector = (new ChunkedGetAllResponse(
+      initialImageLoader = std::unique_ptr<InitialImageLoader>(
+          new InitialImageLoader(*this, destroyTracker));
+      initialImageLoader->reserve(keys.size());
+      auto getAllResultCollector = new ChunkedGetAllResponse(
           request, this, &keys, values, exceptions, nullptr, trackers,
-          destroyTracker, true, responseLock));
+          destroyTracker, true, responseLock);
+      getAllResultCollector->setInitialImageLoader(initialImageLoader.get());
+      resultCollector = getAllResultCollector;
       reply->setChunkedResultHandler(resultCollector);
     }
   } else {
@@ -2252,6 +2562,9 @@ GfErrType ThinClientRegion::registerKeysNoThrow(
 
   err = m_tcrdm->sendSyncRequestRegisterInterest(
       request, *reply, attemptFailover, this, endpoint);
+  if (initialImageLoader) {
+    initialImageLoader->wait();
+  }
 
   if (err == GF_NOERR /*|| err == GF_CACHE_REDUNDANCY_FAILURE*/) {
     if (reply->getMessageType() == TcrMessage::RESPONSE_FROM_SECONDARY &&
@@ -2409,6 +2722,7 @@ GfErrType ThinClientRegion::registerRegexNoThrow(
       regex.c_str(), interestPolicy, isDurable,
       getAttributes().getCachingEnabled(), receiveValues, m_tcrdm.get());
   std::recursive_mutex responseLock;
+  std::unique_ptr<InitialImageLoader> initialImageLoader;
   if (reply == nullptr) {
     TcrMessageReply replyLocal(true, m_tcrdm.get());
     auto values = std::make_shared<HashMapOfCacheable>();
@@ -2424,9 +2738,12 @@ GfErrType ThinClientRegion::registerRegexNoThrow(
                 new std::vector<std::shared_ptr<CacheableKey>>());
       }
       // need to check
+      initialImageLoader = std::unique_ptr<InitialImageLoader>(
+          new InitialImageLoader(*this, destroyTracker));
       getAllResultCollector = (new ChunkedGetAllResponse(
           request, this, nullptr, values, exceptions, resultKeys, trackers,
           destroyTracker, true, responseLock));
+      getAllResultCollector->setInitialImageLoader(initialImageLoader.get());
       reply->setChunkedResultHandler(getAllResultCollector);
       isRCCreatedLocally = true;
     } else {
@@ -2438,6 +2755,9 @@ GfErrType ThinClientRegion::registerRegexNoThrow(
     }
     err = m_tcrdm->sendSyncRequestRegisterInterest(
         request, replyLocal, attemptFailover, this, endpoint);
+    if (initialImageLoader) {
+      initialImageLoader->wait();
+    }
   } else {
     err = m_tcrdm->sendSyncRequestRegisterInterest(
         request, *reply, attemptFailover, this, endpoint);
@@ -2671,6 +2991,7 @@ GfErrType ThinClientRegion::clientNotificationHandler(const TcrMessage& msg) {
       break;
     }
     case TcrMessage::LOCAL_CREATE:
+      forgetAbsentKey(msg.getKey());
       err = LocalRegion::putNoThrow(
           msg.getKey(), msg.getValue(), msg.getCallbackArgument(), oldValue, -1,
           CacheEventFlags::NOTIFICATION | CacheEventFlags::LOCAL,
@@ -2679,6 +3000,7 @@ GfErrType ThinClientRegion::clientNotificationHandler(const TcrMessage& msg) {
     case TcrMessage::LOCAL_UPDATE: {
       //  for update set the NOTIFICATION_UPDATE to trigger the
       // afterUpdate event even if the key is not present in local cache
+      forgetAbsentKey(msg.getKey());
       err = LocalRegion::putNoThrow(
           msg.getKey(), msg.getValue(), msg.getCallbackArgument(), oldValue, -1,
           CacheEventFlags::NOTIFICATION | CacheEventFlags::NOTIFICATION_UPDATE |
@@ -2695,6 +3017,10 @@ GfErrType ThinClientRegion::clientNotificationHandler(const TcrMessage& msg) {
         auto& marker =
             dynamic_cast<const TcrMessageAllEndpointsDisconnectedMarker&>(msg);
         setProcessedMarker(false);
+        // Events may be lost until the subscription is redundant again.
+        if (m_negativeLookupCache) {
+          m_negativeLookupCache->clear();
+        }
         LOGDEBUG(
             "ThinClientRegion::clientNotificationHandler: rec'd endpoints "
             "disconnected message");
@@ -2775,6 +3101,10 @@ GfErrType ThinClientRegion::handleServerException(
 }
 
 void ThinClientRegion::receiveNotification(const TcrMessage& msg) {
+  if (m_conflationQueue && conflateNotification(msg)) {
+    return;
+  }
+
   std::unique_lock<std::mutex> lock(m_notificationMutex, std::defer_lock);
   {
     boost::shared_lock<decltype(mutex_)> guard{mutex_};
@@ -2784,6 +3114,13 @@ void ThinClientRegion::receiveNotification(const TcrMessage& msg) {
     lock.lock();
   }
 
+  if (m_conflationQueue) {
+    // Anything queued arrived before msg, so must be applied first.
+    SubscriptionConflationQueue::Events events;
+    m_conflationQueue->takeAll(events);
+    applyConflatedEvents(events);
+  }
+
   if (msg.getMessageType() == TcrMessage::CLIENT_MARKER) {
     handleMarker();
   } else {
@@ -2793,6 +3130,95 @@ void ThinClientRegion::receiveNotification(const TcrMessage& msg) {
   lock.unlock();
 }
 
+bool ThinClientRegion::conflateNotification(const TcrMessage& msg) {
+  const auto messageType = msg.getMessageType();
+  if ((messageType != TcrMessage::LOCAL_CREATE &&
+       messageType != TcrMessage::LOCAL_UPDATE) ||
+      msg.hasDelta()) {
+    return false;
+  }
+
+  {
+    boost::shared_lock<decltype(mutex_)> guard{mutex_};
+    if (m_destroyPending) {
+      return true;
+    }
+  }
+
+  bool conflated;
+  std::shared_ptr<EventId> superseded;
+  auto startDrain = m_conflationQueue->add(
+      {messageType == TcrMessage::LOCAL_CREATE, msg.getKey(), msg.getValue(),
+       msg.getCallbackArgument(), msg.getVersionTag(), msg.getEventId()},
+      conflated, superseded);
+
+  m_regionStats->incSubscriptionEventsQueued();
+  if (conflated) {
+    m_regionStats->incSubscriptionEventsConflated();
+    // The replaced event will never be applied on its own, so a durable
+    // client records it as processed now.
+    if (m_isDurableClnt && superseded) {
+      m_tcrdm->checkDupAndAdd(superseded);
+    }
+  }
+
+  if (startDrain) {
+    m_cacheImpl->getThreadPool().perform(std::make_shared<ConflatedEventsWork>(
+        std::static_pointer_cast<ThinClientRegion>(shared_from_this())));
+  }
+  return true;
+}
+
+void ThinClientRegion::drainConflatedEvents() {
+  SubscriptionConflationQueue::Events events;
+  while (true) {
+    std::unique_lock<std::mutex> lock(m_notificationMutex, std::defer_lock);
+    {
+      boost::shared_lock<decltype(mutex_)> guard{mutex_};
+      if (!m_destroyPending) {
+        lock.lock();
+      }
+    }
+
+    if (!m_conflationQueue->drain(events)) {
+      return;
+    }
+    if (lock.owns_lock()) {
+      applyConflatedEvents(events);
+    }
+    events.clear();
+  }
+}
+
+void ThinClientRegion::applyConflatedEvents(
+    SubscriptionConflationQueue::Events& events) {
+  for (const auto& event : events) {
+    try {
+      std::shared_ptr<Cacheable> oldValue;
+      forgetAbsentKey(event.key);
+      if (event.isCreate) {
+        LocalRegion::putNoThrow(
+            event.key, event.value, event.callbackArgument, oldValue, -1,
+            CacheEventFlags::NOTIFICATION | CacheEventFlags::LOCAL,
+            event.versionTag);
+      } else {
+        LocalRegion::putNoThrow(
+            event.key, event.value, event.callbackArgument, oldValue, -1,
+            CacheEventFlags::NOTIFICATION |
+                CacheEventFlags::NOTIFICATION_UPDATE | CacheEventFlags::LOCAL,
+            event.versionTag, nullptr, event.eventId);
+      }
+    } catch (const Exception& e) {
+      LOGERROR("Failed to apply subscription event for region %s: %s",
+               m_fullPath.c_str(), e.what());
+    }
+
+    if (!m_destroyPending && m_isDurableClnt) {
+      m_tcrdm->checkDupAndAdd(event.eventId);
+    }
+  }
+}
+
 void ThinClientRegion::localInvalidateRegion_internal() {
   std::shared_ptr<MapEntryImpl> me;
   std::shared_ptr<Cacheable> oldValue;
@@ -2822,6 +3248,10 @@ void ThinClientRegion::invalidateInterestList(
 void ThinClientRegion::localInvalidateFailover() {
   CHECK_DESTROY_PENDING(shared_lock, ThinClientRegion::localInvalidateFailover);
 
+  if (m_negativeLookupCache) {
+    m_negativeLookupCache->clear();
+  }
+
   //  No need to invalidate from the "m_xxxForUpdatesAsInvalidates" lists?
   if (m_interestListRegex.empty() && m_durableInterestListRegex.empty()) {
     invalidateInterestList(m_interestList);
@@ -2881,6 +3311,12 @@ void ThinClientRegion::release(bool invokeCallbacks) {
     lock.lock();
   }
 
+  if (auto poolDM = std::dynamic_pointer_cast<ThinClientPoolDM>(m_tcrdm)) {
+    if (auto clientMetadataService = poolDM->getClientMetaDataService()) {
+      clientMetadataService->removeRegion(getFullPath());
+    }
+  }
+
   // TODO suspect
   // NOLINTNEXTLINE(clang-analyzer-optin.cplusplus.VirtualCall)
   destroyDM(invokeCallbacks);
@@ -3298,10 +3734,17 @@ void ThinClientRegion::txPut(
                                CacheEventFlags::NORMAL, versionTag);
 
   updateStatOpTime(m_regionStats->getStat(), m_regionStats->getPutTimeId(),
-                   sampleStartNanos);
+                   sampleStartNanos, m_regionStats->getPutLatency());
   throwExceptionIfError("Region::putTX", err);
 }
 
+void ThinClientRegion::forgetAbsentKey(
+    const std::shared_ptr<CacheableKey>& key) {
+  if (m_negativeLookupCache) {
+    m_negativeLookupCache->remove(key);
+  }
+}
+
 void ThinClientRegion::setProcessedMarker(bool) {}
 boost::shared_mutex& ThinClientRegion::getMetadataMutex() {
   return region_mutex_;
@@ -3545,6 +3988,25 @@ void ChunkedQueryResponse::handleChunk(const uint8_t* chunk, int32_t chunkLen,
   m_msg.readSecureObjectPart(input, false, true, isLastChunkWithSecurity);
 }
 
+void ChunkedQueryStreamResponse::handleChunk(const uint8_t* chunk,
+                                             int32_t chunkLen,
+                                             uint8_t isLastChunkWithSecurity,
+                                             const CacheImpl* cacheImpl) {
+  // Once the stream is cancelled only the chunk carrying the security part
+  // is read.
+  if (m_stream.isCancelled() && !(isLastChunkWithSecurity & 0x2)) {
+    return;
+  }
+  ChunkedQueryResponse::handleChunk(chunk, chunkLen, isLastChunkWithSecurity,
+                                    cacheImpl);
+  m_stream.push(getStructFieldNames(), *getQueryResults());
+}
+
+void ChunkedQueryStreamResponse::reset() {
+  ChunkedQueryResponse::reset();
+  m_stream.restart();
+}
+
 void ChunkedQueryResponse::skipClass(DataInput& input) {
   auto classByte = static_cast<DSCode>(input.read());
   if (classByte == DSCode::Class) {
@@ -3717,33 +4179,38 @@ void ChunkedGetAllResponse::handleChunk(const uint8_t* chunk, int32_t chunkLen,
     return;
   }
 
+  // With a loader the values only need to live until they are handed over.
+  auto values = m_initialImageLoader != nullptr && m_values
+                    ? std::make_shared<HashMapOfCacheable>()
+                    : m_values;
   VersionedCacheableObjectPartList objectList(
-      m_keys, &m_keysOffset, m_values, m_exceptions, m_resultKeys, m_region,
+      m_keys, &m_keysOffset, values, m_exceptions, m_resultKeys, m_region,
       &m_trackerMap, m_destroyTracker, m_addToLocalCache, m_dsmemId,
       m_responseLock);
+  objectList.setInitialImageLoader(m_initialImageLoader);
 
   objectList.fromData(input);
+  if (m_initialImageLoader != nullptr) {
+    m_initialImageLoader->flush();
+  }
 
   m_msg.readSecureObjectPart(input, false, true, isLastChunkWithSecurity);
 }
 
 void ChunkedGetAllResponse::add(const ChunkedGetAllResponse* other) {
-  if (m_values) {
-    for (const auto& iter : *m_values) {
+  if (m_values && other->m_values) {
+    m_values->reserve(m_values->size() + other->m_values->size());
+    for (const auto& iter : *other->m_values) {
       m_values->emplace(iter.first, iter.second);
     }
   }
 
-  if (m_exceptions) {
+  if (m_exceptions && other->m_exceptions) {
     m_exceptions->insert(other->m_exceptions->begin(),
                          other->m_exceptions->end());
   }
 
-  for (const auto& iter : other->m_trackerMap) {
-    m_trackerMap[iter.first] = iter.second;
-  }
-
-  if (m_resultKeys) {
+  if (m_resultKeys && other->m_resultKeys) {
     m_resultKeys->insert(m_resultKeys->end(), other->m_resultKeys->begin(),
                          other->m_resultKeys->end());
   }
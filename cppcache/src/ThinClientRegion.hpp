@@ -24,13 +24,16 @@
 #include <unordered_map>
 
 #include <geode/ResultCollector.hpp>
+#include <geode/StreamingResultCollector.hpp>
 #include <geode/internal/functional.hpp>
 
 #include "CacheableObjectPartList.hpp"
 #include "ClientMetadataService.hpp"
 #include "LocalRegion.hpp"
+#include "NegativeLookupCache.hpp"
 #include "Queue.hpp"
 #include "RegionGlobalLocks.hpp"
+#include "SubscriptionConflationQueue.hpp"
 #include "TcrChunkedContext.hpp"
 #include "TcrMessage.hpp"
 
@@ -38,6 +41,8 @@ namespace apache {
 namespace geode {
 namespace client {
 
+class InitialImageLoader;
+class SelectResultsStreamImpl;
 class ThinClientBaseDM;
 class TcrEndpoint;
 
@@ -135,6 +140,12 @@ class ThinClientRegion : public LocalRegion {
 
   void receiveNotification(const TcrMessage& msg);
 
+  /**
+   * Applies the subscription events queued for conflation until none are
+   * left. Runs on the cache thread pool.
+   */
+  void drainConflatedEvents();
+
   static GfErrType handleServerException(const std::string& func,
                                          const std::string& exceptionMsg);
 
@@ -178,6 +189,11 @@ class ThinClientRegion : public LocalRegion {
     m_isMetaDataRefreshed = aMetaDataRefreshed;
   }
 
+  const std::shared_ptr<ClientMetadataGeneration>& getMetadataGeneration()
+      const {
+    return m_metadataGeneration;
+  }
+
   uint32_t size_remote() override;
 
   void txDestroy(const std::shared_ptr<CacheableKey>& key,
@@ -337,6 +353,16 @@ class ThinClientRegion : public LocalRegion {
       std::shared_ptr<VersionedCacheableObjectPartList>& versionedObjPartList,
       std::chrono::milliseconds timeout = DEFAULT_RESPONSE_TIMEOUT,
       const std::shared_ptr<Serializable>& aCallbackArgument = nullptr);
+  GfErrType pipelinedPutAllNoThrow_remote(
+      const HashMapOfCacheable& map,
+      std::shared_ptr<VersionedCacheableObjectPartList>& versionedObjPartList,
+      std::chrono::milliseconds timeout,
+      const std::shared_ptr<Serializable>& aCallbackArgument,
+      uint32_t batchSize);
+  GfErrType sendPutAllNoThrow_remote(
+      TcrMessagePutAll& request,
+      std::shared_ptr<VersionedCacheableObjectPartList>& versionedObjPartList,
+      std::chrono::milliseconds timeout);
 
   GfErrType singleHopRemoveAllNoThrow_remote(
       ThinClientPoolDM* tcrdm,
@@ -348,8 +374,22 @@ class ThinClientRegion : public LocalRegion {
       std::shared_ptr<VersionedCacheableObjectPartList>& versionedObjPartList,
       const std::shared_ptr<Serializable>& aCallbackArgument = nullptr);
 
+  void forgetAbsentKey(const std::shared_ptr<CacheableKey>& key);
+
+  bool conflateNotification(const TcrMessage& msg);
+  void applyConflatedEvents(SubscriptionConflationQueue::Events& events);
+
   boost::shared_mutex region_mutex_;
   bool m_isMetaDataRefreshed;
+  // Renewed by the ClientMetadataService when the single-hop routing
+  // metadata of the region changes.
+  const std::shared_ptr<ClientMetadataGeneration> m_metadataGeneration;
+  // Keys the servers reported as absent, nullptr if the region has no
+  // negative-cache-entries-limit.
+  std::unique_ptr<NegativeLookupCache> m_negativeLookupCache;
+  // Create and update events waiting to be applied, nullptr if the region
+  // does not have subscription-conflation-enabled.
+  std::unique_ptr<SubscriptionConflationQueue> m_conflationQueue;
 
   typedef std::unordered_map<
       std::shared_ptr<BucketServerLocation>, std::shared_ptr<Serializable>,
@@ -443,6 +483,30 @@ class ChunkedQueryResponse : public TcrChunkedResult {
   void readObjectPartList(DataInput& input, bool isResultSet);
 };
 
+/**
+ * Handles each chunk of a streamed query response by passing its results to
+ * the stream as soon as the chunk is read. Chunks are handled by the thread
+ * reading the connection, so a full stream stops the connection from being
+ * read.
+ */
+class ChunkedQueryStreamResponse : public ChunkedQueryResponse {
+ private:
+  SelectResultsStreamImpl& m_stream;
+
+ public:
+  inline ChunkedQueryStreamResponse(TcrMessage& msg,
+                                    SelectResultsStreamImpl& stream)
+      : ChunkedQueryResponse(msg), m_stream(stream) {}
+
+  ~ChunkedQueryStreamResponse() noexcept override = default;
+
+  void handleChunk(const uint8_t* chunk, int32_t chunkLen,
+                   uint8_t isLastChunkWithSecurity,
+                   const CacheImpl* cacheImpl) override;
+  void reset() override;
+  bool handleInReadingThread() const override { return true; }
+};
+
 /**
  * Handle each chunk of the chunked function execution response.
  *
@@ -455,11 +519,19 @@ class ChunkedFunctionExecutionResponse : public TcrChunkedResult {
   bool m_getResult;
   std::shared_ptr<ResultCollector> m_rc;
   std::shared_ptr<std::recursive_mutex> m_resultCollectorLock;
+  // A streaming collector may block the handler until its consumer catches
+  // up, which must not stall the pool's shared chunk processor thread.
+  bool m_streaming;
 
  public:
   inline ChunkedFunctionExecutionResponse(TcrMessage& msg, bool getResult,
                                           std::shared_ptr<ResultCollector> rc)
-      : TcrChunkedResult(), m_msg(msg), m_getResult(getResult), m_rc(rc) {}
+      : TcrChunkedResult(),
+        m_msg(msg),
+        m_getResult(getResult),
+        m_rc(rc),
+        m_streaming(std::dynamic_pointer_cast<StreamingResultCollector>(rc) !=
+                    nullptr) {}
 
   inline ChunkedFunctionExecutionResponse(
       TcrMessage& msg, bool getResult, std::shared_ptr<ResultCollector> rc,
@@ -468,7 +540,9 @@ class ChunkedFunctionExecutionResponse : public TcrChunkedResult {
         m_msg(msg),
         m_getResult(getResult),
         m_rc(rc),
-        m_resultCollectorLock(resultCollectorLock) {}
+        m_resultCollectorLock(resultCollectorLock),
+        m_streaming(std::dynamic_pointer_cast<StreamingResultCollector>(rc) !=
+                    nullptr) {}
 
   ChunkedFunctionExecutionResponse(const ChunkedFunctionExecutionResponse&) =
       delete;
@@ -483,6 +557,8 @@ class ChunkedFunctionExecutionResponse : public TcrChunkedResult {
                    uint8_t isLastChunkWithSecurity,
                    const CacheImpl* cacheImpl) override;
   void reset() override;
+
+  bool handleInReadingThread() const override { return m_streaming; }
 };
 
 /**
@@ -503,6 +579,7 @@ class ChunkedGetAllResponse : public TcrChunkedResult {
   bool m_addToLocalCache;
   uint32_t m_keysOffset;
   std::recursive_mutex& m_responseLock;
+  InitialImageLoader* m_initialImageLoader;
 
  public:
   inline ChunkedGetAllResponse(
@@ -525,7 +602,8 @@ class ChunkedGetAllResponse : public TcrChunkedResult {
         m_destroyTracker(destroyTracker),
         m_addToLocalCache(addToLocalCache),
         m_keysOffset(0),
-        m_responseLock(responseLock) {}
+        m_responseLock(responseLock),
+        m_initialImageLoader(nullptr) {}
 
   ChunkedGetAllResponse(const ChunkedGetAllResponse&) = delete;
   ChunkedGetAllResponse& operator=(const ChunkedGetAllResponse&) = delete;
@@ -539,6 +617,14 @@ class ChunkedGetAllResponse : public TcrChunkedResult {
 
   void add(const ChunkedGetAllResponse* other);
   bool getAddToLocalCache() { return m_addToLocalCache; }
+
+  /**
+   * Adds the values of each chunk to the local cache through loader, while
+   * the next chunk is read. The values are then not kept in getValues().
+   */
+  void setInitialImageLoader(InitialImageLoader* loader) {
+    m_initialImageLoader = loader;
+  }
   std::shared_ptr<HashMapOfCacheable> getValues() { return m_values; }
   std::shared_ptr<HashMapOfException> getExceptions() { return m_exceptions; }
   std::shared_ptr<std::vector<std::shared_ptr<CacheableKey>>> getResultKeys() {
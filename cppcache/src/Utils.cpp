@@ -247,6 +247,16 @@ void Utils::updateStatOpTime(statistics::Statistics* m_regionStats,
   m_regionStats->incLong(statId, startStatOpTime() - start);
 }
 
+void Utils::updateStatOpTime(statistics::Statistics* m_regionStats,
+                             int32_t statId, int64_t start,
+                             statistics::LatencyHistogram* latency) {
+  auto elapsed = startStatOpTime() - start;
+  m_regionStats->incLong(statId, elapsed);
+  if (latency) {
+    latency->record(elapsed);
+  }
+}
+
 std::string Utils::getSystemInfo() {
   std::string sysname{"Unknown"};
   std::string machine{"Unknown"};
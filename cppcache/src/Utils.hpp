@@ -35,6 +35,7 @@
 #include <geode/internal/geode_globals.hpp>
 
 #include "DistributedSystem.hpp"
+#include "statistics/LatencyHistogram.hpp"
 #include "statistics/Statistics.hpp"
 #include "util/Log.hpp"
 
@@ -150,6 +151,14 @@ class APACHE_GEODE_EXPORT Utils {
   static void updateStatOpTime(statistics::Statistics* m_regionStats,
                                int32_t statId, int64_t start);
 
+  /**
+   * Same as above but also records the elapsed time in latency, when not
+   * nullptr.
+   */
+  static void updateStatOpTime(statistics::Statistics* m_regionStats,
+                               int32_t statId, int64_t start,
+                               statistics::LatencyHistogram* latency);
+
   static void parseEndpointNamesString(
       std::string endpoints, std::unordered_set<std::string>& endpointNames);
 
@@ -0,0 +1,112 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ValueCompressor.hpp"
+
+#include <chrono>
+#include <vector>
+
+#include <geode/CacheableBuiltins.hpp>
+#include <geode/DataInput.hpp>
+#include <geode/DataOutput.hpp>
+
+#include "CacheImpl.hpp"
+#include "CacheableToken.hpp"
+#include "RegionInternal.hpp"
+#include "RegionStats.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+
+namespace {
+
+int64_t nanosSince(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now() - start)
+      .count();
+}
+
+class CompressedValue : public CacheableBytes {
+ public:
+  explicit CompressedValue(std::vector<int8_t> value)
+      : CacheableBytes(std::move(value)) {}
+};
+
+}  // namespace
+
+ValueCompressor::ValueCompressor(RegionInternal* region,
+                                 std::shared_ptr<Compressor> compressor)
+    : region_(region), compressor_(std::move(compressor)) {}
+
+std::shared_ptr<Cacheable> ValueCompressor::compress(
+    const std::shared_ptr<Cacheable>& value) const {
+  if (value == nullptr || CacheableToken::isToken(value)) {
+    return value;
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  auto output = region_->getCacheImpl()->createDataOutput(
+      region_->getPool().get());
+  output.writeObject(value);
+  auto compressed = compressor_->compress(
+      reinterpret_cast<const int8_t*>(output.getBuffer()),
+      output.getBufferLength());
+  auto postBytes = static_cast<int64_t>(compressed.size());
+  auto stored = std::make_shared<CompressedValue>(std::move(compressed));
+
+  // The entries map is created before the region statistics.
+  if (auto stats = region_->getRegionStats()) {
+    stats->incCompressions(static_cast<int64_t>(output.getBufferLength()),
+                           postBytes, nanosSince(start));
+  }
+  return stored;
+}
+
+std::shared_ptr<Cacheable> ValueCompressor::decompress(
+    const std::shared_ptr<Cacheable>& stored) const {
+  auto bytes = std::dynamic_pointer_cast<CompressedValue>(stored);
+  if (bytes == nullptr) {
+    return stored;
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  auto serialized =
+      compressor_->decompress(bytes->value().data(), bytes->value().size());
+  auto input = region_->getCacheImpl()->createDataInput(
+      reinterpret_cast<const uint8_t*>(serialized.data()), serialized.size(),
+      region_->getPool().get());
+  auto value = input.readObject();
+
+  if (auto stats = region_->getRegionStats()) {
+    stats->incDecompressions(nanosSince(start));
+  }
+  return value;
+}
+
+std::shared_ptr<Cacheable> ValueCompressor::fromDisk(
+    const std::shared_ptr<Cacheable>& value) const {
+  auto bytes = std::dynamic_pointer_cast<CacheableBytes>(value);
+  if (bytes == nullptr || std::dynamic_pointer_cast<CompressedValue>(bytes)) {
+    return value;
+  }
+  return std::make_shared<CompressedValue>(bytes->value());
+}
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
@@ -0,0 +1,74 @@
+#pragma once
+
+#ifndef GEODE_VALUECOMPRESSOR_H_
+#define GEODE_VALUECOMPRESSOR_H_
+
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+
+#include <geode/Compressor.hpp>
+#include <geode/Serializable.hpp>
+
+namespace apache {
+namespace geode {
+namespace client {
+
+class RegionInternal;
+
+/**
+ * Converts between the values of a region and the form they are kept in by
+ * its entries map when the region has a {@link Compressor}: the serialized
+ * value compressed into a CacheableBytes subclass, so that the two forms can
+ * be told apart. Tokens and nullptr are kept as is.
+ */
+class ValueCompressor {
+ public:
+  ValueCompressor(RegionInternal* region,
+                  std::shared_ptr<Compressor> compressor);
+
+  ValueCompressor(const ValueCompressor&) = delete;
+  ValueCompressor& operator=(const ValueCompressor&) = delete;
+
+  std::shared_ptr<Cacheable> compress(
+      const std::shared_ptr<Cacheable>& value) const;
+
+  /**
+   * Returns the region value for stored. A value that is not in the stored
+   * form is returned as is.
+   */
+  std::shared_ptr<Cacheable> decompress(
+      const std::shared_ptr<Cacheable>& stored) const;
+
+  /**
+   * Returns a stored value read back from disk, where it was written as a
+   * plain CacheableBytes, in the stored form again.
+   */
+  std::shared_ptr<Cacheable> fromDisk(
+      const std::shared_ptr<Cacheable>& value) const;
+
+ private:
+  RegionInternal* region_;
+  std::shared_ptr<Compressor> compressor_;
+};
+
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_VALUECOMPRESSOR_H_
@@ -24,6 +24,7 @@
 #include "CacheableToken.hpp"
 #include "DiskStoreId.hpp"
 #include "DiskVersionTag.hpp"
+#include "InitialImageLoader.hpp"
 #include "ThinClientRegion.hpp"
 
 namespace apache {
@@ -169,6 +170,9 @@ void VersionedCacheableObjectPartList::fromData(DataInput& input) {
   if (hasObjects) {
     len = static_cast<int32_t>(input.readUnsignedVL());
     m_byteArray.resize(len);
+    if (m_initialImageLoader != nullptr && m_addToLocalCache) {
+      m_initialImageLoader->reserve(len);
+    }
     for (int32_t index = 0; index < len; ++index) {
       if (m_keys != nullptr && !m_hasKeys) {
         readObjectPart(index, input, m_keys->at(index + keysOffset));
@@ -268,7 +272,9 @@ void VersionedCacheableObjectPartList::fromData(DataInput& input) {
       value = iter == m_values->end() ? nullptr : iter->second;
       if (m_byteArray[index] != 3) {  // 3 - key not found on server
         std::shared_ptr<Cacheable> oldValue;
-        if (m_addToLocalCache) {
+        if (m_addToLocalCache && m_initialImageLoader != nullptr) {
+          m_initialImageLoader->add(key, value, m_versionTags[index]);
+        } else if (m_addToLocalCache) {
           int updateCount = -1;
           versionTag = m_versionTags[index];
 
@@ -281,6 +287,7 @@ void VersionedCacheableObjectPartList::fromData(DataInput& input) {
                   already contains an entry with higher version.",
                 Utils::nullSafeToString(key).c_str());
             // replace the value with higher version tag
+            m_region->fromStored(oldValue);
             (*m_values)[key] = oldValue;
           }
         }       // END::m_addToLocalCache
@@ -31,6 +31,7 @@ namespace apache {
 namespace geode {
 namespace client {
 
+class InitialImageLoader;
 class ThinClientRegion;
 
 /**
@@ -54,6 +55,7 @@ class VersionedCacheableObjectPartList : public CacheableObjectPartList {
   uint16_t m_endpointMemId;
   std::shared_ptr<std::vector<std::shared_ptr<CacheableKey>>> m_tempKeys;
   std::recursive_mutex& m_responseLock;
+  InitialImageLoader* m_initialImageLoader = nullptr;
 
   static const uint8_t FLAG_NULL_TAG;
   static const uint8_t FLAG_FULL_TAG;
@@ -151,6 +153,14 @@ class VersionedCacheableObjectPartList : public CacheableObjectPartList {
 
   inline uint16_t getEndpointMemId() { return m_endpointMemId; }
 
+  /**
+   * Entries added to the local cache by fromData are handed to loader, which
+   * must outlive this list, instead of being put by the reading thread.
+   */
+  void setInitialImageLoader(InitialImageLoader* loader) {
+    m_initialImageLoader = loader;
+  }
+
   std::vector<std::shared_ptr<VersionTag>>& getVersionedTagptr() {
     return m_versionTags;
   }
@@ -0,0 +1,151 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <geode/internal/functional.hpp>
+
+#include "../util/simd.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+namespace internal {
+
+namespace {
+
+/**
+ * 31^n modulo 2^32, all the arithmetic of String.hashCode() being modulo 2^32.
+ */
+constexpr uint32_t pow31(unsigned int n) {
+  return n == 0 ? 1 : 31 * pow31(n - 1);
+}
+
+/** The multiplier of each character of a 32 character block. */
+alignas(32) constexpr uint32_t kBlockPowers[] = {
+    pow31(31), pow31(30), pow31(29), pow31(28), pow31(27), pow31(26),
+    pow31(25), pow31(24), pow31(23), pow31(22), pow31(21), pow31(20),
+    pow31(19), pow31(18), pow31(17), pow31(16), pow31(15), pow31(14),
+    pow31(13), pow31(12), pow31(11), pow31(10), pow31(9),  pow31(8),
+    pow31(7),  pow31(6),  pow31(5),  pow31(4),  pow31(3),  pow31(2),
+    pow31(1),  pow31(0)};
+
+#if defined(GEODE_SIMD_SSE2)
+/** Low 32 bits of the lane wise product, SSE4.1 pmulld with SSE2 only. */
+inline __m128i mullo(__m128i a, __m128i b) {
+  auto even = _mm_mul_epu32(a, b);
+  auto odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+  return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+                            _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+}
+
+inline uint32_t sum(__m128i v) {
+  v = _mm_add_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2)));
+  v = _mm_add_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1)));
+  return static_cast<uint32_t>(_mm_cvtsi128_si32(v));
+}
+#endif
+
+}  // namespace
+
+std::size_t java_hash_ascii(const char* data, std::size_t length,
+                            int32_t& hash) {
+  // For a block of n characters hash' = hash * 31^n + sum(c[i] * 31^(n-1-i)),
+  // so the lanes of acc add up the products of each block, scaled by 31^n for
+  // every block that follows, and are summed once at the end.
+  auto in = reinterpret_cast<const uint8_t*>(data);
+  auto h = static_cast<uint32_t>(hash);
+  std::size_t i = 0;
+
+#if defined(GEODE_SIMD_AVX2)
+  constexpr std::size_t block = 32;
+  if (length >= block) {
+    constexpr uint32_t scale = pow31(block);
+    const auto scales = _mm256_set1_epi32(static_cast<int>(scale));
+    auto powers = reinterpret_cast<const __m256i*>(kBlockPowers);
+    auto acc = _mm256_setzero_si256();
+    for (; i + block <= length; i += block) {
+      auto v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+      if (_mm256_movemask_epi8(v) != 0) {
+        break;
+      }
+      auto low = _mm256_castsi256_si128(v);
+      auto high = _mm256_extracti128_si256(v, 1);
+      auto c0 = _mm256_cvtepu8_epi32(low);
+      auto c1 = _mm256_cvtepu8_epi32(_mm_srli_si128(low, 8));
+      auto c2 = _mm256_cvtepu8_epi32(high);
+      auto c3 = _mm256_cvtepu8_epi32(_mm_srli_si128(high, 8));
+      auto products =
+          _mm256_add_epi32(_mm256_add_epi32(_mm256_mullo_epi32(c0, powers[0]),
+                                            _mm256_mullo_epi32(c1, powers[1])),
+                           _mm256_add_epi32(_mm256_mullo_epi32(c2, powers[2]),
+                                            _mm256_mullo_epi32(c3, powers[3])));
+      acc = _mm256_add_epi32(_mm256_mullo_epi32(acc, scales), products);
+      h *= scale;
+    }
+    h += sum(_mm_add_epi32(_mm256_castsi256_si128(acc),
+                           _mm256_extracti128_si256(acc, 1)));
+  }
+#elif defined(GEODE_SIMD_SSE2)
+  constexpr std::size_t block = 16;
+  if (length >= block) {
+    constexpr uint32_t scale = pow31(block);
+    const auto scales = _mm_set1_epi32(static_cast<int>(scale));
+    // The last 16 multipliers of the 32 character block.
+    auto powers = reinterpret_cast<const __m128i*>(kBlockPowers) + 4;
+    const auto zero = _mm_setzero_si128();
+    auto acc = zero;
+    for (; i + block <= length; i += block) {
+      auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+      if (_mm_movemask_epi8(v) != 0) {
+        break;
+      }
+      auto low = _mm_unpacklo_epi8(v, zero);
+      auto high = _mm_unpackhi_epi8(v, zero);
+      auto c0 = _mm_unpacklo_epi16(low, zero);
+      auto c1 = _mm_unpackhi_epi16(low, zero);
+      auto c2 = _mm_unpacklo_epi16(high, zero);
+      auto c3 = _mm_unpackhi_epi16(high, zero);
+      auto products = _mm_add_epi32(
+          _mm_add_epi32(mullo(c0, powers[0]), mullo(c1, powers[1])),
+          _mm_add_epi32(mullo(c2, powers[2]), mullo(c3, powers[3])));
+      acc = _mm_add_epi32(mullo(acc, scales), products);
+      h *= scale;
+    }
+    h += sum(acc);
+  }
+#endif
+
+  // Four independent multiply-adds instead of a chain of four.
+  for (; i + 4 <= length; i += 4) {
+    if (((in[i] | in[i + 1] | in[i + 2] | in[i + 3]) & 0x80) != 0) {
+      break;
+    }
+    h = h * pow31(4) + in[i] * pow31(3) + in[i + 1] * pow31(2) +
+        in[i + 2] * pow31(1) + in[i + 3];
+  }
+
+  for (; i < length && in[i] < 0x80; i++) {
+    h = 31 * h + in[i];
+  }
+
+  hash = static_cast<int32_t>(h);
+  return i;
+}
+
+}  // namespace internal
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
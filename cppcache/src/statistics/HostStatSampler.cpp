@@ -180,6 +180,10 @@ std::vector<Statistics*>& HostStatSampler::getNewStatistics() {
   return m_statMngr->getNewlyAddedStatsList();
 }
 
+void HostStatSampler::retireStatistics(Statistics* stat) {
+  m_statMngr->retireStatistics(stat);
+}
+
 int64_t HostStatSampler::getSystemId() { return m_pid; }
 
 system_clock::time_point HostStatSampler::getSystemStartTime() {
@@ -107,6 +107,11 @@ class HostStatSampler {
    * instances.
    */
   std::vector<Statistics*>& getNewStatistics();
+  /**
+   * Deletes a closed statistics resource instance that has been removed from
+   * the statistics list once no lock-free reader can reference it.
+   */
+  void retireStatistics(Statistics* stat);
   /**
    * Returns a unique id for the sampler's system.
    */
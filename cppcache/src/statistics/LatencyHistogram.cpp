@@ -0,0 +1,181 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "LatencyHistogram.hpp"
+
+#include <cmath>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace apache {
+namespace geode {
+namespace statistics {
+
+constexpr int32_t LatencyHistogram::SUB_BUCKET_BITS;
+constexpr int32_t LatencyHistogram::SUB_BUCKET_COUNT;
+constexpr int32_t LatencyHistogram::MIN_EXPONENT;
+constexpr int32_t LatencyHistogram::MAX_EXPONENT;
+constexpr int32_t LatencyHistogram::BUCKET_COUNT;
+constexpr const char* LatencyHistogram::STATS_DESC;
+
+namespace {
+
+std::string bucketName(int32_t index) {
+  if (index == LatencyHistogram::BUCKET_COUNT - 1) {
+    return "ge" + std::to_string(int64_t{1} << LatencyHistogram::MAX_EXPONENT) +
+           "ns";
+  }
+  return "lt" + std::to_string(LatencyHistogram::bucketUpperBound(index)) +
+         "ns";
+}
+
+}  // namespace
+
+LatencyHistogram::LatencyHistogram(StatisticsFactory* factory,
+                                   std::string name, std::string textId)
+    : name_(std::move(name)), textId_(std::move(textId)) {
+  auto statsType = factory->findType(name_);
+
+  if (!statsType) {
+    std::vector<std::shared_ptr<StatisticDescriptor>> stats;
+    stats.reserve(BUCKET_COUNT + 2);
+    stats.push_back(factory->createLongCounter(
+        "count", "Total number of operations recorded", "operations", true));
+    stats.push_back(factory->createLongCounter(
+        "totalTime", "Total time spent in recorded operations", "Nanoseconds",
+        false));
+    for (int32_t i = 0; i < BUCKET_COUNT; i++) {
+      stats.push_back(factory->createLongCounter(
+          bucketName(i), "Number of operations that took " + bucketName(i),
+          "operations", false));
+    }
+    statsType = factory->createType(name_, STATS_DESC, std::move(stats));
+  }
+
+  countId_ = statsType->nameToId("count");
+  totalTimeId_ = statsType->nameToId("totalTime");
+  for (int32_t i = 0; i < BUCKET_COUNT; i++) {
+    bucketIds_[i] = statsType->nameToId(bucketName(i));
+  }
+
+  stats_ = factory->createAtomicStatistics(statsType, textId_);
+}
+
+LatencyHistogram::~LatencyHistogram() noexcept {
+  // Owned and deleted by the StatisticsManager once closed.
+  stats_ = nullptr;
+}
+
+void LatencyHistogram::close() { stats_->close(); }
+
+void LatencyHistogram::record(int64_t nanos) {
+  stats_->incLong(bucketIds_[bucketIndex(nanos)], 1);
+  stats_->incLong(totalTimeId_, nanos);
+  stats_->incLong(countId_, 1);
+}
+
+void LatencyHistogram::recordSince(int64_t start) {
+  record(std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+             .count() -
+         start);
+}
+
+int64_t LatencyHistogram::getCount() const { return stats_->getLong(countId_); }
+
+int64_t LatencyHistogram::getTotalTime() const {
+  return stats_->getLong(totalTimeId_);
+}
+
+int64_t LatencyHistogram::getBucketCount(int32_t index) const {
+  return stats_->getLong(bucketIds_[index]);
+}
+
+int64_t LatencyHistogram::getValueAtPercentile(double percentile) const {
+  // Buckets are read one at a time while writers may be recording, so work
+  // from a snapshot rather than the separately maintained count.
+  std::array<int64_t, BUCKET_COUNT> counts;
+  int64_t total = 0;
+  for (int32_t i = 0; i < BUCKET_COUNT; i++) {
+    counts[i] = getBucketCount(i);
+    total += counts[i];
+  }
+  if (total == 0) {
+    return 0;
+  }
+
+  if (percentile < 0.0) {
+    percentile = 0.0;
+  } else if (percentile > 100.0) {
+    percentile = 100.0;
+  }
+  auto target = static_cast<int64_t>(
+      std::ceil(percentile / 100.0 * static_cast<double>(total)));
+  if (target < 1) {
+    target = 1;
+  }
+
+  int64_t seen = 0;
+  for (int32_t i = 0; i < BUCKET_COUNT; i++) {
+    seen += counts[i];
+    if (seen >= target) {
+      return bucketUpperBound(i);
+    }
+  }
+  return bucketUpperBound(BUCKET_COUNT - 1);
+}
+
+int32_t LatencyHistogram::bucketIndex(int64_t nanos) {
+  if (nanos < (int64_t{1} << MIN_EXPONENT)) {
+    return 0;
+  }
+
+  auto value = static_cast<uint64_t>(nanos);
+  int32_t exponent = 0;
+  for (int32_t shift = 32; shift > 0; shift >>= 1) {
+    if (value >> shift) {
+      value >>= shift;
+      exponent += shift;
+    }
+  }
+  if (exponent >= MAX_EXPONENT) {
+    return BUCKET_COUNT - 1;
+  }
+
+  auto subBucket = static_cast<int32_t>(
+      (static_cast<uint64_t>(nanos) >> (exponent - SUB_BUCKET_BITS)) &
+      (SUB_BUCKET_COUNT - 1));
+  return 1 + (exponent - MIN_EXPONENT) * SUB_BUCKET_COUNT + subBucket;
+}
+
+int64_t LatencyHistogram::bucketUpperBound(int32_t index) {
+  if (index <= 0) {
+    return int64_t{1} << MIN_EXPONENT;
+  } else if (index >= BUCKET_COUNT - 1) {
+    return std::numeric_limits<int64_t>::max();
+  }
+
+  auto exponent = MIN_EXPONENT + (index - 1) / SUB_BUCKET_COUNT;
+  auto subBucket = (index - 1) % SUB_BUCKET_COUNT;
+  return (SUB_BUCKET_COUNT + subBucket + int64_t{1})
+         << (exponent - SUB_BUCKET_BITS);
+}
+
+}  // namespace statistics
+}  // namespace geode
+}  // namespace apache
@@ -0,0 +1,156 @@
+#pragma once
+
+#ifndef GEODE_STATISTICS_LATENCYHISTOGRAM_H_
+#define GEODE_STATISTICS_LATENCYHISTOGRAM_H_
+
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+#include <geode/internal/geode_globals.hpp>
+
+#include "Statistics.hpp"
+#include "StatisticsFactory.hpp"
+
+namespace apache {
+namespace geode {
+namespace statistics {
+
+/**
+ * Fixed size, log-bucketed latency histogram backed by an atomic
+ * {@link Statistics} instance.
+ *
+ * Every power of two between MIN_EXPONENT and MAX_EXPONENT nanoseconds is
+ * split into SUB_BUCKET_COUNT linear sub buckets, bounding the relative error
+ * of a reported percentile to 1 / SUB_BUCKET_COUNT. Each histogram name is a
+ * statistics type of its own with one long counter per bucket, so every
+ * histogram is sampled into the statistics archive as a distinct statistics
+ * instance and recording a value is a few atomic increments. Histograms
+ * registered with the StatisticsManager are also served by the OpenMetrics
+ * exporter.
+ */
+class LatencyHistogram {
+ public:
+  static constexpr int32_t SUB_BUCKET_BITS = 3;
+  static constexpr int32_t SUB_BUCKET_COUNT = 1 << SUB_BUCKET_BITS;
+  /** Values below 2^MIN_EXPONENT ns (~1 microsecond) share the first bucket */
+  static constexpr int32_t MIN_EXPONENT = 10;
+  /** Values of 2^MAX_EXPONENT ns (~68 seconds) or more share the last bucket */
+  static constexpr int32_t MAX_EXPONENT = 36;
+  static constexpr int32_t BUCKET_COUNT =
+      (MAX_EXPONENT - MIN_EXPONENT) * SUB_BUCKET_COUNT + 2;
+
+  /**
+   * Creates the histogram statistics instance, registering its statistics
+   * type on first use.
+   *
+   * @param name the statistics type and metric name, e.g.
+   *        "RegionStatistics_getLatency"
+   * @param textId identifies the owner, e.g. the region's full path
+   */
+  LatencyHistogram(StatisticsFactory* factory, std::string name,
+                   std::string textId);
+
+  ~LatencyHistogram() noexcept;
+
+  LatencyHistogram(const LatencyHistogram&) = delete;
+  LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+
+  void close();
+
+  const std::string& getName() const { return name_; }
+
+  const std::string& getTextId() const { return textId_; }
+
+  /** Records one operation that took the given number of nanoseconds. */
+  void record(int64_t nanos);
+
+  /** Records one operation that started at start, per Utils::startStatOpTime */
+  void recordSince(int64_t start);
+
+  /** Total number of recorded operations. */
+  int64_t getCount() const;
+
+  /** Sum of all recorded operation times in nanoseconds. */
+  int64_t getTotalTime() const;
+
+  /**
+   * Returns the upper bound, in nanoseconds, of the bucket containing the
+   * given percentile (0 - 100) of recorded values, or 0 if nothing has been
+   * recorded.
+   */
+  int64_t getValueAtPercentile(double percentile) const;
+
+  /** Number of recorded values that fell into the bucket at index. */
+  int64_t getBucketCount(int32_t index) const;
+
+  Statistics* getStats() const { return stats_; }
+
+  /** Index of the bucket that holds nanos. */
+  static int32_t bucketIndex(int64_t nanos);
+
+  /** Smallest value, in nanoseconds, that is not in the bucket at index. */
+  static int64_t bucketUpperBound(int32_t index);
+
+ private:
+  std::string name_;
+  std::string textId_;
+  Statistics* stats_;
+  int32_t countId_;
+  int32_t totalTimeId_;
+  std::array<int32_t, BUCKET_COUNT> bucketIds_;
+
+  static constexpr const char* STATS_DESC =
+      "Log-bucketed operation latency distribution";
+};
+
+/**
+ * Records the lifetime of this object into a histogram, if one is given.
+ * Useful for operations with several return or throw paths.
+ */
+class ScopedLatencyRecorder {
+ public:
+  explicit ScopedLatencyRecorder(LatencyHistogram* histogram)
+      : histogram_(histogram),
+        start_(histogram ? std::chrono::steady_clock::now()
+                         : std::chrono::steady_clock::time_point{}) {}
+
+  ~ScopedLatencyRecorder() noexcept {
+    if (histogram_) {
+      histogram_->record(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                             std::chrono::steady_clock::now() - start_)
+                             .count());
+    }
+  }
+
+  ScopedLatencyRecorder(const ScopedLatencyRecorder&) = delete;
+  ScopedLatencyRecorder& operator=(const ScopedLatencyRecorder&) = delete;
+
+ private:
+  LatencyHistogram* histogram_;
+  std::chrono::steady_clock::time_point start_;
+};
+
+}  // namespace statistics
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_STATISTICS_LATENCYHISTOGRAM_H_
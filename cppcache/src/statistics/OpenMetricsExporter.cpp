@@ -0,0 +1,413 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "OpenMetricsExporter.hpp"
+
+#include <cstdio>
+#include <istream>
+#include <limits>
+#include <sstream>
+#include <utility>
+
+#include <boost/asio/read_until.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/asio/streambuf.hpp>
+#include <boost/asio/write.hpp>
+
+#include <geode/ExceptionTypes.hpp>
+
+#include "../DistributedSystemImpl.hpp"
+#include "../util/Log.hpp"
+#include "StatisticDescriptorImpl.hpp"
+#include "StatisticsManager.hpp"
+#include "StatisticsType.hpp"
+
+namespace apache {
+namespace geode {
+namespace statistics {
+
+using client::IllegalStateException;
+
+constexpr const char* OpenMetricsExporter::CONTENT_TYPE;
+
+namespace {
+
+constexpr std::size_t MAX_REQUEST_SIZE = 8192;
+
+std::string escapeLabelValue(const std::string& value) {
+  std::string escaped;
+  escaped.reserve(value.size());
+  for (auto c : value) {
+    switch (c) {
+      case '\\':
+        escaped += "\\\\";
+        break;
+      case '"':
+        escaped += "\\\"";
+        break;
+      case '\n':
+        escaped += "\\n";
+        break;
+      default:
+        escaped += c;
+    }
+  }
+  return escaped;
+}
+
+std::string escapeHelp(const std::string& value) {
+  std::string escaped;
+  escaped.reserve(value.size());
+  for (auto c : value) {
+    switch (c) {
+      case '\\':
+        escaped += "\\\\";
+        break;
+      case '\n':
+        escaped += "\\n";
+        break;
+      default:
+        escaped += c;
+    }
+  }
+  return escaped;
+}
+
+void writeValue(std::ostream& out, Statistics* stats,
+                const std::shared_ptr<StatisticDescriptor>& descriptor) {
+  auto descriptorImpl =
+      std::static_pointer_cast<StatisticDescriptorImpl>(descriptor);
+  switch (descriptorImpl->getTypeCode()) {
+    case INT_TYPE:
+      out << stats->getInt(descriptor);
+      break;
+    case LONG_TYPE:
+      out << stats->getLong(descriptor);
+      break;
+    case DOUBLE_TYPE:
+      out << stats->getDouble(descriptor);
+      break;
+  }
+}
+
+std::string httpResponse(const std::string& status,
+                         const std::string& contentType,
+                         const std::string& body) {
+  std::string response = "HTTP/1.1 " + status + "\r\n";
+  response += "Content-Type: " + contentType + "\r\n";
+  response += "Content-Length: " + std::to_string(body.size()) + "\r\n";
+  response += "Connection: close\r\n\r\n";
+  response += body;
+  return response;
+}
+
+}  // namespace
+
+constexpr std::chrono::seconds OpenMetricsExporter::DEFAULT_REQUEST_TIMEOUT;
+
+OpenMetricsExporter::OpenMetricsExporter(
+    uint16_t port, std::string socketPath,
+    std::chrono::milliseconds requestTimeout)
+    : statisticsManager_(nullptr),
+      port_(port),
+      socketPath_(std::move(socketPath)),
+      requestTimeout_(requestTimeout),
+      running_(false) {}
+
+OpenMetricsExporter::~OpenMetricsExporter() noexcept {
+  stop();
+}
+
+void OpenMetricsExporter::listen() {
+  try {
+    if (port_ != 0) {
+      boost::asio::ip::tcp::endpoint endpoint(
+          boost::asio::ip::address_v4::loopback(), port_);
+      tcpAcceptor_ = std::unique_ptr<boost::asio::ip::tcp::acceptor>(
+          new boost::asio::ip::tcp::acceptor(io_context_, endpoint, true));
+      acceptTcp();
+    }
+
+    if (!socketPath_.empty()) {
+#ifdef BOOST_ASIO_HAS_LOCAL_SOCKETS
+      std::remove(socketPath_.c_str());
+      localAcceptor_ =
+          std::unique_ptr<boost::asio::local::stream_protocol::acceptor>(
+              new boost::asio::local::stream_protocol::acceptor(
+                  io_context_,
+                  boost::asio::local::stream_protocol::endpoint(socketPath_)));
+      acceptLocal();
+#else
+      LOGWARN(
+          "OpenMetricsExporter: Unix domain sockets are not supported on this "
+          "platform, ignoring %s",
+          socketPath_.c_str());
+#endif
+    }
+  } catch (const boost::system::system_error& e) {
+    throw IllegalStateException(
+        std::string("OpenMetricsExporter: unable to listen: ") + e.what());
+  }
+}
+
+void OpenMetricsExporter::start(StatisticsManager* statisticsManager) {
+  statisticsManager_ = statisticsManager;
+  running_ = true;
+  thread_ = std::thread([this] {
+    client::DistributedSystemImpl::setThreadName("NC Metrics Exporter");
+    while (running_) {
+      try {
+        io_context_.run();
+        break;
+      } catch (const std::exception& e) {
+        LOGERROR("OpenMetricsExporter: %s", e.what());
+      }
+    }
+  });
+
+  std::string listeners;
+  if (port_ != 0) {
+    listeners = "127.0.0.1:" + std::to_string(port_);
+  }
+  if (!socketPath_.empty()) {
+    listeners += (listeners.empty() ? "" : " and ") + socketPath_;
+  }
+  LOGINFO("OpenMetricsExporter: serving statistics on %s", listeners.c_str());
+}
+
+void OpenMetricsExporter::stop() {
+  running_ = false;
+  io_context_.stop();
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+
+  boost::system::error_code ignored;
+  if (tcpAcceptor_) {
+    tcpAcceptor_->close(ignored);
+    tcpAcceptor_.reset();
+  }
+#ifdef BOOST_ASIO_HAS_LOCAL_SOCKETS
+  if (localAcceptor_) {
+    localAcceptor_->close(ignored);
+    localAcceptor_.reset();
+    std::remove(socketPath_.c_str());
+  }
+#endif
+}
+
+void OpenMetricsExporter::acceptTcp() {
+  auto socket = std::make_shared<boost::asio::ip::tcp::socket>(io_context_);
+  tcpAcceptor_->async_accept(
+      *socket, [this, socket](const boost::system::error_code& error) {
+        if (!error) {
+          serve(socket);
+        }
+        if (running_ && error != boost::asio::error::operation_aborted) {
+          acceptTcp();
+        }
+      });
+}
+
+#ifdef BOOST_ASIO_HAS_LOCAL_SOCKETS
+void OpenMetricsExporter::acceptLocal() {
+  auto socket = std::make_shared<boost::asio::local::stream_protocol::socket>(
+      io_context_);
+  localAcceptor_->async_accept(
+      *socket, [this, socket](const boost::system::error_code& error) {
+        if (!error) {
+          serve(socket);
+        }
+        if (running_ && error != boost::asio::error::operation_aborted) {
+          acceptLocal();
+        }
+      });
+}
+#endif
+
+template <typename Socket>
+void OpenMetricsExporter::serve(std::shared_ptr<Socket> socket) {
+  // Closes the connection of a client that never completes its request, or
+  // never reads the reply, instead of keeping its socket open indefinitely.
+  auto timer = std::make_shared<boost::asio::steady_timer>(io_context_);
+  timer->expires_after(requestTimeout_);
+  timer->async_wait([socket](const boost::system::error_code& error) {
+    if (!error) {
+      boost::system::error_code ignored;
+      socket->close(ignored);
+    }
+  });
+
+  auto request = std::make_shared<boost::asio::streambuf>(MAX_REQUEST_SIZE);
+  boost::asio::async_read_until(
+      *socket, *request, "\r\n\r\n",
+      [this, socket, request, timer](const boost::system::error_code& error,
+                                     std::size_t) {
+        if (error) {
+          timer->cancel();
+          return;
+        }
+
+        std::istream stream(request.get());
+        std::string method;
+        std::string target;
+        stream >> method >> target;
+
+        auto response = std::make_shared<std::string>();
+        if (method != "GET") {
+          *response = httpResponse("405 Method Not Allowed", "text/plain",
+                                   "Only GET is supported\n");
+        } else if (target != "/metrics" && target != "/") {
+          *response = httpResponse("404 Not Found", "text/plain",
+                                   "Statistics are served on /metrics\n");
+        } else {
+          *response = httpResponse("200 OK", CONTENT_TYPE, scrape());
+        }
+
+        boost::asio::async_write(
+            *socket, boost::asio::buffer(*response),
+            [socket, response, timer](const boost::system::error_code&,
+                                      std::size_t) {
+              timer->cancel();
+              boost::system::error_code ignored;
+              socket->shutdown(Socket::shutdown_both, ignored);
+            });
+      });
+}
+
+std::string OpenMetricsExporter::scrape() const {
+  auto snapshot = statisticsManager_->getStatisticsSnapshot();
+  std::string body;
+  statisticsManager_->visitLatencyHistograms(
+      [&](const std::vector<LatencyHistogram*>& histograms) {
+        body = render(snapshot ? snapshot->getStatistics()
+                               : std::vector<Statistics*>{},
+                      histograms);
+      });
+  return body;
+}
+
+std::string OpenMetricsExporter::render(
+    const std::vector<Statistics*>& statistics,
+    const std::vector<LatencyHistogram*>& histograms) {
+  // A metric family must be exposed as one contiguous block, so group the
+  // instances by type while keeping registration order. Statistics backing a
+  // latency histogram are rendered as an OpenMetrics histogram below instead.
+  std::vector<std::pair<StatisticsType*, std::vector<Statistics*>>> byType;
+  for (auto stats : statistics) {
+    if (stats == nullptr || stats->isClosed() ||
+        std::any_of(histograms.begin(), histograms.end(),
+                    [stats](const LatencyHistogram* histogram) {
+                      return histogram->getStats() == stats;
+                    })) {
+      continue;
+    }
+    auto type = stats->getType();
+    auto found = byType.begin();
+    while (found != byType.end() && found->first != type) {
+      ++found;
+    }
+    if (found == byType.end()) {
+      byType.emplace_back(type, std::vector<Statistics*>{stats});
+    } else {
+      found->second.push_back(stats);
+    }
+  }
+
+  std::ostringstream out;
+  out.precision(std::numeric_limits<double>::max_digits10);
+  for (auto& entry : byType) {
+    auto type = entry.first;
+    for (auto& descriptor : type->getStatistics()) {
+      auto family =
+          metricName("geode_" + type->getName() + "_" + descriptor->getName());
+      auto counter = descriptor->isCounter();
+      out << "# TYPE " << family << (counter ? " counter\n" : " gauge\n");
+      out << "# HELP " << family << ' '
+          << escapeHelp(descriptor->getDescription()) << '\n';
+      for (auto stats : entry.second) {
+        out << family << (counter ? "_total" : "") << "{name=\""
+            << escapeLabelValue(stats->getTextId()) << "\"} ";
+        writeValue(out, stats, descriptor);
+        out << '\n';
+      }
+    }
+  }
+
+  std::vector<std::pair<std::string, std::vector<LatencyHistogram*>>> byName;
+  for (auto histogram : histograms) {
+    auto found = byName.begin();
+    while (found != byName.end() && found->first != histogram->getName()) {
+      ++found;
+    }
+    if (found == byName.end()) {
+      byName.emplace_back(histogram->getName(),
+                          std::vector<LatencyHistogram*>{histogram});
+    } else {
+      found->second.push_back(histogram);
+    }
+  }
+
+  for (auto& entry : byName) {
+    auto family = metricName("geode_" + entry.first);
+    out << "# TYPE " << family << " histogram\n";
+    out << "# HELP " << family << " Operation latency in nanoseconds\n";
+    for (auto histogram : entry.second) {
+      auto label = "{name=\"" + escapeLabelValue(histogram->getTextId()) + '"';
+      // OpenMetrics buckets are cumulative and inclusive, the histogram's are
+      // neither. The last bucket is unbounded, so it becomes the +Inf bucket
+      // and its cumulative count is a _count consistent with the buckets.
+      int64_t cumulative = 0;
+      for (int32_t i = 0; i < LatencyHistogram::BUCKET_COUNT; i++) {
+        cumulative += histogram->getBucketCount(i);
+        out << family << "_bucket" << label << ",le=\"";
+        if (i == LatencyHistogram::BUCKET_COUNT - 1) {
+          out << "+Inf";
+        } else {
+          out << LatencyHistogram::bucketUpperBound(i) - 1;
+        }
+        out << "\"} " << cumulative << '\n';
+      }
+      out << family << "_count" << label << "} " << cumulative << '\n';
+      out << family << "_sum" << label << "} " << histogram->getTotalTime()
+          << '\n';
+    }
+  }
+  out << "# EOF\n";
+  return out.str();
+}
+
+std::string OpenMetricsExporter::metricName(const std::string& name) {
+  std::string metric;
+  metric.reserve(name.size() + 1);
+  if (!name.empty() && name[0] >= '0' && name[0] <= '9') {
+    metric += '_';
+  }
+  for (auto c : name) {
+    if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+        (c >= '0' && c <= '9') || c == '_' || c == ':') {
+      metric += c;
+    } else {
+      metric += '_';
+    }
+  }
+  return metric;
+}
+
+}  // namespace statistics
+}  // namespace geode
+}  // namespace apache
@@ -0,0 +1,134 @@
+#pragma once
+
+#ifndef GEODE_STATISTICS_OPENMETRICSEXPORTER_H_
+#define GEODE_STATISTICS_OPENMETRICSEXPORTER_H_
+
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/local/stream_protocol.hpp>
+
+#include <geode/internal/geode_globals.hpp>
+
+#include "LatencyHistogram.hpp"
+#include "Statistics.hpp"
+
+namespace apache {
+namespace geode {
+namespace statistics {
+
+class StatisticsManager;
+
+/**
+ * Serves every registered {@link Statistics} instance, and every registered
+ * {@link LatencyHistogram}, over HTTP in the
+ * OpenMetrics text exposition format, e.g.
+ * <code>curl http://127.0.0.1:&lt;port&gt;/metrics</code> or
+ * <code>curl --unix-socket &lt;path&gt; http://localhost/metrics</code>.
+ *
+ * The listeners are bound by listen(), which is done before any other cache
+ * service starts so that an unusable port or socket fails cache creation
+ * cleanly. Serving starts once the StatisticsManager exists.
+ *
+ * The TCP listener is bound to the loopback interface only. Each scrape reads
+ * the StatisticsManager's published snapshot and the statistics values
+ * without taking the statistics list lock.
+ */
+class OpenMetricsExporter {
+ public:
+  static constexpr const char* CONTENT_TYPE =
+      "application/openmetrics-text; version=1.0.0; charset=utf-8";
+
+  /** How long a connection may take to send its request and read the reply */
+  static constexpr std::chrono::seconds DEFAULT_REQUEST_TIMEOUT{5};
+
+  /**
+   * @param port loopback TCP port to listen on, 0 disables the TCP listener.
+   * @param socketPath Unix domain socket to listen on, empty disables it.
+   * @param requestTimeout connections still open after this long are closed,
+   *   so that idle clients do not hold sockets forever.
+   */
+  OpenMetricsExporter(
+      uint16_t port, std::string socketPath,
+      std::chrono::milliseconds requestTimeout = DEFAULT_REQUEST_TIMEOUT);
+
+  ~OpenMetricsExporter() noexcept;
+
+  OpenMetricsExporter(const OpenMetricsExporter&) = delete;
+  OpenMetricsExporter& operator=(const OpenMetricsExporter&) = delete;
+
+  /**
+   * Binds the listeners, without serving yet.
+   * @throws IllegalStateException if a listener could not be bound.
+   */
+  void listen();
+
+  /** Starts serving the statistics of statisticsManager on the listeners. */
+  void start(StatisticsManager* statisticsManager);
+
+  void stop();
+
+  /**
+   * Renders the open statistics in statistics, and histograms as OpenMetrics
+   * histograms, as an OpenMetrics exposition.
+   */
+  static std::string render(
+      const std::vector<Statistics*>& statistics,
+      const std::vector<LatencyHistogram*>& histograms = {});
+
+  /** Converts name into a valid OpenMetrics metric name */
+  static std::string metricName(const std::string& name);
+
+ private:
+  StatisticsManager* statisticsManager_;
+  uint16_t port_;
+  std::string socketPath_;
+  std::chrono::milliseconds requestTimeout_;
+  std::atomic<bool> running_;
+  boost::asio::io_context io_context_;
+  std::unique_ptr<boost::asio::ip::tcp::acceptor> tcpAcceptor_;
+#ifdef BOOST_ASIO_HAS_LOCAL_SOCKETS
+  std::unique_ptr<boost::asio::local::stream_protocol::acceptor>
+      localAcceptor_;
+#endif
+  std::thread thread_;
+
+  void acceptTcp();
+#ifdef BOOST_ASIO_HAS_LOCAL_SOCKETS
+  void acceptLocal();
+#endif
+  std::string scrape() const;
+
+  template <typename Socket>
+  void serve(std::shared_ptr<Socket> socket);
+};
+
+}  // namespace statistics
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_STATISTICS_OPENMETRICSEXPORTER_H_
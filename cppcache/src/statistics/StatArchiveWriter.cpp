@@ -470,9 +470,10 @@ void StatArchiveWriter::sampleResources() {
         this->dataBuffer_->writeInt(id);
         resourceInstMap_.erase(mapIter);
       }
-      // Delete stats object stat list
-      StatisticsManager::deleteStatistics(*statlistIter);
+      // Remove stats object from stat list and delete it once unreferenced
+      auto stat = *statlistIter;
       statsList.erase(statlistIter);
+      sampler_->retireStatistics(stat);
       statlistIter = statsList.begin();
     } else {
       ++statlistIter;
@@ -17,6 +17,7 @@
 
 #include "StatisticsManager.hpp"
 
+#include <algorithm>
 #include <string>
 
 #include <geode/Exception.hpp>
@@ -28,6 +29,8 @@
 #include "AtomicStatisticsImpl.hpp"
 #include "GeodeStatisticsFactory.hpp"
 #include "HostStatSampler.hpp"
+#include "LatencyHistogram.hpp"
+#include "OpenMetricsExporter.hpp"
 #include "OsStatisticsImpl.hpp"
 
 namespace apache {
@@ -44,7 +47,9 @@ StatisticsManager::StatisticsManager(
     int64_t statDiskSpaceLimit)
     : m_sampleIntervalMs(sampleInterval),
       m_sampler(nullptr),
-      m_adminRegion(nullptr) {
+      m_adminRegion(nullptr),
+      m_statsSnapshot(std::make_shared<StatisticsSnapshot>(
+          std::vector<Statistics*>())) {
   m_newlyAddedStatsList.reserve(16);  // Allocate initial sizes
   m_statisticsFactory =
       std::unique_ptr<GeodeStatisticsFactory>(new GeodeStatisticsFactory(this));
@@ -68,7 +73,8 @@ void StatisticsManager::forceSample() {
 
 StatisticsManager::~StatisticsManager() {
   try {
-    // Stop the sampler
+    // Stop the exporter and sampler
+    m_exporter = nullptr;
     closeSampler();
 
     // List should be empty if close() is called on each Stats object
@@ -96,6 +102,7 @@ StatisticsManager::~StatisticsManager() {
       }
       m_statsList.erase(m_statsList.begin(), m_statsList.end());
     }
+    std::atomic_store(&m_statsSnapshot, std::shared_ptr<StatisticsSnapshot>());
   } catch (const Exception& ex) {
     Log::logCatch(LogLevel::Warning,
                   "~StatisticsManager swallowing Geode exception", ex);
@@ -130,9 +137,59 @@ void StatisticsManager::addStatisticsToList(Statistics* stat) {
     After writing token to sampled file, stats ptrs will be deleted from list.
     */
     m_newlyAddedStatsList.push_back(stat);
+
+    publishSnapshot();
+  }
+}
+
+void StatisticsManager::retireStatistics(Statistics* stat) {
+  if (stat) {
+    std::atomic_load(&m_statsSnapshot)->retired_.push_back(stat);
+    publishSnapshot();
   }
 }
 
+void StatisticsManager::publishSnapshot() {
+  auto snapshot = std::make_shared<StatisticsSnapshot>(m_statsList);
+  // Older snapshots keep newer ones alive, so a retired statistics instance is
+  // only deleted once no reader can still be iterating over it.
+  std::atomic_load(&m_statsSnapshot)->next_ = snapshot;
+  std::atomic_store(&m_statsSnapshot, snapshot);
+}
+
+std::shared_ptr<const StatisticsSnapshot>
+StatisticsManager::getStatisticsSnapshot() const {
+  return std::atomic_load(&m_statsSnapshot);
+}
+
+void StatisticsManager::startExporter(
+    std::unique_ptr<OpenMetricsExporter> exporter) {
+  m_exporter = std::move(exporter);
+  m_exporter->start(this);
+}
+
+void StatisticsManager::addLatencyHistogram(LatencyHistogram* histogram) {
+  std::lock_guard<decltype(m_latencyHistogramsLock)> guard(
+      m_latencyHistogramsLock);
+  m_latencyHistograms.push_back(histogram);
+}
+
+void StatisticsManager::removeLatencyHistogram(LatencyHistogram* histogram) {
+  std::lock_guard<decltype(m_latencyHistogramsLock)> guard(
+      m_latencyHistogramsLock);
+  m_latencyHistograms.erase(std::remove(m_latencyHistograms.begin(),
+                                        m_latencyHistograms.end(), histogram),
+                            m_latencyHistograms.end());
+}
+
+void StatisticsManager::visitLatencyHistograms(
+    const std::function<void(const std::vector<LatencyHistogram*>&)>&
+        visitor) {
+  std::lock_guard<decltype(m_latencyHistogramsLock)> guard(
+      m_latencyHistogramsLock);
+  visitor(m_latencyHistograms);
+}
+
 int32_t StatisticsManager::getStatListModCount() {
   std::lock_guard<decltype(m_statsListLock)> guard(m_statsListLock);
   return static_cast<int32_t>(m_statsList.size());
@@ -232,6 +289,15 @@ void StatisticsManager::deleteStatistics(Statistics*& stat) {
   stat = nullptr;
 }
 
+StatisticsSnapshot::StatisticsSnapshot(std::vector<Statistics*> statistics)
+    : statistics_(std::move(statistics)) {}
+
+StatisticsSnapshot::~StatisticsSnapshot() noexcept {
+  for (auto& stat : retired_) {
+    StatisticsManager::deleteStatistics(stat);
+  }
+}
+
 void StatisticsManager::RegisterAdminRegion(
     std::shared_ptr<client::AdminRegion> adminRegPtr) {
   m_adminRegion = adminRegPtr;
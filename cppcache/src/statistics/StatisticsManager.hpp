@@ -20,8 +20,11 @@
 #ifndef GEODE_STATISTICS_STATISTICSMANAGER_H_
 #define GEODE_STATISTICS_STATISTICSMANAGER_H_
 
+#include <cstdint>
+#include <functional>
 #include <memory>
 #include <mutex>
+#include <string>
 #include <vector>
 
 #include <geode/ExceptionTypes.hpp>
@@ -45,6 +48,32 @@ namespace statistics {
 
 class GeodeStatisticsFactory;
 class HostStatSampler;
+class LatencyHistogram;
+class OpenMetricsExporter;
+
+/**
+ * Immutable copy of the registered statistics list that can be read without
+ * holding the statistics list lock. Statistics removed from the list after a
+ * snapshot was published are only deleted once that snapshot, and every
+ * older one, has been released.
+ */
+class StatisticsSnapshot {
+ public:
+  explicit StatisticsSnapshot(std::vector<Statistics*> statistics);
+  ~StatisticsSnapshot() noexcept;
+
+  StatisticsSnapshot(const StatisticsSnapshot&) = delete;
+  StatisticsSnapshot& operator=(const StatisticsSnapshot&) = delete;
+
+  const std::vector<Statistics*>& getStatistics() const { return statistics_; }
+
+ private:
+  std::vector<Statistics*> statistics_;
+  std::vector<Statistics*> retired_;
+  std::shared_ptr<StatisticsSnapshot> next_;
+
+  friend class StatisticsManager;
+};
 
 /**
  * Head Application Manager for Statistics Module.
@@ -70,8 +99,20 @@ class StatisticsManager {
 
   std::unique_ptr<GeodeStatisticsFactory> m_statisticsFactory;
 
+  // Latest snapshot of m_statsList, accessed with std::atomic_load/store.
+  std::shared_ptr<StatisticsSnapshot> m_statsSnapshot;
+
+  std::unique_ptr<OpenMetricsExporter> m_exporter;
+
+  // Latency histograms served by the exporter, they are never archived.
+  std::vector<LatencyHistogram*> m_latencyHistograms;
+  std::mutex m_latencyHistogramsLock;
+
   void closeSampler();
 
+  // Publishes a new snapshot of m_statsList, m_statsListLock must be held.
+  void publishSnapshot();
+
  public:
   StatisticsManager(const char* filePath,
                     std::chrono::milliseconds sampleIntervalMs, bool enabled,
@@ -90,6 +131,41 @@ class StatisticsManager {
 
   void addStatisticsToList(Statistics* stat);
 
+  /**
+   * Deletes a statistics instance that has already been erased from the
+   * statistics list, once no published snapshot can reference it any longer.
+   * The statistics list lock must be held.
+   */
+  void retireStatistics(Statistics* stat);
+
+  /**
+   * Returns the latest statistics snapshot without taking the statistics
+   * list lock.
+   */
+  std::shared_ptr<const StatisticsSnapshot> getStatisticsSnapshot() const;
+
+  /**
+   * Starts serving all statistics in OpenMetrics text format on the
+   * listeners of exporter, which must already be listening.
+   */
+  void startExporter(std::unique_ptr<OpenMetricsExporter> exporter);
+
+  /**
+   * Adds histogram to the latency histograms served by the OpenMetrics
+   * exporter. It must be removed again before it is deleted.
+   */
+  void addLatencyHistogram(LatencyHistogram* histogram);
+
+  void removeLatencyHistogram(LatencyHistogram* histogram);
+
+  /**
+   * Calls visitor with the registered latency histograms, none of which can
+   * be removed until it returns.
+   */
+  void visitLatencyHistograms(
+      const std::function<void(const std::vector<LatencyHistogram*>&)>&
+          visitor);
+
   std::vector<Statistics*>& getStatsList();
 
   std::vector<Statistics*>& getNewlyAddedStatsList();
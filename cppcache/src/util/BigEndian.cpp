@@ -0,0 +1,165 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "BigEndian.hpp"
+
+#include <cstring>
+#include <type_traits>
+
+#include "simd.hpp"
+
+namespace apache {
+namespace geode {
+namespace client {
+namespace internal {
+
+namespace {
+
+#if defined(GEODE_SIMD_SSE2)
+// x86 is little endian, so converting either way reverses the bytes of each
+// value.
+
+inline __m128i swap(__m128i v, std::integral_constant<size_t, 2>) {
+  return _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+}
+
+inline __m128i swap(__m128i v, std::integral_constant<size_t, 4>) {
+  v = _mm_or_si128(_mm_slli_epi32(v, 16), _mm_srli_epi32(v, 16));
+  return swap(v, std::integral_constant<size_t, 2>{});
+}
+
+inline __m128i swap(__m128i v, std::integral_constant<size_t, 8>) {
+  v = _mm_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1));
+  return swap(v, std::integral_constant<size_t, 4>{});
+}
+#endif
+
+#if defined(GEODE_SIMD_AVX2)
+template <size_t Size>
+inline __m256i reverseMask() {
+  alignas(32) uint8_t mask[32];
+  for (size_t i = 0; i < 32; i++) {
+    mask[i] = static_cast<uint8_t>((i & 15) / Size * Size + Size - 1 -
+                                   i % Size);
+  }
+  return _mm256_load_si256(reinterpret_cast<const __m256i*>(mask));
+}
+#endif
+
+/**
+ * Reverses the bytes of the leading blocks of count values of Size bytes,
+ * returning the number of values done.
+ */
+#if defined(GEODE_SIMD_SSE2)
+template <size_t Size>
+size_t swapBlocks(const uint8_t* in, size_t count, uint8_t* out) {
+  size_t i = 0;
+#if defined(GEODE_SIMD_AVX2)
+  if (count >= 32 / Size) {
+    const auto mask = reverseMask<Size>();
+    for (; i + 32 / Size <= count; i += 32 / Size) {
+      auto v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in));
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(out),
+                          _mm256_shuffle_epi8(v, mask));
+      in += 32;
+      out += 32;
+    }
+  }
+#endif
+  for (; i + 16 / Size <= count; i += 16 / Size) {
+    auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out),
+                     swap(v, std::integral_constant<size_t, Size>{}));
+    in += 16;
+    out += 16;
+  }
+  return i;
+}
+#else
+template <size_t Size>
+size_t swapBlocks(const uint8_t*, size_t, uint8_t*) {
+  return 0;
+}
+#endif
+
+template <typename T>
+void write(const T* values, size_t count, uint8_t* out) {
+  auto i = swapBlocks<sizeof(T)>(reinterpret_cast<const uint8_t*>(values),
+                                 count, out);
+  for (out += i * sizeof(T); i < count; i++) {
+    auto value = values[i];
+    for (size_t shift = sizeof(T) * 8; shift > 0; shift -= 8) {
+      *(out++) = static_cast<uint8_t>(value >> (shift - 8));
+    }
+  }
+}
+
+template <typename T>
+void read(const uint8_t* in, size_t count, T* values) {
+  auto i = swapBlocks<sizeof(T)>(in, count,
+                                 reinterpret_cast<uint8_t*>(values));
+  for (in += i * sizeof(T); i < count; i++) {
+    T value = 0;
+    for (size_t k = 0; k < sizeof(T); k++) {
+      value = static_cast<T>(value << 8 | *(in++));
+    }
+    values[i] = value;
+  }
+}
+
+}  // namespace
+
+void BigEndian::write(const void* values, size_t count, size_t size,
+                      uint8_t* out) {
+  switch (size) {
+    case 2:
+      internal::write(static_cast<const uint16_t*>(values), count, out);
+      break;
+    case 4:
+      internal::write(static_cast<const uint32_t*>(values), count, out);
+      break;
+    case 8:
+      internal::write(static_cast<const uint64_t*>(values), count, out);
+      break;
+    default:
+      std::memcpy(out, values, count * size);
+      break;
+  }
+}
+
+void BigEndian::read(const uint8_t* in, size_t count, size_t size,
+                     void* values) {
+  switch (size) {
+    case 2:
+      internal::read(in, count, static_cast<uint16_t*>(values));
+      break;
+    case 4:
+      internal::read(in, count, static_cast<uint32_t*>(values));
+      break;
+    case 8:
+      internal::read(in, count, static_cast<uint64_t*>(values));
+      break;
+    default:
+      std::memcpy(values, in, count * size);
+      break;
+  }
+}
+
+}  // namespace internal
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
@@ -0,0 +1,54 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef GEODE_UTIL_BIGENDIAN_H_
+#define GEODE_UTIL_BIGENDIAN_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace apache {
+namespace geode {
+namespace client {
+namespace internal {
+
+/**
+ * Bulk conversion of arrays of 2, 4 or 8 byte values, e.g. UTF-16 code units,
+ * integers or IEEE 754 bit patterns, to and from the big endian byte order of
+ * the Java serialization.
+ */
+struct BigEndian {
+  /**
+   * Writes count values of size bytes each from values to out.
+   */
+  static void write(const void* values, size_t count, size_t size,
+                    uint8_t* out);
+
+  /**
+   * Reads count values of size bytes each from in into values.
+   */
+  static void read(const uint8_t* in, size_t count, size_t size, void* values);
+};
+
+}  // namespace internal
+}  // namespace client
+}  // namespace geode
+}  // namespace apache
+
+#endif  // GEODE_UTIL_BIGENDIAN_H_
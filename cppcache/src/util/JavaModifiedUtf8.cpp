@@ -17,21 +17,235 @@
 
 #include "JavaModifiedUtf8.hpp"
 
+#include <algorithm>
 #include <codecvt>
+#include <cstring>
 #include <locale>
 
+#include "simd.hpp"
 #include "string.hpp"
 
 namespace apache {
 namespace geode {
 namespace client {
 namespace internal {
+
+namespace {
+
+/**
+ * Copies the leading ASCII bytes other than NUL of in to out, unless out is
+ * nullptr, and returns their number.
+ */
+size_t copyAscii(const uint8_t* in, size_t length, uint8_t* out) {
+  size_t i = 0;
+#if defined(GEODE_SIMD_AVX2)
+  const auto zero256 = _mm256_setzero_si256();
+  for (; i + 32 <= length; i += 32) {
+    auto v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+    auto mask = static_cast<uint32_t>(_mm256_movemask_epi8(
+        _mm256_or_si256(v, _mm256_cmpeq_epi8(v, zero256))));
+    if (mask != 0) {
+      auto ascii = static_cast<size_t>(countTrailingZeros(mask));
+      if (out != nullptr) {
+        std::memcpy(out + i, in + i, ascii);
+      }
+      return i + ascii;
+    }
+    if (out != nullptr) {
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), v);
+    }
+  }
+#endif
+#if defined(GEODE_SIMD_SSE2)
+  const auto zero = _mm_setzero_si128();
+  for (; i + 16 <= length; i += 16) {
+    auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+    auto mask = static_cast<uint32_t>(
+        _mm_movemask_epi8(_mm_or_si128(v, _mm_cmpeq_epi8(v, zero))));
+    if (mask != 0) {
+      auto ascii = static_cast<size_t>(countTrailingZeros(mask));
+      if (out != nullptr) {
+        std::memcpy(out + i, in + i, ascii);
+      }
+      return i + ascii;
+    }
+    if (out != nullptr) {
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), v);
+    }
+  }
+#else
+  // Eight bytes at a time, stopping at a word with a high bit or zero byte.
+  for (; i + 8 <= length; i += 8) {
+    uint64_t word;
+    std::memcpy(&word, in + i, sizeof(word));
+    if (((word | ((word - 0x0101010101010101ULL) & ~word)) &
+         0x8080808080808080ULL) != 0) {
+      break;
+    }
+    if (out != nullptr) {
+      std::memcpy(out + i, &word, sizeof(word));
+    }
+  }
+#endif
+  for (; i < length; i++) {
+    auto b = in[i];
+    if (b == 0 || b >= 0x80) {
+      break;
+    }
+    if (out != nullptr) {
+      out[i] = b;
+    }
+  }
+  return i;
+}
+
+#if defined(GEODE_SIMD_SSE2)
+/** All ones in each 16 bit lane holding an ASCII character other than NUL. */
+inline __m128i isAscii(__m128i v) {
+  const auto zero = _mm_setzero_si128();
+  return _mm_andnot_si128(
+      _mm_cmpeq_epi16(v, zero),
+      _mm_cmpeq_epi16(_mm_subs_epu16(v, _mm_set1_epi16(0x7f)), zero));
+}
+#endif
+
+/**
+ * Narrows the leading ASCII code units other than NUL of in to out and
+ * returns their number.
+ */
+size_t narrowAscii(const char16_t* in, size_t length, uint8_t* out) {
+  size_t i = 0;
+#if defined(GEODE_SIMD_SSE2)
+  for (; i + 16 <= length; i += 16) {
+    auto low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+    auto high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i + 8));
+    if (_mm_movemask_epi8(_mm_and_si128(isAscii(low), isAscii(high))) !=
+        0xffff) {
+      break;
+    }
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i),
+                     _mm_packus_epi16(low, high));
+  }
+#endif
+  for (; i < length; i++) {
+    auto c = in[i];
+    if (c == 0 || c >= 0x80) {
+      break;
+    }
+    out[i] = static_cast<uint8_t>(c);
+  }
+  return i;
+}
+
+/**
+ * Widens the leading ASCII bytes other than NUL of in to out and returns their
+ * number.
+ */
+size_t widenAscii(const uint8_t* in, size_t length, char16_t* out) {
+  size_t i = 0;
+#if defined(GEODE_SIMD_SSE2)
+  const auto zero = _mm_setzero_si128();
+  for (; i + 16 <= length; i += 16) {
+    auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+    if (_mm_movemask_epi8(_mm_or_si128(v, _mm_cmpeq_epi8(v, zero))) != 0) {
+      break;
+    }
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i),
+                     _mm_unpacklo_epi8(v, zero));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i + 8),
+                     _mm_unpackhi_epi8(v, zero));
+  }
+#endif
+  for (; i < length; i++) {
+    auto b = in[i];
+    if (b == 0 || b >= 0x80) {
+      break;
+    }
+    out[i] = b;
+  }
+  return i;
+}
+
+/** Encodes a code unit that is not ASCII, or NUL, into out. */
+inline size_t encodeUnit(char16_t c, uint8_t* out) {
+  if (c < 0x800) {
+    out[0] = static_cast<uint8_t>(0xC0 | c >> 6);
+    out[1] = static_cast<uint8_t>(0x80 | (c & 0x3F));
+    return 2;
+  }
+  out[0] = static_cast<uint8_t>(0xE0 | c >> 12);
+  out[1] = static_cast<uint8_t>(0x80 | ((c >> 6) & 0x3F));
+  out[2] = static_cast<uint8_t>(0x80 | (c & 0x3F));
+  return 3;
+}
+
+/** Collects encoded bytes into out, when not nullptr, up to limit. */
+class Output {
+ public:
+  Output(uint8_t* out, size_t limit) : out_(out), limit_(limit), length_(0) {}
+
+  inline void put(const uint8_t* bytes, size_t count) {
+    if (out_ != nullptr && length_ < limit_) {
+      // At most six bytes, cheaper than calling memcpy.
+      auto end = std::min(count, limit_ - length_);
+      for (size_t k = 0; k < end; k++) {
+        out_[length_ + k] = bytes[k];
+      }
+    }
+    length_ += count;
+  }
+
+  inline size_t putAscii(const uint8_t* in, size_t length) {
+    size_t ascii;
+    if (out_ != nullptr && length_ < limit_) {
+      ascii = copyAscii(in, std::min(length, limit_ - length_), out_ + length_);
+    } else {
+      ascii = copyAscii(in, length, nullptr);
+    }
+    length_ += ascii;
+    return ascii;
+  }
+
+  size_t length() const { return length_; }
+
+ private:
+  uint8_t* out_;
+  size_t limit_;
+  size_t length_;
+};
+
+inline char* appendUtf8(char* out, uint32_t c) {
+  if (c < 0x80) {
+    *(out++) = static_cast<char>(c);
+  } else if (c < 0x800) {
+    *(out++) = static_cast<char>(0xC0 | c >> 6);
+    *(out++) = static_cast<char>(0x80 | (c & 0x3F));
+  } else if (c < 0x10000) {
+    *(out++) = static_cast<char>(0xE0 | c >> 12);
+    *(out++) = static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+    *(out++) = static_cast<char>(0x80 | (c & 0x3F));
+  } else {
+    *(out++) = static_cast<char>(0xF0 | c >> 18);
+    *(out++) = static_cast<char>(0x80 | ((c >> 12) & 0x3F));
+    *(out++) = static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+    *(out++) = static_cast<char>(0x80 | (c & 0x3F));
+  }
+  return out;
+}
+
+}  // namespace
+
 size_t JavaModifiedUtf8::encodedLength(const std::string& utf8) {
   if (utf8.empty()) {
     return 0;
   }
 
-  return encodedLength(to_utf16(utf8));
+  auto encodedLen = encode(utf8.data(), utf8.length(), nullptr, 0);
+  if (encodedLen == std::string::npos) {
+    // Not well formed, leave it to the converter to report.
+    return encodedLength(to_utf16(utf8));
+  }
+  return encodedLen;
 }
 
 size_t JavaModifiedUtf8::encodedLength(const std::u16string& utf16) {
@@ -40,8 +254,23 @@ size_t JavaModifiedUtf8::encodedLength(const std::u16string& utf16) {
 
 size_t JavaModifiedUtf8::encodedLength(const char16_t* data, size_t length) {
   size_t encodedLen = 0;
-  while (length-- > 0) {
-    const char16_t c = *(data++);
+  size_t i = 0;
+#if defined(GEODE_SIMD_SSE2)
+  // Each code unit takes one byte, plus one if it is NUL or at least 0x80,
+  // plus another if it is at least 0x800.
+  const auto zero = _mm_setzero_si128();
+  const auto max2 = _mm_set1_epi16(0x7ff);
+  for (; i + 8 <= length; i += 8) {
+    auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+    auto atLeast2 = static_cast<uint32_t>(_mm_movemask_epi8(isAscii(v)));
+    auto only2 = static_cast<uint32_t>(_mm_movemask_epi8(
+        _mm_cmpeq_epi16(_mm_subs_epu16(v, max2), zero)));
+    encodedLen += 8 + (popCount(~atLeast2 & 0xffff) +
+                       popCount(~only2 & 0xffff)) / 2;
+  }
+#endif
+  for (; i < length; i++) {
+    const char16_t c = data[i];
     if (c == 0) {
       // NUL
       encodedLen += 2;
@@ -57,18 +286,124 @@ size_t JavaModifiedUtf8::encodedLength(const char16_t* data, size_t length) {
   return encodedLen;
 }
 
-std::string JavaModifiedUtf8::fromString(const std::string& utf8) {
-  return fromString(to_utf16(utf8));
+size_t JavaModifiedUtf8::encode(const char16_t* data, size_t length,
+                                uint8_t* out, size_t limit) {
+  size_t written = 0;
+  size_t i = 0;
+  while (i < length) {
+    auto c = data[i];
+    if (c != 0 && c < 0x80) {
+      auto ascii = narrowAscii(data + i, std::min(length - i, limit - written),
+                               out + written);
+      if (ascii == 0) {
+        break;
+      }
+      i += ascii;
+      written += ascii;
+    } else if (limit - written >= 3) {
+      written += encodeUnit(c, out + written);
+      i++;
+    } else {
+      uint8_t bytes[3];
+      auto count = encodeUnit(c, bytes);
+      std::memcpy(out + written, bytes, std::min(count, limit - written));
+      written += count;
+      i++;
+      if (written >= limit) {
+        break;
+      }
+    }
+  }
+  return written + encodedLength(data + i, length - i);
 }
 
-std::string JavaModifiedUtf8::fromString(const std::u16string& utf16) {
-  std::string jmutf8;
-  jmutf8.reserve(utf16.length());
+size_t JavaModifiedUtf8::encode(const char* utf8, size_t length, uint8_t* out,
+                                size_t limit) {
+  auto in = reinterpret_cast<const uint8_t*>(utf8);
+  Output output(out, limit);
+  size_t i = 0;
+  while (i < length) {
+    auto b = in[i];
+    if (b != 0 && b < 0x80) {
+      i += output.putAscii(in + i, length - i);
+      continue;
+    }
+    if (b == 0) {
+      static const uint8_t nul[] = {0xC0, 0x80};
+      output.put(nul, 2);
+      i++;
+      continue;
+    }
 
-  for (auto&& c : utf16) {
-    encode(c, jmutf8);
+    // Well formed sequences as in table 3-7 of the Unicode standard.
+    size_t count;
+    uint8_t min = 0x80;
+    uint8_t max = 0xBF;
+    if (b >= 0xC2 && b <= 0xDF) {
+      count = 2;
+    } else if (b >= 0xE0 && b <= 0xEF) {
+      count = 3;
+      if (b == 0xE0) {
+        min = 0xA0;
+      } else if (b == 0xED) {
+        max = 0x9F;
+      }
+    } else if (b >= 0xF0 && b <= 0xF4) {
+      count = 4;
+      if (b == 0xF0) {
+        min = 0x90;
+      } else if (b == 0xF4) {
+        max = 0x8F;
+      }
+    } else {
+      return std::string::npos;
+    }
+    if (length - i < count || in[i + 1] < min || in[i + 1] > max) {
+      return std::string::npos;
+    }
+    for (size_t k = 2; k < count; k++) {
+      if ((in[i + k] & 0xC0) != 0x80) {
+        return std::string::npos;
+      }
+    }
+
+    if (count < 4) {
+      // Code points of the BMP are encoded as in UTF-8.
+      output.put(in + i, count);
+    } else {
+      // Others as the UTF-8 encodings of their UTF-16 surrogate pair.
+      uint32_t codePoint = (static_cast<uint32_t>(b & 0x07) << 18 |
+                            static_cast<uint32_t>(in[i + 1] & 0x3F) << 12 |
+                            static_cast<uint32_t>(in[i + 2] & 0x3F) << 6 |
+                            static_cast<uint32_t>(in[i + 3] & 0x3F)) -
+                           0x10000;
+      uint8_t bytes[6];
+      encodeUnit(static_cast<char16_t>(0xD800 + (codePoint >> 10)), bytes);
+      encodeUnit(static_cast<char16_t>(0xDC00 + (codePoint & 0x3FF)),
+                 bytes + 3);
+      output.put(bytes, 6);
+    }
+    i += count;
   }
+  return output.length();
+}
 
+std::string JavaModifiedUtf8::fromString(const std::string& utf8) {
+  auto encodedLen = encode(utf8.data(), utf8.length(), nullptr, 0);
+  if (encodedLen == std::string::npos) {
+    return fromString(to_utf16(utf8));
+  }
+
+  std::string jmutf8(encodedLen, '\0');
+  encode(utf8.data(), utf8.length(), reinterpret_cast<uint8_t*>(&jmutf8[0]),
+         encodedLen);
+  return jmutf8;
+}
+
+std::string JavaModifiedUtf8::fromString(const std::u16string& utf16) {
+  std::string jmutf8(encodedLength(utf16), '\0');
+  encode(utf16.data(), utf16.length(), reinterpret_cast<uint8_t*>(&jmutf8[0]),
+         jmutf8.length());
   return jmutf8;
 }
 
@@ -91,14 +426,86 @@ void JavaModifiedUtf8::encode(const char16_t c, std::string& jmutf8) {
 }
 
 std::u16string JavaModifiedUtf8::decode(const char* buf, uint16_t len) {
-  std::u16string value;
+  // Every code unit takes at least one byte.
+  std::u16string value(len, u'\0');
+  size_t pos = 0;
   const auto end = buf + len;
   while (buf < end) {
-    value += decodeJavaModifiedUtf8Char(&buf);
+    auto b = static_cast<uint8_t>(*buf);
+    if (b != 0 && b < 0x80) {
+      auto ascii = widenAscii(reinterpret_cast<const uint8_t*>(buf),
+                              static_cast<size_t>(end - buf), &value[pos]);
+      buf += ascii;
+      pos += ascii;
+    } else {
+      value[pos++] = decodeJavaModifiedUtf8Char(&buf);
+    }
   }
+  value.resize(pos);
   return value;
 }
 
+std::string JavaModifiedUtf8::toUtf8(const char* buf, uint16_t len) {
+  // A UTF-8 encoding is never longer than the Java Modified UTF-8 one, except
+  // when the last character is cut short.
+  std::string utf8(static_cast<size_t>(len) + 2, '\0');
+  auto out = &utf8[0];
+  const auto begin = buf;
+  const auto end = buf + len;
+  while (buf < end) {
+    auto b = static_cast<uint8_t>(*buf);
+    if (b != 0 && b < 0x80) {
+      auto ascii = copyAscii(reinterpret_cast<const uint8_t*>(buf),
+                             static_cast<size_t>(end - buf),
+                             reinterpret_cast<uint8_t*>(out));
+      buf += ascii;
+      out += ascii;
+      continue;
+    }
+
+    uint32_t c = decodeJavaModifiedUtf8Char(&buf);
+    if (c >= 0xD800 && c <= 0xDFFF) {
+      auto next = buf;
+      char16_t low = 0;
+      if (c <= 0xDBFF && next < end) {
+        low = decodeJavaModifiedUtf8Char(&next);
+      }
+      if (low < 0xDC00 || low > 0xDFFF) {
+        // Unpaired surrogate, leave it to the converter.
+        return to_utf8(decode(begin, len));
+      }
+      c = 0x10000 + ((c - 0xD800) << 10) + (low - 0xDC00);
+      buf = next;
+    }
+    out = appendUtf8(out, c);
+  }
+  utf8.resize(static_cast<size_t>(out - &utf8[0]));
+  return utf8;
+}
+
+size_t JavaModifiedUtf8::asciiLength(const char* data, size_t length) {
+  return copyAscii(reinterpret_cast<const uint8_t*>(data), length, nullptr);
+}
+
+size_t JavaModifiedUtf8::asciiLength(const char16_t* data, size_t length) {
+  size_t i = 0;
+#if defined(GEODE_SIMD_SSE2)
+  for (; i + 8 <= length; i += 8) {
+    auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+    auto mask = static_cast<uint32_t>(_mm_movemask_epi8(isAscii(v)));
+    if (mask != 0xffff) {
+      return i + static_cast<size_t>(countTrailingZeros(~mask)) / 2;
+    }
+  }
+#endif
+  for (; i < length; i++) {
+    if (data[i] == 0 || data[i] >= 0x80) {
+      break;
+    }
+  }
+  return i;
+}
+
 char16_t JavaModifiedUtf8::decodeJavaModifiedUtf8Char(const char** pbuf) {
   char16_t c;
 
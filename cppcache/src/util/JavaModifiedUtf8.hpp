@@ -20,6 +20,7 @@
 #ifndef GEODE_UTIL_JAVAMODIFIEDUTF8_H_
 #define GEODE_UTIL_JAVAMODIFIEDUTF8_H_
 
+#include <cstdint>
 #include <string>
 
 namespace apache {
@@ -42,6 +43,26 @@ struct JavaModifiedUtf8 {
 
   static size_t encodedLength(const char16_t* data, size_t length);
 
+  /**
+   * Encodes the UTF-16 code units of data into out, writing at most limit
+   * bytes. Truncation may split the encoding of the last code unit.
+   *
+   * @return the length of the complete encoding, which may exceed limit.
+   */
+  static size_t encode(const char16_t* data, size_t length, uint8_t* out,
+                       size_t limit);
+
+  /**
+   * Encodes the UTF-8 string of length bytes into out, writing at most limit
+   * bytes, without an intermediate UTF-16 string. Only counts when out is
+   * nullptr.
+   *
+   * @return the length of the complete encoding, which may exceed limit, or
+   * std::string::npos if utf8 is not well formed UTF-8.
+   */
+  static size_t encode(const char* utf8, size_t length, uint8_t* out,
+                       size_t limit);
+
   /**
    * Converts given UTF-8 string to Java Modified UTF-8 string.
    */
@@ -59,6 +80,24 @@ struct JavaModifiedUtf8 {
 
   static std::u16string decode(const char* buf, uint16_t len);
 
+  /**
+   * Decodes len bytes of Java Modified UTF-8 into a UTF-8 string without an
+   * intermediate UTF-16 string.
+   */
+  static std::string toUtf8(const char* buf, uint16_t len);
+
+  /**
+   * Return the number of leading bytes of data that are ASCII characters other
+   * than NUL, which are encoded as themselves.
+   */
+  static size_t asciiLength(const char* data, size_t length);
+
+  /**
+   * Return the number of leading code units of data that are ASCII characters
+   * other than NUL.
+   */
+  static size_t asciiLength(const char16_t* data, size_t length);
+
   static char16_t decodeJavaModifiedUtf8Char(const char** pbuf);
 };
 
@@ -0,0 +1,114 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <geode/CacheableString.hpp>
+
+#include "TcrMessage.hpp"
+#include "ThinClientRegion.hpp"
+
+using apache::geode::client::CacheableKey;
+using apache::geode::client::CacheableString;
+using apache::geode::client::ChunkedGetAllResponse;
+using apache::geode::client::HashMapOfCacheable;
+using apache::geode::client::HashMapOfException;
+using apache::geode::client::MapOfUpdateCounters;
+using apache::geode::client::TcrMessage;
+
+namespace {
+
+class TcrMessageTestFixture : public TcrMessage {
+ public:
+  TcrMessageTestFixture() : TcrMessage() {}
+  ~TcrMessageTestFixture() noexcept override = default;
+};
+
+using ResultKeys = std::vector<std::shared_ptr<CacheableKey>>;
+
+class ChunkedGetAllResponseTest : public ::testing::Test {
+ protected:
+  std::unique_ptr<ChunkedGetAllResponse> makeResponse(
+      const std::shared_ptr<HashMapOfCacheable>& values,
+      const std::shared_ptr<HashMapOfException>& exceptions,
+      const std::shared_ptr<ResultKeys>& resultKeys) {
+    return std::unique_ptr<ChunkedGetAllResponse>(new ChunkedGetAllResponse(
+        msg_, nullptr, nullptr, values, exceptions, resultKeys, trackerMap_, 0,
+        false, responseLock_));
+  }
+
+  TcrMessageTestFixture msg_;
+  MapOfUpdateCounters trackerMap_;
+  std::recursive_mutex responseLock_;
+};
+
+}  // namespace
+
+TEST_F(ChunkedGetAllResponseTest, addMergesOtherResponse) {
+  auto values = std::make_shared<HashMapOfCacheable>();
+  auto exceptions = std::make_shared<HashMapOfException>();
+  auto resultKeys = std::make_shared<ResultKeys>();
+  auto key1 = CacheableString::create("key1");
+  values->emplace(key1, CacheableString::create("value1"));
+  resultKeys->push_back(key1);
+  auto response = makeResponse(values, exceptions, resultKeys);
+
+  auto chunkValues = std::make_shared<HashMapOfCacheable>();
+  auto chunkExceptions = std::make_shared<HashMapOfException>();
+  auto chunkResultKeys = std::make_shared<ResultKeys>();
+  auto key2 = CacheableString::create("key2");
+  auto key3 = CacheableString::create("key3");
+  chunkValues->emplace(key2, CacheableString::create("value2"));
+  chunkExceptions->emplace(key3, nullptr);
+  chunkResultKeys->push_back(key2);
+  chunkResultKeys->push_back(key3);
+  auto chunk = makeResponse(chunkValues, chunkExceptions, chunkResultKeys);
+
+  response->add(chunk.get());
+
+  ASSERT_EQ(2u, values->size());
+  EXPECT_EQ("value1", values->at(key1)->toString());
+  EXPECT_EQ("value2", values->at(key2)->toString());
+  ASSERT_EQ(1u, exceptions->size());
+  EXPECT_EQ(1u, exceptions->count(key3));
+  ASSERT_EQ(3u, resultKeys->size());
+  EXPECT_EQ(key1, (*resultKeys)[0]);
+  EXPECT_EQ(key2, (*resultKeys)[1]);
+  EXPECT_EQ(key3, (*resultKeys)[2]);
+  EXPECT_EQ(1u, chunkValues->size());
+}
+
+TEST_F(ChunkedGetAllResponseTest, addSkipsBuffersTheCallerDidNotRequest) {
+  auto values = std::make_shared<HashMapOfCacheable>();
+  auto response = makeResponse(values, nullptr, nullptr);
+
+  auto chunkValues = std::make_shared<HashMapOfCacheable>();
+  auto key = CacheableString::create("key");
+  chunkValues->emplace(key, CacheableString::create("value"));
+  auto chunk = makeResponse(chunkValues, nullptr, nullptr);
+
+  response->add(chunk.get());
+
+  ASSERT_EQ(1u, values->size());
+  EXPECT_EQ("value", values->at(key)->toString());
+  EXPECT_EQ(nullptr, response->getExceptions());
+  EXPECT_EQ(nullptr, response->getResultKeys());
+}
@@ -67,6 +67,168 @@ TEST(ClientMetadataServiceTest, testBucketAvailable) {
 
   ASSERT_EQ(2, ClientMetadataService::pruneNodes(mock, bucketSet)->size());
 }
+
+TEST(ClientMetadataServiceTest, sameLocationsIgnoresOrder) {
+  auto primary =
+      std::make_shared<BucketServerLocation>(0, 1, "server1", true, 1);
+  auto secondary =
+      std::make_shared<BucketServerLocation>(0, 2, "server2", false, 1);
+
+  EXPECT_TRUE(ClientMetadata::sameLocations({primary, secondary},
+                                            {secondary, primary}));
+  EXPECT_FALSE(ClientMetadata::sameLocations({primary, secondary}, {primary}));
+  EXPECT_FALSE(ClientMetadata::sameLocations(
+      {primary, secondary},
+      {primary,
+       std::make_shared<BucketServerLocation>(0, 2, "server2", true, 1)}));
+  EXPECT_FALSE(ClientMetadata::sameLocations(
+      {primary, secondary},
+      {primary,
+       std::make_shared<BucketServerLocation>(0, 2, "server2", false, 2)}));
+  EXPECT_FALSE(ClientMetadata::sameLocations(
+      {primary, secondary},
+      {primary,
+       std::make_shared<BucketServerLocation>(0, 3, "server2", false, 1)}));
+}
+
+TEST(ClientMetadataServiceTest, filterByServerGroup) {
+  auto ungrouped =
+      std::make_shared<BucketServerLocation>(0, 1, "server1", true, 1);
+  auto grouped = std::make_shared<BucketServerLocation>(
+      0, 2, "server2", false, 1, std::vector<std::string>{"group1"});
+  BucketServerLocationsType locations{ungrouped, grouped};
+
+  EXPECT_EQ(locations, ClientMetadata::filterByServerGroup(locations, ""));
+
+  auto filtered = ClientMetadata::filterByServerGroup(locations, "group1");
+  ASSERT_EQ(1, filtered.size());
+  EXPECT_EQ(grouped, filtered[0]);
+}
+
+TEST(ClientMetadataServiceTest, withBucketServerLocationsUpdatesMovedBuckets) {
+  auto metadata = std::make_shared<ClientMetadata>(3, "");
+  auto server1 =
+      std::make_shared<BucketServerLocation>(0, 1, "server1", true, 1);
+  auto server2 =
+      std::make_shared<BucketServerLocation>(1, 2, "server2", true, 1);
+
+  int32_t changedBuckets = -1;
+  auto updated = metadata->withBucketServerLocations({{server1}, {server2}},
+                                                     changedBuckets);
+  EXPECT_EQ(2, changedBuckets);
+  EXPECT_EQ(BucketServerLocationsType{server1},
+            updated->adviseServerLocations(0));
+  EXPECT_EQ(BucketServerLocationsType{server2},
+            updated->adviseServerLocations(1));
+  EXPECT_TRUE(metadata->adviseServerLocations(0).empty());
+
+  // An equal reply changes nothing and keeps the existing locations.
+  auto unchanged = updated->withBucketServerLocations(
+      {{std::make_shared<BucketServerLocation>(0, 1, "server1", true, 1)},
+       {server2}},
+      changedBuckets);
+  EXPECT_EQ(0, changedBuckets);
+  EXPECT_EQ(server1, unchanged->adviseServerLocations(0).at(0));
+
+  // A bucket missing from the reply is no longer routed to its old server.
+  auto moved = unchanged->withBucketServerLocations(
+      {{std::make_shared<BucketServerLocation>(0, 3, "server3", true, 2)}},
+      changedBuckets);
+  EXPECT_EQ(2, changedBuckets);
+  EXPECT_EQ("server3:3", moved->adviseServerLocations(0).at(0)->getEpString());
+  EXPECT_TRUE(moved->adviseServerLocations(1).empty());
+}
+
+TEST(ClientMetadataServiceTest, refreshScheduleSpacesRefreshesOfARegion) {
+  using clock = MetadataRefreshSchedule::clock;
+  MetadataRefreshSchedule schedule(std::chrono::milliseconds(100));
+  auto now = clock::now();
+
+  EXPECT_EQ(clock::time_point::min(), schedule.nextRefreshTime("/a"));
+
+  schedule.refreshed("/a", now);
+  EXPECT_EQ(now + std::chrono::milliseconds(100),
+            schedule.nextRefreshTime("/a"));
+  EXPECT_EQ(clock::time_point::min(), schedule.nextRefreshTime("/b"));
+
+  std::deque<std::string> queue{"/a", "/b"};
+  clock::time_point due;
+  EXPECT_EQ("/b", *schedule.nextDue(queue, due));
+  EXPECT_EQ(clock::time_point::min(), due);
+
+  schedule.refreshed("/b", now + std::chrono::milliseconds(50));
+  EXPECT_EQ("/a", *schedule.nextDue(queue, due));
+  EXPECT_EQ(now + std::chrono::milliseconds(100), due);
+
+  schedule.remove("/a");
+  EXPECT_EQ(1, schedule.size());
+  EXPECT_EQ(clock::time_point::min(), schedule.nextRefreshTime("/a"));
+}
+
+TEST(ClientMetadataServiceTest, snapshotCacheMissesOnNewGeneration) {
+  ClientMetadataSnapshotCache snapshots;
+  ClientMetadataGeneration region(ClientMetadataSnapshotCache::newGeneration());
+  auto metadata = std::make_shared<ClientMetadata>(3, "");
+
+  std::shared_ptr<ClientMetadata> found;
+  EXPECT_FALSE(snapshots.find(&region, region, found));
+
+  snapshots.store(&region, region, metadata);
+  ASSERT_TRUE(snapshots.find(&region, region, found));
+  EXPECT_EQ(metadata, found);
+
+  region = ClientMetadataSnapshotCache::newGeneration();
+  EXPECT_FALSE(snapshots.find(&region, region, found));
+
+  auto updated = std::make_shared<ClientMetadata>(3, "");
+  snapshots.store(&region, region, updated);
+  ASSERT_TRUE(snapshots.find(&region, region, found));
+  EXPECT_EQ(updated, found);
+}
+
+TEST(ClientMetadataServiceTest, snapshotCacheKeepsRegionsApart) {
+  ClientMetadataSnapshotCache snapshots;
+  ClientMetadataGeneration region1(
+      ClientMetadataSnapshotCache::newGeneration());
+  ClientMetadataGeneration region2(
+      ClientMetadataSnapshotCache::newGeneration());
+  auto metadata1 = std::make_shared<ClientMetadata>(3, "");
+  auto metadata2 = std::make_shared<ClientMetadata>(5, "");
+
+  snapshots.store(&region1, region1, metadata1);
+  snapshots.store(&region2, region2, metadata2);
+
+  std::shared_ptr<ClientMetadata> found;
+  ASSERT_TRUE(snapshots.find(&region1, region1, found));
+  EXPECT_EQ(metadata1, found);
+  ASSERT_TRUE(snapshots.find(&region2, region2, found));
+  EXPECT_EQ(metadata2, found);
+  EXPECT_FALSE(snapshots.find(&region1, region2, found));
+}
+
+TEST(ClientMetadataServiceTest, snapshotCacheEvictsOldestRegion) {
+  ClientMetadataSnapshotCache snapshots;
+  std::vector<std::unique_ptr<ClientMetadataGeneration>> regions;
+  for (size_t i = 0; i <= ClientMetadataSnapshotCache::SIZE; i++) {
+    regions.emplace_back(new ClientMetadataGeneration(
+        ClientMetadataSnapshotCache::newGeneration()));
+    snapshots.store(regions.back().get(), *regions.back(),
+                    std::make_shared<ClientMetadata>(3, ""));
+  }
+
+  std::shared_ptr<ClientMetadata> found;
+  EXPECT_FALSE(snapshots.find(regions[0].get(), *regions[0], found));
+  for (size_t i = 1; i < regions.size(); i++) {
+    EXPECT_TRUE(snapshots.find(regions[i].get(), *regions[i], found));
+  }
+}
+
+TEST(ClientMetadataServiceTest, snapshotGenerationsAreNeverReused) {
+  auto first = ClientMetadataSnapshotCache::newGeneration();
+  auto second = ClientMetadataSnapshotCache::newGeneration();
+  EXPECT_NE(0, first);
+  EXPECT_LT(first, second);
+}
 }  // namespace client
 }  // namespace geode
 }  // namespace apache
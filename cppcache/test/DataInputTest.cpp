@@ -28,6 +28,7 @@
 #include <gtest/gtest.h>
 
 #include <geode/CacheFactory.hpp>
+#include <geode/CacheableBuiltins.hpp>
 #include <geode/DataInput.hpp>
 
 #include "ByteArrayFixture.hpp"
@@ -38,6 +39,7 @@
 namespace {
 
 using apache::geode::client::ByteArray;
+using apache::geode::client::CacheableBytes;
 using apache::geode::client::CacheableString;
 using apache::geode::client::DataInputInternal;
 using apache::geode::client::DataOutputInternal;
@@ -78,6 +80,11 @@ class TestDataInput {
     m_dataInput.readBytesOnly(buffer, len);
   }
 
+  template <class T>
+  void readArrayOnly(T *values, size_t len) {
+    m_dataInput.readArrayOnly(values, len);
+  }
+
   void readBytes(uint8_t **buffer, int32_t *len) {
     m_dataInput.readBytes(buffer, len);
   }
@@ -469,6 +476,39 @@ TEST_F(DataInputTest, TestReadDouble) {
   EXPECT_DOUBLE_EQ(5.626349274901198e-221, value) << "Correct double";
 }
 
+TEST_F(DataInputTest, TestReadArrayOnly) {
+  TestDataInput dataInput(
+      "004200370D05"
+      "00000001FFFFFFFF00000002FFFFFFFE00000003FFFFFFFD00000004FFFFFFFCCAFEBABE"
+      "0ABCDEFFEDCBABCDFFFFFFFFFFFFFFFE"
+      "400921FB54442EEA");
+  int16_t shorts[3];
+  int32_t ints[9];
+  int64_t longs[2];
+  double doubles[1];
+  dataInput.readArrayOnly(shorts, 3);
+  dataInput.readArrayOnly(ints, 9);
+  dataInput.readArrayOnly(longs, 2);
+  dataInput.readArrayOnly(doubles, 1);
+
+  EXPECT_EQ(std::vector<int16_t>({66, 55, 3333}),
+            std::vector<int16_t>(shorts, shorts + 3));
+  EXPECT_EQ(std::vector<int32_t>({1, -1, 2, -2, 3, -3, 4, -4,
+                                  static_cast<int32_t>(0xCAFEBABE)}),
+            std::vector<int32_t>(ints, ints + 9));
+  EXPECT_EQ(std::vector<int64_t>({773738426788457421, -2}),
+            std::vector<int64_t>(longs, longs + 2));
+  EXPECT_DOUBLE_EQ(3.14159265359, doubles[0]);
+}
+
+TEST_F(DataInputTest, ThrowsWhenReadingArrayBeyondBuffer) {
+  TestDataInput dataInput("00000001FFFFFF");
+  int32_t ints[2];
+
+  ASSERT_THROW(dataInput.readArrayOnly(ints, 2),
+               apache::geode::client::OutOfRangeException);
+}
+
 TEST_F(DataInputTest, TestReadUTFNarrow) {
   TestDataInput dataInput(
       "001B596F7520686164206D65206174206D65617420746F726E61646F2E");
@@ -561,6 +601,20 @@ TEST_F(DataInputTest, TestReadStringToUtf16String) {
   EXPECT_EQ(expected, str);
 }
 
+TEST_F(DataInputTest, TestReadHugeStringToUtf16String) {
+  TestDataInput dataInput("5900000003005900650601");
+  auto str = dataInput.readString<char16_t>();
+
+  EXPECT_EQ(std::u16string(u"Ye\u0601"), str);
+}
+
+TEST_F(DataInputTest, ThrowsWhenReadingHugeStringBeyondBuffer) {
+  TestDataInput dataInput("590000000400590065");
+
+  ASSERT_THROW(dataInput.readString<char16_t>(),
+               apache::geode::client::OutOfRangeException);
+}
+
 TEST_F(DataInputTest, TestReadStringToUcs4String) {
   auto expected = std::u32string(U"You had me at");
   expected.push_back(0);
@@ -747,4 +801,66 @@ TEST_F(DataInputTest, TestReadNullArray) {
   EXPECT_EQ(static_cast<size_t>(0), dataInput.readBooleanArray().size());
 }
 
+TEST_F(DataInputTest, TestReadBytesSharedWithoutOwner) {
+  const uint8_t bytes[] = {1, 2, 3, 4};
+  DataInputUnderTest dataInput(bytes, sizeof(bytes));
+
+  EXPECT_FALSE(dataInput.readBytesShared(2));
+  EXPECT_EQ(static_cast<size_t>(0), dataInput.getBytesRead());
+}
+
+TEST_F(DataInputTest, TestReadBytesSharedKeepsBufferAlive) {
+  std::shared_ptr<const uint8_t> buffer(new uint8_t[4]{1, 2, 3, 4},
+                                        std::default_delete<uint8_t[]>());
+  std::weak_ptr<const uint8_t> released = buffer;
+  std::shared_ptr<const uint8_t> bytes;
+  {
+    DataInputUnderTest dataInput(buffer.get(), 4);
+    DataInputInternal::setBufferOwner(dataInput, std::move(buffer));
+    dataInput.read();
+    bytes = dataInput.readBytesShared(2);
+    EXPECT_EQ(static_cast<size_t>(3), dataInput.getBytesRead());
+    EXPECT_THROW(dataInput.readBytesShared(2),
+                 apache::geode::client::OutOfRangeException);
+  }
+
+  ASSERT_TRUE(bytes);
+  EXPECT_FALSE(released.expired());
+  EXPECT_EQ(2, bytes.get()[0]);
+  EXPECT_EQ(3, bytes.get()[1]);
+  bytes.reset();
+  EXPECT_TRUE(released.expired());
+}
+
+TEST_F(DataInputTest, TestCacheableBytesSharesBuffer) {
+  auto byteArray = ByteArray::fromString("030A0B0C");
+  std::shared_ptr<const uint8_t> buffer(byteArray.get(),
+                                        [](const uint8_t *) {});
+  DataInputUnderTest dataInput(buffer.get(), byteArray.size());
+  DataInputInternal::setBufferOwner(dataInput, buffer);
+
+  auto bytes = CacheableBytes::create();
+  bytes->fromData(dataInput);
+  EXPECT_EQ(3, bytes->length());
+  EXPECT_EQ(reinterpret_cast<const int8_t *>(buffer.get() + 1), bytes->data());
+  EXPECT_EQ(0x0B, (*bytes)[1]);
+  EXPECT_EQ(std::vector<int8_t>({0x0A, 0x0B, 0x0C}), bytes->value());
+
+  DataOutputInternal dataOutput;
+  bytes->toData(dataOutput);
+  EXPECT_EQ("030A0B0C",
+            ByteArray(dataOutput.getBuffer(), dataOutput.getBufferLength())
+                .toString());
+}
+
+TEST_F(DataInputTest, TestCacheableBytesCopiesWithoutOwner) {
+  auto byteArray = ByteArray::fromString("030A0B0C");
+  DataInputUnderTest dataInput(byteArray.get(), byteArray.size());
+
+  auto bytes = CacheableBytes::create();
+  bytes->fromData(dataInput);
+  EXPECT_EQ(std::vector<int8_t>({0x0A, 0x0B, 0x0C}), bytes->value());
+  EXPECT_EQ(bytes->value().data(), bytes->data());
+}
+
 }  // namespace
@@ -190,6 +190,26 @@ TEST_F(DataOutputTest, TestWriteIntInt64) {
   EXPECT_BYTEARRAY_EQ("0ABCDEFFEDCBABCD", dataOutput.getByteArray());
 }
 
+TEST_F(DataOutputTest, TestWriteArrayOnly) {
+  int16_t shorts[] = {66, 55, 3333};
+  int32_t ints[] = {1,  -1, 2,  -2, 3,
+                    -3, 4,  -4, static_cast<int32_t>(0xCAFEBABE)};
+  int64_t longs[] = {773738426788457421, -2};
+  double doubles[] = {3.14159265359};
+
+  TestDataOutput dataOutput(nullptr);
+  dataOutput.writeArrayOnly(shorts, 3);
+  dataOutput.writeArrayOnly(ints, 9);
+  dataOutput.writeArrayOnly(longs, 2);
+  dataOutput.writeArrayOnly(doubles, 1);
+  EXPECT_BYTEARRAY_EQ(
+      "004200370D05"
+      "00000001FFFFFFFF00000002FFFFFFFE00000003FFFFFFFD00000004FFFFFFFCCAFEBABE"
+      "0ABCDEFFEDCBABCDFFFFFFFFFFFFFFFE"
+      "400921FB54442EEA",
+      dataOutput.getByteArray());
+}
+
 TEST_F(DataOutputTest, TestWriteArrayLength) {
   TestDataOutput dataOutput(nullptr);
   dataOutput.writeArrayLen(static_cast<int32_t>(3435973836));
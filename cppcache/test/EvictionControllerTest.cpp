@@ -0,0 +1,58 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "EvictionController.hpp"
+
+using apache::geode::client::EvictionController;
+
+TEST(EvictionControllerTest, heapSizeIncludesChangesNotYetAddedUp) {
+  EvictionController controller(1, 10, nullptr);
+
+  controller.incrementHeapSize(100);
+  controller.incrementHeapSize(-40);
+  EXPECT_EQ(60, controller.getHeapSize());
+}
+
+TEST(EvictionControllerTest, heapSizeIsExactAcrossThreads) {
+  EvictionController controller(1024, 10, nullptr);
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 8; ++i) {
+    threads.emplace_back([&controller, i] {
+      for (int j = 0; j < 10000; ++j) {
+        controller.incrementHeapSize(1000 + i);
+        if (j % 2) {
+          controller.incrementHeapSize(-(1000 + i));
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  int64_t expected = 0;
+  for (int i = 0; i < 8; ++i) {
+    expected += 5000 * static_cast<int64_t>(1000 + i);
+  }
+  EXPECT_EQ(expected, controller.getHeapSize());
+}
@@ -0,0 +1,163 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <geode/ExceptionTypes.hpp>
+#include <geode/LZ4Compressor.hpp>
+
+using apache::geode::client::IllegalArgumentException;
+using apache::geode::client::LZ4Compressor;
+
+namespace {
+
+std::vector<int8_t> roundTrip(LZ4Compressor& compressor,
+                              const std::vector<int8_t>& input) {
+  auto compressed = compressor.compress(input.data(), input.size());
+  return compressor.decompress(compressed.data(), compressed.size());
+}
+
+class Random {
+ public:
+  explicit Random(uint32_t seed) : seed_(seed) {}
+
+  uint32_t next() {
+    seed_ = seed_ * 1103515245 + 12345;
+    return seed_ >> 16;
+  }
+
+ private:
+  uint32_t seed_;
+};
+
+// Input of the given length drawn from an alphabet of the given size, with
+// repeated runs, so that both literals and matches are exercised.
+std::vector<int8_t> randomInput(Random& random, size_t length,
+                                uint32_t alphabet) {
+  std::vector<int8_t> input;
+  input.reserve(length);
+  while (input.size() < length) {
+    if (input.size() > 8 && random.next() % 4 == 0) {
+      auto offset = 1 + random.next() % (input.size() - 1);
+      auto run = 4 + random.next() % 64;
+      for (uint32_t i = 0; i < run && input.size() < length; i++) {
+        input.push_back(input[input.size() - offset]);
+      }
+    } else {
+      input.push_back(static_cast<int8_t>(random.next() % alphabet));
+    }
+  }
+  return input;
+}
+
+}  // namespace
+
+TEST(LZ4CompressorTest, roundTripsEmptyAndShortInput) {
+  LZ4Compressor compressor;
+  for (size_t length = 0; length < 32; length++) {
+    std::vector<int8_t> input(length);
+    for (size_t i = 0; i < length; i++) {
+      input[i] = static_cast<int8_t>(i * 7);
+    }
+    EXPECT_EQ(input, roundTrip(compressor, input));
+  }
+}
+
+TEST(LZ4CompressorTest, compressesRepetitiveInput) {
+  std::string json;
+  for (int i = 0; i < 1000; i++) {
+    json += "{\"id\":" + std::to_string(i) + ",\"status\":\"active\"},";
+  }
+  std::vector<int8_t> input(json.begin(), json.end());
+
+  LZ4Compressor compressor;
+  auto compressed = compressor.compress(input.data(), input.size());
+  EXPECT_LT(compressed.size(), input.size() / 4);
+  EXPECT_EQ(input,
+            compressor.decompress(compressed.data(), compressed.size()));
+}
+
+TEST(LZ4CompressorTest, roundTripsIncompressibleInput) {
+  std::vector<int8_t> input(100000);
+  uint32_t seed = 1;
+  for (auto& byte : input) {
+    seed = seed * 1103515245 + 12345;
+    byte = static_cast<int8_t>(seed >> 16);
+  }
+
+  LZ4Compressor compressor;
+  EXPECT_EQ(input, roundTrip(compressor, input));
+}
+
+TEST(LZ4CompressorTest, rejectsCorruptInput) {
+  std::vector<int8_t> input(1000, 'a');
+  LZ4Compressor compressor;
+  auto compressed = compressor.compress(input.data(), input.size());
+
+  EXPECT_THROW(compressor.decompress(compressed.data(), compressed.size() - 1),
+               IllegalArgumentException);
+
+  // Claim more output than the blocks produce.
+  compressed[1] = 0x10;
+  EXPECT_THROW(compressor.decompress(compressed.data(), compressed.size()),
+               IllegalArgumentException);
+}
+
+TEST(LZ4CompressorTest, roundTripsRandomInput) {
+  Random random(7);
+  LZ4Compressor compressor;
+  for (int i = 0; i < 200; i++) {
+    auto length = random.next() % (i < 100 ? 300 : 70000);
+    auto alphabet = 1 + random.next() % 256;
+    auto input = randomInput(random, length, alphabet);
+    ASSERT_EQ(input, roundTrip(compressor, input))
+        << "length " << length << " alphabet " << alphabet;
+  }
+}
+
+TEST(LZ4CompressorTest, rejectsOrDecodesMutatedInput) {
+  Random random(11);
+  LZ4Compressor compressor;
+  auto input = randomInput(random, 5000, 16);
+  auto compressed = compressor.compress(input.data(), input.size());
+
+  for (int i = 0; i < 2000; i++) {
+    auto mutated = compressed;
+    auto changes = 1 + random.next() % 4;
+    for (uint32_t j = 0; j < changes; j++) {
+      mutated[random.next() % mutated.size()] =
+          static_cast<int8_t>(random.next());
+    }
+    if (random.next() % 4 == 0) {
+      mutated.resize(random.next() % mutated.size());
+    }
+
+    try {
+      auto output = compressor.decompress(mutated.data(), mutated.size());
+      size_t length = 0;
+      for (size_t k = 0; k < 4; k++) {
+        length |= static_cast<size_t>(static_cast<uint8_t>(mutated[k]))
+                  << (8 * k);
+      }
+      EXPECT_EQ(length, output.size());
+    } catch (const IllegalArgumentException&) {
+    }
+  }
+}
@@ -17,17 +17,50 @@
 
 #include <gtest/gtest.h>
 
+#include <geode/AttributesMutator.hpp>
 #include <geode/AuthenticatedView.hpp>
 #include <geode/Cache.hpp>
+#include <geode/CacheListener.hpp>
+#include <geode/CacheableString.hpp>
+#include <geode/EntryEvent.hpp>
+#include <geode/LZ4Compressor.hpp>
 #include <geode/PoolManager.hpp>
 #include <geode/RegionFactory.hpp>
 #include <geode/RegionShortcut.hpp>
 
+using apache::geode::client::Cacheable;
+using apache::geode::client::CacheableString;
 using apache::geode::client::CacheClosedException;
 using apache::geode::client::CacheFactory;
+using apache::geode::client::CacheListener;
+using apache::geode::client::EntryEvent;
+using apache::geode::client::LZ4Compressor;
 using apache::geode::client::RegionAttributesFactory;
 using apache::geode::client::RegionShortcut;
 
+namespace {
+
+class CountingCompressor : public LZ4Compressor {
+ public:
+  std::vector<int8_t> decompress(const int8_t* input, size_t length) override {
+    ++decompressions;
+    return LZ4Compressor::decompress(input, length);
+  }
+
+  int decompressions = 0;
+};
+
+class OldValueListener : public CacheListener {
+ public:
+  void afterUpdate(const EntryEvent& event) override {
+    oldValue = event.getOldValue();
+  }
+
+  std::shared_ptr<Cacheable> oldValue;
+};
+
+}  // namespace
+
 /**
  * Cache should close and throw exceptions on methods called after close.
  */
@@ -77,3 +110,54 @@ TEST(LocalRegionTest, subRegions) {
   auto subRegions3 = rootRegion3->subregions(true);
   EXPECT_EQ(0, subRegions3.size());
 }
+
+TEST(LocalRegionTest, compressedValuesReadBackAsCopies) {
+  auto cache = CacheFactory{}.set("log-level", "none").create();
+  auto region = cache.createRegionFactory(RegionShortcut::LOCAL)
+                    .setCompressor(std::make_shared<LZ4Compressor>())
+                    .create("compressed");
+
+  auto value = CacheableString::create(std::string(10000, 'x'));
+  region->put("key", value);
+
+  auto read = std::dynamic_pointer_cast<CacheableString>(region->get("key"));
+  ASSERT_NE(nullptr, read);
+  EXPECT_NE(value, read);
+  EXPECT_EQ(value->value(), read->value());
+
+  auto values = region->values();
+  ASSERT_EQ(1, values.size());
+  EXPECT_EQ(value->value(),
+            std::dynamic_pointer_cast<CacheableString>(values[0])->value());
+
+  region->put("key", CacheableString::create("updated"));
+  auto entry = region->getEntry("key");
+  EXPECT_EQ("updated", entry->getValue()->toString());
+
+  cache.close();
+}
+
+TEST(LocalRegionTest, compressedOldValuesDecompressedOnlyForEvents) {
+  auto cache = CacheFactory{}.set("log-level", "none").create();
+  auto compressor = std::make_shared<CountingCompressor>();
+  auto region = cache.createRegionFactory(RegionShortcut::LOCAL)
+                    .setCompressor(compressor)
+                    .create("compressed");
+
+  region->put("key", CacheableString::create("first"));
+  region->put("key", CacheableString::create("second"));
+  region->invalidate("key");
+  region->put("key", CacheableString::create("third"));
+  region->destroy("key");
+  EXPECT_EQ(0, compressor->decompressions);
+
+  auto listener = std::make_shared<OldValueListener>();
+  region->getAttributesMutator()->setCacheListener(listener);
+  region->put("key", CacheableString::create("fourth"));
+  region->put("key", CacheableString::create("fifth"));
+  EXPECT_EQ(1, compressor->decompressions);
+  ASSERT_NE(nullptr, listener->oldValue);
+  EXPECT_EQ("fourth", listener->oldValue->toString());
+
+  cache.close();
+}
@@ -0,0 +1,180 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "LocatorServerListCache.hpp"
+
+using apache::geode::client::LocatorServerListCache;
+using apache::geode::client::ServerLocation;
+
+namespace {
+
+const std::chrono::milliseconds ttl{1000};
+
+std::vector<ServerLocation> threeServers() {
+  return {ServerLocation("server1", 40401), ServerLocation("server2", 40402),
+          ServerLocation("server3", 40403)};
+}
+
+}  // namespace
+
+TEST(LocatorServerListCacheTest, fetchesOnceWithinTimeToLive) {
+  LocatorServerListCache cache;
+  auto now = LocatorServerListCache::clock::now();
+  int fetches = 0;
+  auto fetch = [&fetches]() {
+    fetches++;
+    return threeServers();
+  };
+
+  ServerLocation server;
+  for (int i = 0; i < 10; i++) {
+    ASSERT_TRUE(cache.getServer(server, {}, "", ttl, fetch,
+                                now + std::chrono::milliseconds(i)));
+  }
+  EXPECT_EQ(1, fetches);
+}
+
+TEST(LocatorServerListCacheTest, handsOutServersRoundRobin) {
+  LocatorServerListCache cache;
+  auto now = LocatorServerListCache::clock::now();
+  auto fetch = []() { return threeServers(); };
+
+  std::vector<ServerLocation> picked;
+  for (int i = 0; i < 6; i++) {
+    ServerLocation server;
+    ASSERT_TRUE(cache.getServer(server, {}, "", ttl, fetch, now));
+    picked.push_back(server);
+  }
+
+  std::set<ServerLocation> distinct(picked.begin(), picked.begin() + 3);
+  EXPECT_EQ(3, distinct.size());
+  for (size_t i = 3; i < picked.size(); i++) {
+    EXPECT_EQ(picked[i - 3], picked[i]);
+  }
+}
+
+TEST(LocatorServerListCacheTest, skipsExcludedServers) {
+  LocatorServerListCache cache;
+  auto now = LocatorServerListCache::clock::now();
+  auto fetch = []() { return threeServers(); };
+  std::set<ServerLocation> excluded{ServerLocation("server2", 40402)};
+
+  for (int i = 0; i < 6; i++) {
+    ServerLocation server;
+    ASSERT_TRUE(cache.getServer(server, excluded, "", ttl, fetch, now));
+    EXPECT_FALSE(ServerLocation("server2", 40402) == server);
+  }
+}
+
+TEST(LocatorServerListCacheTest, fetchesAgainAfterExpiry) {
+  LocatorServerListCache cache;
+  auto now = LocatorServerListCache::clock::now();
+  std::vector<ServerLocation> servers{ServerLocation("server1", 40401)};
+  int fetches = 0;
+  auto fetch = [&]() {
+    fetches++;
+    return servers;
+  };
+
+  ServerLocation server;
+  ASSERT_TRUE(cache.getServer(server, {}, "", ttl, fetch, now));
+  EXPECT_EQ(ServerLocation("server1", 40401), server);
+
+  servers = {ServerLocation("server4", 40404)};
+  ASSERT_TRUE(cache.getServer(server, {}, "", ttl, fetch, now + ttl / 2));
+  EXPECT_EQ(ServerLocation("server1", 40401), server);
+  EXPECT_EQ(1, fetches);
+
+  ASSERT_TRUE(cache.getServer(server, {}, "", ttl, fetch, now + ttl));
+  EXPECT_EQ(ServerLocation("server4", 40404), server);
+  EXPECT_EQ(2, fetches);
+}
+
+TEST(LocatorServerListCacheTest, fetchesAgainAfterEveryServerFailed) {
+  LocatorServerListCache cache;
+  auto now = LocatorServerListCache::clock::now();
+  std::vector<ServerLocation> servers{ServerLocation("server1", 40401)};
+  int fetches = 0;
+  auto fetch = [&]() {
+    fetches++;
+    return servers;
+  };
+
+  ServerLocation server;
+  ASSERT_TRUE(cache.getServer(server, {}, "", ttl, fetch, now));
+
+  // The only cached server failed, so the caller asks a locator instead.
+  EXPECT_FALSE(cache.getServer(server, {ServerLocation("server1", 40401)}, "",
+                               ttl, fetch, now));
+  EXPECT_EQ(1, fetches);
+
+  servers = {ServerLocation("server4", 40404)};
+  ASSERT_TRUE(cache.getServer(server, {}, "", ttl, fetch, now));
+  EXPECT_EQ(ServerLocation("server4", 40404), server);
+  EXPECT_EQ(2, fetches);
+}
+
+TEST(LocatorServerListCacheTest, fetchesAgainForAnotherServerGroup) {
+  LocatorServerListCache cache;
+  auto now = LocatorServerListCache::clock::now();
+  std::vector<std::string> groups;
+  std::string group;
+  auto fetch = [&]() {
+    groups.push_back(group);
+    return threeServers();
+  };
+
+  ServerLocation server;
+  group = "group1";
+  ASSERT_TRUE(cache.getServer(server, {}, group, ttl, fetch, now));
+  group = "group2";
+  ASSERT_TRUE(cache.getServer(server, {}, group, ttl, fetch, now));
+  ASSERT_TRUE(cache.getServer(server, {}, group, ttl, fetch, now));
+  EXPECT_EQ((std::vector<std::string>{"group1", "group2"}), groups);
+}
+
+TEST(LocatorServerListCacheTest, failedFetchFallsBackToLocators) {
+  LocatorServerListCache cache;
+  auto now = LocatorServerListCache::clock::now();
+  int fetches = 0;
+
+  ServerLocation server;
+  EXPECT_FALSE(cache.getServer(server, {}, "", ttl,
+                               [&fetches]() -> std::vector<ServerLocation> {
+                                 fetches++;
+                                 throw std::runtime_error("no locator");
+                               },
+                               now));
+  EXPECT_FALSE(cache.getServer(
+      server, {}, "", ttl,
+      [&fetches]() {
+        fetches++;
+        return std::vector<ServerLocation>{};
+      },
+      now));
+  EXPECT_EQ(2, fetches);
+
+  EXPECT_TRUE(cache.getServer(server, {}, "", ttl, threeServers, now));
+}
@@ -0,0 +1,98 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <geode/CacheableString.hpp>
+
+#include "NegativeLookupCache.hpp"
+
+using apache::geode::client::CacheableString;
+using apache::geode::client::NegativeLookupCache;
+
+TEST(NegativeLookupCacheTest, remembersAddedKeys) {
+  NegativeLookupCache cache(10, std::chrono::milliseconds::zero());
+  auto key = CacheableString::create("key");
+
+  EXPECT_FALSE(cache.contains(key));
+  cache.add(key, cache.generation());
+  EXPECT_TRUE(cache.contains(key));
+  EXPECT_TRUE(cache.contains(CacheableString::create("key")));
+  EXPECT_FALSE(cache.contains(CacheableString::create("other")));
+}
+
+TEST(NegativeLookupCacheTest, removeForgetsKey) {
+  NegativeLookupCache cache(10, std::chrono::milliseconds::zero());
+  auto key = CacheableString::create("key");
+  cache.add(key, cache.generation());
+
+  cache.remove(key);
+  EXPECT_FALSE(cache.contains(key));
+  EXPECT_EQ(0, cache.size());
+}
+
+TEST(NegativeLookupCacheTest, ignoresLookupsThatRacedWithUpdates) {
+  NegativeLookupCache cache(10, std::chrono::milliseconds::zero());
+  auto key = CacheableString::create("key");
+
+  auto generation = cache.generation();
+  cache.remove(key);
+  cache.add(key, generation);
+  EXPECT_FALSE(cache.contains(key));
+
+  generation = cache.generation();
+  cache.clear();
+  cache.add(key, generation);
+  EXPECT_FALSE(cache.contains(key));
+}
+
+TEST(NegativeLookupCacheTest, evictsOldestKeysAtLimit) {
+  NegativeLookupCache cache(2, std::chrono::milliseconds::zero());
+  auto first = CacheableString::create("first");
+  auto second = CacheableString::create("second");
+  auto third = CacheableString::create("third");
+
+  cache.add(first, cache.generation());
+  cache.add(second, cache.generation());
+  cache.add(third, cache.generation());
+  EXPECT_EQ(2, cache.size());
+  EXPECT_FALSE(cache.contains(first));
+  EXPECT_TRUE(cache.contains(second));
+  EXPECT_TRUE(cache.contains(third));
+}
+
+TEST(NegativeLookupCacheTest, zeroLimitRemembersNothing) {
+  NegativeLookupCache cache(0, std::chrono::milliseconds::zero());
+  auto key = CacheableString::create("key");
+
+  cache.add(key, cache.generation());
+  EXPECT_FALSE(cache.contains(key));
+}
+
+TEST(NegativeLookupCacheTest, forgetsExpiredKeys) {
+  NegativeLookupCache cache(10, std::chrono::milliseconds(10));
+  auto key = CacheableString::create("key");
+
+  cache.add(key, cache.generation());
+  EXPECT_TRUE(cache.contains(key));
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  EXPECT_FALSE(cache.contains(key));
+  EXPECT_EQ(0, cache.size());
+}
@@ -0,0 +1,80 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "PdxType.hpp"
+#include "PdxTypeRegistry.hpp"
+
+namespace {
+
+using apache::geode::client::PdxType;
+using apache::geode::client::PdxTypeRegistry;
+
+const std::string className = "com.example.Order";
+
+TEST(PdxTypeRegistryTest, findsTypesByIdAndClassName) {
+  PdxTypeRegistry pdxTypeRegistry(nullptr);
+  auto pdxType = std::make_shared<PdxType>(pdxTypeRegistry, className, true);
+
+  EXPECT_EQ(nullptr, pdxTypeRegistry.getPdxType(7));
+  EXPECT_EQ(nullptr, pdxTypeRegistry.getLocalPdxType(className));
+
+  pdxTypeRegistry.addPdxType(7, pdxType);
+  pdxTypeRegistry.addLocalPdxType(className, pdxType);
+
+  for (auto i = 0; i < 2; i++) {
+    EXPECT_EQ(pdxType, pdxTypeRegistry.getPdxType(7));
+    EXPECT_EQ(pdxType, pdxTypeRegistry.getLocalPdxType(className));
+  }
+
+  // Same cache slot as 7, but a different id.
+  EXPECT_EQ(nullptr, pdxTypeRegistry.getPdxType(7 + 64));
+}
+
+TEST(PdxTypeRegistryTest, clearDropsTypesCachedByThreads) {
+  PdxTypeRegistry pdxTypeRegistry(nullptr);
+  auto pdxType = std::make_shared<PdxType>(pdxTypeRegistry, className, true);
+  pdxTypeRegistry.addPdxType(7, pdxType);
+  pdxTypeRegistry.addLocalPdxType(className, pdxType);
+
+  std::thread([&] {
+    EXPECT_EQ(pdxType, pdxTypeRegistry.getPdxType(7));
+  }).join();
+  ASSERT_EQ(pdxType, pdxTypeRegistry.getPdxType(7));
+  ASSERT_EQ(pdxType, pdxTypeRegistry.getLocalPdxType(className));
+
+  pdxTypeRegistry.clear();
+
+  EXPECT_EQ(nullptr, pdxTypeRegistry.getPdxType(7));
+  EXPECT_EQ(nullptr, pdxTypeRegistry.getLocalPdxType(className));
+}
+
+TEST(PdxTypeRegistryTest, registriesDoNotShareCachedTypes) {
+  PdxTypeRegistry first(nullptr);
+  PdxTypeRegistry second(nullptr);
+  auto pdxType = std::make_shared<PdxType>(first, className, true);
+  first.addPdxType(7, pdxType);
+
+  ASSERT_EQ(pdxType, first.getPdxType(7));
+  EXPECT_EQ(nullptr, second.getPdxType(7));
+  EXPECT_EQ(pdxType, first.getPdxType(7));
+}
+
+}  // namespace
@@ -0,0 +1,212 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <geode/CacheableBuiltins.hpp>
+#include <geode/ExceptionTypes.hpp>
+#include <geode/Struct.hpp>
+
+#include "SelectResultsStreamImpl.hpp"
+
+namespace {
+
+using apache::geode::client::CacheableInt32;
+using apache::geode::client::CacheableVector;
+using apache::geode::client::QueryException;
+using apache::geode::client::SelectResultsStreamImpl;
+using apache::geode::client::Serializable;
+using apache::geode::client::Struct;
+
+std::shared_ptr<CacheableVector> values(int first, int count) {
+  auto values = CacheableVector::create();
+  for (auto i = first; i < first + count; i++) {
+    values->push_back(CacheableInt32::create(i));
+  }
+  return values;
+}
+
+int32_t valueOf(const std::shared_ptr<Serializable>& result) {
+  return std::dynamic_pointer_cast<CacheableInt32>(result)->value();
+}
+
+TEST(SelectResultsStreamImplTest, yieldsResultsInOrder) {
+  SelectResultsStreamImpl stream(2);
+  stream.start([&stream] {
+    for (auto chunk = 0; chunk < 10; chunk++) {
+      stream.push({}, *values(chunk * 3, 3));
+    }
+    stream.finish(nullptr);
+  });
+
+  std::shared_ptr<Serializable> result;
+  for (auto i = 0; i < 30; i++) {
+    ASSERT_TRUE(stream.next(result));
+    EXPECT_EQ(i, valueOf(result));
+  }
+  EXPECT_FALSE(stream.next(result));
+  EXPECT_FALSE(stream.next(result));
+}
+
+TEST(SelectResultsStreamImplTest, boundsChunksReceivedAhead) {
+  SelectResultsStreamImpl stream(2);
+  std::atomic<int> pushed{0};
+  stream.start([&stream, &pushed] {
+    for (auto chunk = 0; chunk < 5; chunk++) {
+      stream.push({}, *values(chunk, 1));
+      ++pushed;
+    }
+    stream.finish(nullptr);
+  });
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  EXPECT_EQ(2, pushed);
+
+  std::shared_ptr<Serializable> result;
+  ASSERT_TRUE(stream.next(result));
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  EXPECT_EQ(3, pushed);
+}
+
+TEST(SelectResultsStreamImplTest, groupsStructFields) {
+  SelectResultsStreamImpl stream(1);
+  stream.start([&stream] {
+    stream.push({"id", "count"}, *values(0, 4));
+    stream.finish(nullptr);
+  });
+
+  std::shared_ptr<Serializable> result;
+  ASSERT_TRUE(stream.next(result));
+  auto row = std::dynamic_pointer_cast<Struct>(result);
+  ASSERT_NE(nullptr, row);
+  EXPECT_EQ(0, valueOf((*row)["id"]));
+  EXPECT_EQ(1, valueOf((*row)["count"]));
+
+  ASSERT_TRUE(stream.next(result));
+  row = std::dynamic_pointer_cast<Struct>(result);
+  EXPECT_EQ(3, valueOf((*row)["count"]));
+  EXPECT_FALSE(stream.next(result));
+}
+
+TEST(SelectResultsStreamImplTest, structsOutliveTheStream) {
+  std::shared_ptr<Struct> row;
+  {
+    SelectResultsStreamImpl stream(1);
+    stream.start([&stream] {
+      stream.push({"id", "count"}, *values(0, 2));
+      stream.finish(nullptr);
+    });
+
+    std::shared_ptr<Serializable> result;
+    ASSERT_TRUE(stream.next(result));
+    row = std::dynamic_pointer_cast<Struct>(result);
+  }
+
+  ASSERT_NE(nullptr, row);
+  EXPECT_EQ(1, valueOf((*row)["count"]));
+  EXPECT_EQ("id", row->getFieldName(0));
+  EXPECT_EQ(0, row->getStructSet()->getFieldIndex("id"));
+}
+
+TEST(SelectResultsStreamImplTest, closeWaitsForReader) {
+  std::atomic<bool> finished{false};
+  SelectResultsStreamImpl stream(1);
+  stream.start([&stream, &finished] {
+    for (auto chunk = 0; chunk < 100; chunk++) {
+      stream.push({}, *values(chunk, 1));
+    }
+    stream.finish(nullptr);
+    finished = true;
+  });
+
+  stream.close();
+  EXPECT_TRUE(finished);
+  std::shared_ptr<Serializable> result;
+  EXPECT_FALSE(stream.next(result));
+}
+
+TEST(SelectResultsStreamImplTest, closedStreamIsNotStarted) {
+  SelectResultsStreamImpl stream(1);
+  stream.close();
+
+  std::atomic<bool> started{false};
+  stream.start([&started] { started = true; });
+
+  std::shared_ptr<Serializable> result;
+  EXPECT_THROW(stream.next(result),
+               apache::geode::client::CacheClosedException);
+  EXPECT_FALSE(started);
+}
+
+TEST(SelectResultsStreamImplTest, cancelReleasesReader) {
+  std::atomic<bool> finished{false};
+  {
+    SelectResultsStreamImpl stream(1);
+    stream.start([&stream, &finished] {
+      for (auto chunk = 0; chunk < 100; chunk++) {
+        stream.push({}, *values(chunk, 1));
+      }
+      stream.finish(nullptr);
+      finished = true;
+    });
+
+    std::shared_ptr<Serializable> result;
+    ASSERT_TRUE(stream.next(result));
+    stream.cancel();
+    EXPECT_FALSE(stream.next(result));
+  }
+  EXPECT_TRUE(finished);
+}
+
+TEST(SelectResultsStreamImplTest, throwsErrorAfterResults) {
+  SelectResultsStreamImpl stream(4);
+  stream.start([&stream] {
+    stream.push({}, *values(0, 2));
+    stream.finish(std::make_exception_ptr(QueryException("failed")));
+  });
+
+  std::shared_ptr<Serializable> result;
+  ASSERT_TRUE(stream.next(result));
+  ASSERT_TRUE(stream.next(result));
+  EXPECT_THROW(stream.next(result), QueryException);
+}
+
+TEST(SelectResultsStreamImplTest, failsIfRestartedAfterResultsWereRead) {
+  SelectResultsStreamImpl stream(4);
+  std::atomic<bool> read{false};
+  stream.start([&stream, &read] {
+    stream.push({}, *values(0, 1));
+    while (!read) {
+      std::this_thread::yield();
+    }
+    stream.restart();
+    stream.push({}, *values(0, 1));
+    stream.finish(nullptr);
+  });
+
+  std::shared_ptr<Serializable> result;
+  ASSERT_TRUE(stream.next(result));
+  read = true;
+  EXPECT_THROW(stream.next(result),
+               apache::geode::client::MessageException);
+}
+
+}  // namespace
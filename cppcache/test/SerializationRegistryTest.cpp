@@ -0,0 +1,146 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <geode/DataOutput.hpp>
+
+#include "DataOutputInternal.hpp"
+#include "SerializationRegistry.hpp"
+
+using apache::geode::client::DataInput;
+using apache::geode::client::DataOutput;
+using apache::geode::client::DataOutputInternal;
+using apache::geode::client::DataSerializable;
+using apache::geode::client::Serializable;
+using apache::geode::client::SerializationRegistry;
+using apache::geode::client::TheTypeMap;
+using apache::geode::client::TypeFactoryMethod;
+using apache::geode::client::internal::DataSerializableInternal;
+using apache::geode::client::internal::DataSerializablePrimitive;
+using apache::geode::client::internal::DSCode;
+using apache::geode::client::internal::DSFid;
+
+namespace {
+
+class TestInternal : public DataSerializableInternal {
+ public:
+  void toData(DataOutput& output) const override {
+    output.writeString("dispatch");
+  }
+
+  void fromData(DataInput&) override {}
+};
+
+class PrimitiveAndInternal : public DataSerializablePrimitive,
+                             public DataSerializableInternal {
+ public:
+  void toData(DataOutput& output) const override { output.writeInt(value_); }
+
+  void fromData(DataInput&) override {}
+
+  DSCode getDsCode() const override { return DSCode::CacheableInt32; }
+
+ private:
+  int32_t value_ = 1971;
+};
+
+class TestDataSerializable : public DataSerializable {
+ public:
+  void toData(DataOutput&) const override {}
+
+  void fromData(DataInput&) override {}
+
+  static std::shared_ptr<Serializable> create() {
+    return std::make_shared<TestDataSerializable>();
+  }
+};
+
+std::vector<uint8_t> serialize(const std::shared_ptr<Serializable>& value) {
+  SerializationRegistry serializationRegistry;
+  DataOutputInternal output;
+  serializationRegistry.serialize(value, output);
+  return std::vector<uint8_t>(output.getBuffer(),
+                              output.getBuffer() + output.getBufferLength());
+}
+
+}  // namespace
+
+TEST(SerializationRegistryTest, copiesSerializeLikeTheirSource) {
+  const auto value = std::make_shared<TestInternal>();
+  const auto copy = std::make_shared<TestInternal>(*value);
+
+  EXPECT_EQ(serialize(value), serialize(copy));
+}
+
+TEST(SerializationRegistryTest, dispatchPrefersPrimitiveOverInternal) {
+  const auto value = std::make_shared<PrimitiveAndInternal>();
+  const auto copy = std::make_shared<PrimitiveAndInternal>(*value);
+
+  const auto bytes = serialize(value);
+  ASSERT_EQ(5u, bytes.size());
+  EXPECT_EQ(static_cast<uint8_t>(DSCode::CacheableInt32), bytes[0]);
+  EXPECT_EQ(bytes, serialize(copy));
+}
+
+TEST(SerializationRegistryTest, fixedIdsInsideAndOutsideByteRange) {
+  TheTypeMap theTypeMap;
+  const TypeFactoryMethod factory = TestDataSerializable::create;
+
+  for (auto id : {DSFid::EventId, DSFid::DiskStoreId}) {
+    TypeFactoryMethod found;
+    theTypeMap.findDataSerializableFixedId(id, found);
+    EXPECT_TRUE(found);
+
+    theTypeMap.unbindDataSerializableFixedId(id);
+    found = nullptr;
+    theTypeMap.findDataSerializableFixedId(id, found);
+    EXPECT_FALSE(found);
+
+    theTypeMap.rebindDataSerializableFixedId(id, factory);
+    theTypeMap.findDataSerializableFixedId(id, found);
+    ASSERT_TRUE(found);
+    EXPECT_NE(nullptr,
+              std::dynamic_pointer_cast<TestDataSerializable>(found()));
+  }
+}
+
+TEST(SerializationRegistryTest, readersSeeConcurrentBindings) {
+  TheTypeMap theTypeMap;
+  std::atomic<bool> bound{false};
+
+  std::thread reader([&] {
+    TypeFactoryMethod found;
+    while (!found) {
+      theTypeMap.findDataSerializable(1971, found);
+    }
+    EXPECT_TRUE(bound);
+  });
+
+  bound = true;
+  theTypeMap.bindDataSerializable(TestDataSerializable::create, 1971);
+  reader.join();
+
+  int32_t id = 0;
+  EXPECT_TRUE(theTypeMap.findDataSerializableClassId(
+      typeid(TestDataSerializable), id));
+  EXPECT_EQ(1971, id);
+}
@@ -0,0 +1,160 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include <openssl/evp.h>
+#include <openssl/pem.h>
+#include <openssl/x509.h>
+
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/ssl/stream.hpp>
+#include <boost/asio/write.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+
+#include <gmock/gmock.h>
+
+#include <gtest/gtest.h>
+
+#include <geode/ExceptionTypes.hpp>
+
+#include "SslContext.hpp"
+#include "TcpSslConn.hpp"
+
+using ::testing::Eq;
+
+using apache::geode::client::Connector;
+using apache::geode::client::SslContext;
+using apache::geode::client::SslException;
+using apache::geode::client::TcpSslConn;
+
+namespace {
+
+std::string toPem(int (*write)(BIO*, void*), void* object) {
+  auto bio = BIO_new(BIO_s_mem());
+  write(bio, object);
+  char* data;
+  auto length = BIO_get_mem_data(bio, &data);
+  std::string pem(data, static_cast<std::size_t>(length));
+  BIO_free(bio);
+  return pem;
+}
+
+/** Creates a self signed certificate, returned as PEM, with its PEM key. */
+std::pair<std::string, std::string> createCertificate() {
+  EVP_PKEY* key = nullptr;
+  auto keyContext = EVP_PKEY_CTX_new_id(EVP_PKEY_EC, nullptr);
+  EVP_PKEY_keygen_init(keyContext);
+  EVP_PKEY_CTX_set_ec_paramgen_curve_nid(keyContext, NID_X9_62_prime256v1);
+  EVP_PKEY_keygen(keyContext, &key);
+  EVP_PKEY_CTX_free(keyContext);
+
+  auto certificate = X509_new();
+  X509_set_version(certificate, 2);
+  ASN1_INTEGER_set(X509_get_serialNumber(certificate), 1);
+  X509_gmtime_adj(X509_getm_notBefore(certificate), 0);
+  X509_gmtime_adj(X509_getm_notAfter(certificate), 3600);
+  X509_set_pubkey(certificate, key);
+  auto name = X509_get_subject_name(certificate);
+  auto commonName = reinterpret_cast<const unsigned char*>("localhost");
+  X509_NAME_add_entry_by_txt(name, "CN", MBSTRING_ASC, commonName, -1, -1, 0);
+  X509_set_issuer_name(certificate, name);
+  X509_sign(certificate, key, EVP_sha256());
+
+  auto pem = std::make_pair(
+      toPem(
+          [](BIO* bio, void* object) {
+            return PEM_write_bio_X509(bio, static_cast<X509*>(object));
+          },
+          certificate),
+      toPem(
+          [](BIO* bio, void* object) {
+            return PEM_write_bio_PrivateKey(bio, static_cast<EVP_PKEY*>(object),
+                                            nullptr, nullptr, 0, nullptr,
+                                            nullptr);
+          },
+          key));
+  X509_free(certificate);
+  EVP_PKEY_free(key);
+  return pem;
+}
+
+}  // namespace
+
+TEST(SslContextTest, throwsSslExceptionForMissingTrustStore) {
+  EXPECT_THROW(SslContext("does-not-exist.pem", "", ""), SslException);
+}
+
+TEST(SslContextTest, secondConnectionResumesSession) {
+  auto certificate = createCertificate();
+  auto trustStore = boost::filesystem::temp_directory_path() /
+                    boost::filesystem::unique_path("geode-%%%%%%.pem");
+  {
+    boost::filesystem::ofstream out(trustStore);
+    out << certificate.first;
+  }
+
+  boost::asio::ssl::context serverContext{
+      boost::asio::ssl::context::sslv23_server};
+  serverContext.use_certificate(boost::asio::buffer(certificate.first),
+                                boost::asio::ssl::context::pem);
+  serverContext.use_private_key(boost::asio::buffer(certificate.second),
+                                boost::asio::ssl::context::pem);
+
+  boost::asio::io_context io_context;
+  boost::asio::ip::tcp::acceptor acceptor(
+      io_context, boost::asio::ip::tcp::endpoint(
+                      boost::asio::ip::address_v4::loopback(), 0));
+  auto port = acceptor.local_endpoint().port();
+
+  // Each connection is sent one byte, so the client also reads the TLS 1.3
+  // session tickets the server sends after the handshake.
+  std::thread server([&] {
+    for (auto i = 0; i < 2; i++) {
+      boost::asio::ip::tcp::socket socket(io_context);
+      acceptor.accept(socket);
+      boost::asio::ssl::stream<boost::asio::ip::tcp::socket&> stream(
+          socket, serverContext);
+      boost::system::error_code error;
+      stream.handshake(boost::asio::ssl::stream_base::server, error);
+      if (error) {
+        continue;
+      }
+      boost::asio::write(stream, boost::asio::buffer("x", 1), error);
+      char ignored;
+      stream.read_some(boost::asio::buffer(&ignored, 1), error);
+    }
+  });
+
+  auto sslContext = std::make_shared<SslContext>(trustStore.string(), "", "");
+  for (auto i = 0; i < 2; i++) {
+    std::unique_ptr<Connector> connection(
+        new TcpSslConn("127.0.0.1", port, std::chrono::seconds(10), 0,
+                       sslContext));
+    char received = 0;
+    connection->receive(&received, 1, std::chrono::seconds(10));
+    EXPECT_THAT(received, Eq('x'));
+  }
+  server.join();
+  boost::filesystem::remove(trustStore);
+
+  EXPECT_THAT(sslContext->getResumedCount(), Eq(1));
+}
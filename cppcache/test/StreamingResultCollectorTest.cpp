@@ -0,0 +1,199 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <geode/CacheableBuiltins.hpp>
+#include <geode/ExceptionTypes.hpp>
+#include <geode/StreamingResultCollector.hpp>
+
+namespace {
+
+using apache::geode::client::Cacheable;
+using apache::geode::client::CacheableInt32;
+using apache::geode::client::FunctionExecutionException;
+using apache::geode::client::NotConnectedException;
+using apache::geode::client::StreamingResultCollector;
+
+int32_t valueOf(const std::shared_ptr<Cacheable>& result) {
+  return std::dynamic_pointer_cast<CacheableInt32>(result)->value();
+}
+
+TEST(StreamingResultCollectorTest, returnsResultsBeforeEnd) {
+  StreamingResultCollector rc;
+  rc.addResult(CacheableInt32::create(1));
+  rc.addResult(CacheableInt32::create(2));
+
+  std::shared_ptr<Cacheable> result;
+  ASSERT_TRUE(rc.next(result));
+  EXPECT_EQ(1, valueOf(result));
+
+  rc.addResult(CacheableInt32::create(3));
+  rc.endResults();
+
+  ASSERT_TRUE(rc.next(result));
+  EXPECT_EQ(2, valueOf(result));
+
+  auto rest = rc.getResult();
+  ASSERT_EQ(static_cast<size_t>(1), rest->size());
+  EXPECT_EQ(3, valueOf(rest->at(0)));
+  EXPECT_FALSE(rc.next(result));
+}
+
+TEST(StreamingResultCollectorTest, collectsFromManyProducers) {
+  StreamingResultCollector rc(8);
+  std::vector<std::thread> producers;
+  for (auto producer = 0; producer < 4; producer++) {
+    producers.emplace_back([&rc, producer] {
+      for (auto i = 0; i < 1000; i++) {
+        rc.addResult(CacheableInt32::create(producer * 1000 + i));
+      }
+    });
+  }
+  std::thread ender([&] {
+    for (auto& producer : producers) {
+      producer.join();
+    }
+    rc.endResults();
+  });
+
+  std::vector<int> lastSeen(4, -1);
+  std::shared_ptr<Cacheable> result;
+  auto count = 0;
+  while (rc.next(result)) {
+    auto value = valueOf(result);
+    EXPECT_LT(lastSeen[value / 1000], value % 1000);
+    lastSeen[value / 1000] = value % 1000;
+    count++;
+  }
+  ender.join();
+  EXPECT_EQ(4000, count);
+}
+
+TEST(StreamingResultCollectorTest, blocksProducerAtCapacity) {
+  StreamingResultCollector rc(2);
+  std::atomic<int> added(0);
+  std::thread producer([&] {
+    for (auto i = 0; i < 5; i++) {
+      rc.addResult(CacheableInt32::create(i));
+      added++;
+    }
+    rc.endResults();
+  });
+
+  for (auto i = 0; i < 100 && added < 2; i++) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  EXPECT_EQ(2, added);
+
+  std::shared_ptr<Cacheable> result;
+  auto expected = 0;
+  while (rc.next(result)) {
+    EXPECT_EQ(expected++, valueOf(result));
+  }
+  producer.join();
+  EXPECT_EQ(5, expected);
+}
+
+TEST(StreamingResultCollectorTest, cancelReleasesProducer) {
+  StreamingResultCollector rc(1);
+  std::thread producer([&] {
+    for (auto i = 0; i < 5; i++) {
+      rc.addResult(CacheableInt32::create(i));
+    }
+    rc.endResults();
+  });
+
+  std::shared_ptr<Cacheable> result;
+  ASSERT_TRUE(rc.next(result));
+  rc.cancel();
+  producer.join();
+  EXPECT_FALSE(rc.next(result));
+}
+
+TEST(StreamingResultCollectorTest, reExecutionAfterDeliveryFails) {
+  StreamingResultCollector rc;
+  rc.addResult(CacheableInt32::create(1));
+
+  std::shared_ptr<Cacheable> result;
+  ASSERT_TRUE(rc.next(result));
+
+  rc.clearResults();
+  rc.addResult(CacheableInt32::create(1));
+  rc.endResults();
+  EXPECT_THROW(rc.next(result), FunctionExecutionException);
+}
+
+TEST(StreamingResultCollectorTest, reExecutionBeforeDeliveryIsHidden) {
+  StreamingResultCollector rc;
+  rc.addResult(CacheableInt32::create(1));
+  rc.clearResults();
+  rc.addResult(CacheableInt32::create(2));
+  rc.endResults();
+
+  auto results = rc.getResult();
+  ASSERT_EQ(static_cast<size_t>(1), results->size());
+  EXPECT_EQ(2, valueOf(results->at(0)));
+}
+
+TEST(StreamingResultCollectorTest, failureIsRethrownByWaitingConsumer) {
+  StreamingResultCollector rc;
+  rc.addResult(CacheableInt32::create(1));
+
+  std::shared_ptr<Cacheable> result;
+  ASSERT_TRUE(rc.next(result));
+
+  std::thread executor([&] {
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    rc.setException(
+        std::make_exception_ptr(NotConnectedException("no servers")));
+  });
+
+  const auto start = std::chrono::steady_clock::now();
+  EXPECT_THROW(rc.next(result, std::chrono::seconds(30)),
+               NotConnectedException);
+  EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(5));
+  executor.join();
+  EXPECT_THROW(rc.getResult(), NotConnectedException);
+}
+
+TEST(StreamingResultCollectorTest, failureReleasesProducer) {
+  StreamingResultCollector rc(1);
+  rc.addResult(CacheableInt32::create(1));
+  std::thread producer([&] { rc.addResult(CacheableInt32::create(2)); });
+
+  rc.setException(std::make_exception_ptr(NotConnectedException("failed")));
+  producer.join();
+  std::shared_ptr<Cacheable> result;
+  EXPECT_THROW(rc.next(result), NotConnectedException);
+}
+
+TEST(StreamingResultCollectorTest, nextTimesOut) {
+  StreamingResultCollector rc;
+  std::shared_ptr<Cacheable> result;
+  EXPECT_THROW(rc.next(result, std::chrono::milliseconds(10)),
+               FunctionExecutionException);
+}
+
+}  // namespace
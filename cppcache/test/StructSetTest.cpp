@@ -20,8 +20,11 @@
 
 #include <gtest/gtest.h>
 
+using apache::geode::client::CacheableInt32;
 using apache::geode::client::CacheableString;
 using apache::geode::client::CacheableVector;
+using apache::geode::client::IllegalArgumentException;
+using apache::geode::client::OutOfRangeException;
 using apache::geode::client::Struct;
 using apache::geode::client::StructSetImpl;
 
@@ -112,3 +115,93 @@ TEST(StructSetTest, ForRange) {
     }
   }
 }
+
+TEST(StructSetTest, RowsShareValues) {
+  auto values = CacheableVector::create();
+  std::vector<std::string> fieldNames{"id", "name"};
+
+  for (int32_t i = 0; i < 3; i++) {
+    values->push_back(CacheableInt32::create(i));
+    values->push_back(CacheableString::create("name" + std::to_string(i)));
+  }
+
+  auto ss = StructSetImpl(values, fieldNames);
+  ASSERT_EQ(static_cast<size_t>(3), ss.size());
+
+  auto row = ss.getRow(1);
+  ASSERT_EQ(2, row.size());
+  EXPECT_EQ(values->at(2).get(), row[0].get());
+  EXPECT_EQ("name1", row["name"]->toString());
+  EXPECT_EQ(1, row.get<CacheableInt32>(0)->value());
+  EXPECT_EQ(nullptr, row.get<CacheableString>(0));
+  EXPECT_THROW(row[2], OutOfRangeException);
+  EXPECT_THROW(ss.getRow(3), IllegalArgumentException);
+}
+
+TEST(StructSetTest, DefaultRowViewsStruct) {
+  auto values = CacheableVector::create();
+  std::vector<std::string> fieldNames{"id", "name"};
+
+  for (int32_t i = 0; i < 3; i++) {
+    values->push_back(CacheableInt32::create(i));
+    values->push_back(CacheableString::create("name" + std::to_string(i)));
+  }
+
+  auto ss = StructSetImpl(values, fieldNames);
+
+  auto row = ss.StructSet::getRow(1);
+  ASSERT_EQ(2, row.size());
+  EXPECT_EQ(values->at(2).get(), row[0].get());
+  EXPECT_EQ("name1", row["name"]->toString());
+  EXPECT_EQ(1, row.get<CacheableInt32>(0)->value());
+  EXPECT_THROW(row[2], OutOfRangeException);
+  EXPECT_THROW(ss.StructSet::getRow(3), IllegalArgumentException);
+}
+
+TEST(StructSetTest, TypedColumn) {
+  auto values = CacheableVector::create();
+  std::vector<std::string> fieldNames{"id", "name"};
+
+  for (int32_t i = 0; i < 3; i++) {
+    values->push_back(CacheableInt32::create(i));
+    values->push_back(CacheableString::create("name" + std::to_string(i)));
+  }
+
+  auto ss = StructSetImpl(values, fieldNames);
+
+  auto ids = ss.getColumn<CacheableInt32>("id");
+  ASSERT_EQ(static_cast<size_t>(3), ids.size());
+  for (int32_t i = 0; i < 3; i++) {
+    EXPECT_EQ(i, ids[i]->value());
+  }
+
+  auto names = ss.getColumn<CacheableInt32>(1);
+  ASSERT_EQ(static_cast<size_t>(3), names.size());
+  EXPECT_EQ(nullptr, names[0]);
+}
+
+TEST(StructSetTest, StructCreatedOnce) {
+  auto values = CacheableVector::create();
+  std::vector<std::string> fieldNames{"id", "name"};
+
+  for (int32_t i = 0; i < 3; i++) {
+    values->push_back(CacheableInt32::create(i));
+    values->push_back(CacheableString::create("name" + std::to_string(i)));
+  }
+
+  auto ss = StructSetImpl(values, fieldNames);
+
+  auto first = std::dynamic_pointer_cast<Struct>(ss[2]);
+  ASSERT_NE(nullptr, first);
+  EXPECT_EQ(first, ss[2]);
+  EXPECT_EQ("name2", (*first)["name"]->toString());
+  EXPECT_EQ("name", first->getFieldName(1));
+
+  size_t rows = 0;
+  for (auto&& row : ss) {
+    ASSERT_NE(nullptr, row);
+    rows++;
+  }
+  EXPECT_EQ(static_cast<size_t>(3), rows);
+  EXPECT_EQ(first, *(ss.begin() + 2));
+}
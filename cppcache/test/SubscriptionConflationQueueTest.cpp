@@ -0,0 +1,117 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <geode/CacheableBuiltins.hpp>
+#include <geode/CacheableString.hpp>
+
+#include "EventId.hpp"
+#include "SubscriptionConflationQueue.hpp"
+
+using apache::geode::client::CacheableInt32;
+using apache::geode::client::CacheableString;
+using apache::geode::client::EventId;
+using apache::geode::client::SubscriptionConflationQueue;
+
+namespace {
+
+SubscriptionConflationQueue::Event event(const std::string& key, int32_t value,
+                                         bool isCreate = false) {
+  return {isCreate,
+          CacheableString::create(key),
+          CacheableInt32::create(value),
+          nullptr,
+          nullptr,
+          nullptr};
+}
+
+int32_t valueOf(const SubscriptionConflationQueue::Event& event) {
+  return std::dynamic_pointer_cast<CacheableInt32>(event.value)->value();
+}
+
+}  // namespace
+
+TEST(SubscriptionConflationQueueTest, keepsLatestValuePerKeyInOrder) {
+  SubscriptionConflationQueue queue;
+  bool conflated;
+  std::shared_ptr<EventId> superseded;
+
+  EXPECT_TRUE(queue.add(event("a", 1), conflated, superseded));
+  EXPECT_FALSE(conflated);
+  EXPECT_FALSE(queue.add(event("b", 1), conflated, superseded));
+  EXPECT_FALSE(queue.add(event("a", 2), conflated, superseded));
+  EXPECT_TRUE(conflated);
+  EXPECT_EQ(static_cast<size_t>(2), queue.size());
+
+  SubscriptionConflationQueue::Events events;
+  ASSERT_TRUE(queue.drain(events));
+  ASSERT_EQ(static_cast<size_t>(2), events.size());
+  EXPECT_EQ("a", events.front().key->toString());
+  EXPECT_EQ(2, valueOf(events.front()));
+  EXPECT_EQ("b", events.back().key->toString());
+  EXPECT_EQ(static_cast<size_t>(0), queue.size());
+}
+
+TEST(SubscriptionConflationQueueTest, mergedEventKeepsItsKind) {
+  SubscriptionConflationQueue queue;
+  bool conflated;
+  std::shared_ptr<EventId> superseded;
+  auto first = event("a", 1, true);
+  first.eventId = std::make_shared<EventId>(false);
+  auto firstId = first.eventId;
+
+  queue.add(std::move(first), conflated, superseded);
+  queue.add(event("a", 2), conflated, superseded);
+  EXPECT_EQ(firstId, superseded);
+
+  SubscriptionConflationQueue::Events events;
+  queue.takeAll(events);
+  ASSERT_EQ(static_cast<size_t>(1), events.size());
+  EXPECT_TRUE(events.front().isCreate);
+  EXPECT_EQ(2, valueOf(events.front()));
+  EXPECT_EQ(nullptr, events.front().eventId);
+}
+
+TEST(SubscriptionConflationQueueTest, takenEventsAreNotMergedInto) {
+  SubscriptionConflationQueue queue;
+  bool conflated;
+  std::shared_ptr<EventId> superseded;
+  queue.add(event("a", 1), conflated, superseded);
+
+  SubscriptionConflationQueue::Events events;
+  queue.takeAll(events);
+  queue.add(event("a", 2), conflated, superseded);
+  EXPECT_FALSE(conflated);
+  EXPECT_EQ(static_cast<size_t>(1), queue.size());
+  EXPECT_EQ(1, valueOf(events.front()));
+}
+
+TEST(SubscriptionConflationQueueTest, schedulesOneDrainAtATime) {
+  SubscriptionConflationQueue queue;
+  bool conflated;
+  std::shared_ptr<EventId> superseded;
+  SubscriptionConflationQueue::Events events;
+
+  EXPECT_TRUE(queue.add(event("a", 1), conflated, superseded));
+  queue.takeAll(events);
+  EXPECT_FALSE(queue.add(event("b", 1), conflated, superseded));
+
+  EXPECT_TRUE(queue.drain(events));
+  EXPECT_FALSE(queue.drain(events));
+  EXPECT_TRUE(queue.add(event("c", 1), conflated, superseded));
+}
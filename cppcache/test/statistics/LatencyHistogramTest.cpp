@@ -0,0 +1,159 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <thread>
+#include <vector>
+
+#include <gmock/gmock.h>
+
+#include <gtest/gtest.h>
+
+#include "statistics/GeodeStatisticsFactory.hpp"
+#include "statistics/LatencyHistogram.hpp"
+#include "statistics/StatisticsManager.hpp"
+
+using ::testing::Eq;
+using ::testing::Ge;
+using ::testing::Gt;
+using ::testing::Le;
+using ::testing::Lt;
+
+using apache::geode::statistics::LatencyHistogram;
+using apache::geode::statistics::StatisticsManager;
+
+TEST(LatencyHistogramTest, bucketIndexIsMonotonicAndWithinBounds) {
+  int32_t previous = 0;
+  for (int64_t nanos = 0; nanos < (int64_t{1} << 40);
+       nanos = nanos * 9 / 8 + 1) {
+    auto index = LatencyHistogram::bucketIndex(nanos);
+    EXPECT_THAT(index, Ge(previous));
+    EXPECT_THAT(index, Lt(LatencyHistogram::BUCKET_COUNT));
+    EXPECT_THAT(nanos, Lt(LatencyHistogram::bucketUpperBound(index)));
+    if (index > 0) {
+      EXPECT_THAT(nanos, Ge(LatencyHistogram::bucketUpperBound(index - 1)));
+    }
+    previous = index;
+  }
+}
+
+TEST(LatencyHistogramTest, bucketEdges) {
+  EXPECT_THAT(LatencyHistogram::bucketIndex(-1), Eq(0));
+  EXPECT_THAT(LatencyHistogram::bucketIndex(1023), Eq(0));
+  EXPECT_THAT(LatencyHistogram::bucketIndex(1024), Eq(1));
+  EXPECT_THAT(LatencyHistogram::bucketIndex(1024 + 127), Eq(1));
+  EXPECT_THAT(LatencyHistogram::bucketIndex(1024 + 128), Eq(2));
+  EXPECT_THAT(LatencyHistogram::bucketIndex(2047), Eq(8));
+  EXPECT_THAT(LatencyHistogram::bucketIndex(2048), Eq(9));
+  EXPECT_THAT(LatencyHistogram::bucketIndex((int64_t{1} << 36) - 1),
+              Eq(LatencyHistogram::BUCKET_COUNT - 2));
+  EXPECT_THAT(LatencyHistogram::bucketIndex(int64_t{1} << 36),
+              Eq(LatencyHistogram::BUCKET_COUNT - 1));
+}
+
+TEST(LatencyHistogramTest, relativeErrorIsBounded) {
+  for (int32_t index = 2; index < LatencyHistogram::BUCKET_COUNT - 1;
+       index++) {
+    auto lower = LatencyHistogram::bucketUpperBound(index - 1);
+    auto upper = LatencyHistogram::bucketUpperBound(index);
+    EXPECT_THAT(upper - lower, Le(lower / LatencyHistogram::SUB_BUCKET_COUNT));
+  }
+}
+
+TEST(LatencyHistogramTest, percentiles) {
+  StatisticsManager statisticsManager("", std::chrono::seconds(1), false,
+                                      nullptr);
+  LatencyHistogram histogram(statisticsManager.getStatisticsFactory(),
+                             "TestLatency", "percentiles");
+
+  EXPECT_THAT(histogram.getValueAtPercentile(99.0), Eq(0));
+
+  for (int64_t i = 1; i <= 1000; i++) {
+    histogram.record(i * 1000);
+  }
+
+  EXPECT_THAT(histogram.getCount(), Eq(1000));
+  EXPECT_THAT(histogram.getTotalTime(), Eq(500500000));
+
+  auto p50 = histogram.getValueAtPercentile(50.0);
+  EXPECT_THAT(p50, Gt(500000));
+  EXPECT_THAT(p50, Le(500000 + 500000 / LatencyHistogram::SUB_BUCKET_COUNT));
+
+  auto p99 = histogram.getValueAtPercentile(99.0);
+  EXPECT_THAT(p99, Gt(990000));
+  EXPECT_THAT(p99, Le(990000 + 990000 / LatencyHistogram::SUB_BUCKET_COUNT));
+
+  auto p100 = histogram.getValueAtPercentile(100.0);
+  EXPECT_THAT(p100, Gt(1000000));
+
+  histogram.close();
+}
+
+TEST(LatencyHistogramTest, concurrentRecording) {
+  StatisticsManager statisticsManager("", std::chrono::seconds(1), false,
+                                      nullptr);
+  LatencyHistogram histogram(statisticsManager.getStatisticsFactory(),
+                             "TestLatency", "concurrent");
+
+  constexpr int threadCount = 8;
+  constexpr int recordsPerThread = 10000;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < threadCount; t++) {
+    threads.emplace_back([&histogram, t] {
+      for (int i = 0; i < recordsPerThread; i++) {
+        histogram.record((t + 1) * 100000);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  int64_t bucketTotal = 0;
+  for (int32_t i = 0; i < LatencyHistogram::BUCKET_COUNT; i++) {
+    bucketTotal += histogram.getBucketCount(i);
+  }
+  EXPECT_THAT(histogram.getCount(), Eq(threadCount * recordsPerThread));
+  EXPECT_THAT(bucketTotal, Eq(threadCount * recordsPerThread));
+
+  histogram.close();
+}
+
+TEST(LatencyHistogramTest, sampledAsDistinctStatistics) {
+  StatisticsManager statisticsManager("", std::chrono::seconds(1), false,
+                                      nullptr);
+  auto factory = statisticsManager.getStatisticsFactory();
+  LatencyHistogram get(factory, "TestStatistics_getLatency", "/region");
+  LatencyHistogram put(factory, "TestStatistics_putLatency", "/region");
+  get.record(1500);
+  put.record(1500);
+  put.record(3000);
+
+  auto statistics = statisticsManager.getStatisticsSnapshot()->getStatistics();
+  ASSERT_THAT(statistics.size(), Eq(2u));
+  EXPECT_THAT(get.getStats()->getType()->getName(),
+              Eq("TestStatistics_getLatency"));
+  EXPECT_THAT(put.getStats()->getType()->getName(),
+              Eq("TestStatistics_putLatency"));
+  EXPECT_THAT(get.getStats()->getTextId(), Eq("/region"));
+  EXPECT_THAT(get.getStats()->getLong("count"), Eq(1));
+  EXPECT_THAT(put.getStats()->getLong("count"), Eq(2));
+  EXPECT_THAT(put.getStats()->getLong("totalTime"), Eq(4500));
+  EXPECT_THAT(put.getStats()->getLong("lt1536ns"), Eq(1));
+
+  get.close();
+  put.close();
+}
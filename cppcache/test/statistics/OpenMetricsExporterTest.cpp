@@ -0,0 +1,258 @@
+/*
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.
+ * The ASF licenses this file to You under the Apache License, Version 2.0
+ * (the "License"); you may not use this file except in compliance with
+ * the License.  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <boost/asio/connect.hpp>
+#include <boost/asio/read.hpp>
+#include <boost/asio/write.hpp>
+#include <boost/filesystem.hpp>
+
+#include <gmock/gmock.h>
+
+#include <gtest/gtest.h>
+
+#include "statistics/GeodeStatisticsFactory.hpp"
+#include "statistics/LatencyHistogram.hpp"
+#include "statistics/OpenMetricsExporter.hpp"
+#include "statistics/StatisticsManager.hpp"
+
+using ::testing::Eq;
+using ::testing::HasSubstr;
+using ::testing::Not;
+using ::testing::StartsWith;
+
+using apache::geode::statistics::LatencyHistogram;
+using apache::geode::statistics::OpenMetricsExporter;
+using apache::geode::statistics::Statistics;
+using apache::geode::statistics::StatisticsManager;
+
+namespace {
+
+Statistics* createTestStatistics(StatisticsManager& statisticsManager,
+                                 const std::string& textId) {
+  auto factory = statisticsManager.getStatisticsFactory();
+  auto type = factory->findType("TestStatistics");
+  if (!type) {
+    std::vector<std::shared_ptr<apache::geode::statistics::StatisticDescriptor>>
+        descriptors;
+    descriptors.push_back(
+        factory->createIntCounter("puts", "Number of puts", "entries", true));
+    descriptors.push_back(factory->createLongGauge(
+        "entries", "Current \\ entries\nin region", "entries", true));
+    type = factory->createType("TestStatistics", "Test statistics",
+                               std::move(descriptors));
+  }
+  return factory->createAtomicStatistics(type, textId);
+}
+
+}  // namespace
+
+TEST(OpenMetricsExporterTest, metricName) {
+  EXPECT_THAT(OpenMetricsExporter::metricName("geode_Pool-Stats_puts"),
+              Eq("geode_Pool_Stats_puts"));
+  EXPECT_THAT(OpenMetricsExporter::metricName("1st"), Eq("_1st"));
+}
+
+TEST(OpenMetricsExporterTest, renderGroupsInstancesByFamily) {
+  StatisticsManager statisticsManager("", std::chrono::seconds(1), false,
+                                      nullptr);
+  auto region1 = createTestStatistics(statisticsManager, "/region1");
+  auto region2 = createTestStatistics(statisticsManager, "/re\"gion2");
+  region1->incInt("puts", 3);
+  region2->setLong("entries", 42);
+
+  auto text = OpenMetricsExporter::render(
+      statisticsManager.getStatisticsSnapshot()->getStatistics());
+
+  EXPECT_THAT(text, HasSubstr("# TYPE geode_TestStatistics_puts counter\n"
+                              "# HELP geode_TestStatistics_puts Number of "
+                              "puts\n"
+                              "geode_TestStatistics_puts_total{name=\"/"
+                              "region1\"} 3\n"
+                              "geode_TestStatistics_puts_total{name=\"/"
+                              "re\\\"gion2\"} 0\n"));
+  EXPECT_THAT(text, HasSubstr("# TYPE geode_TestStatistics_entries gauge\n"
+                              "# HELP geode_TestStatistics_entries Current "
+                              "\\\\ entries\\nin region\n"));
+  EXPECT_THAT(text, HasSubstr("geode_TestStatistics_entries{name=\"/"
+                              "re\\\"gion2\"} 42\n"));
+  EXPECT_THAT(text.substr(text.size() - 6), Eq("# EOF\n"));
+
+  region1->close();
+  region2->close();
+}
+
+TEST(OpenMetricsExporterTest, renderSkipsClosedStatistics) {
+  StatisticsManager statisticsManager("", std::chrono::seconds(1), false,
+                                      nullptr);
+  auto region = createTestStatistics(statisticsManager, "/closed");
+  region->close();
+
+  auto text = OpenMetricsExporter::render(
+      statisticsManager.getStatisticsSnapshot()->getStatistics());
+
+  EXPECT_THAT(text, Not(HasSubstr("/closed")));
+}
+
+TEST(OpenMetricsExporterTest, renderLatencyHistograms) {
+  StatisticsManager statisticsManager("", std::chrono::seconds(1), false,
+                                      nullptr);
+  auto factory = statisticsManager.getStatisticsFactory();
+  LatencyHistogram region1(factory, "TestStatistics_getLatency", "/region1");
+  LatencyHistogram region2(factory, "TestStatistics_getLatency", "/region2");
+  region1.record(100);
+  region1.record(1500);
+  region1.record(int64_t{1} << 40);
+
+  auto text = OpenMetricsExporter::render(
+      statisticsManager.getStatisticsSnapshot()->getStatistics(),
+      {&region1, &region2});
+
+  EXPECT_THAT(text, HasSubstr("# TYPE geode_TestStatistics_getLatency "
+                              "histogram\n"));
+  EXPECT_THAT(text,
+              HasSubstr("geode_TestStatistics_getLatency_bucket{name=\"/"
+                        "region1\",le=\"1023\"} 1\n"
+                        "geode_TestStatistics_getLatency_bucket{name=\"/"
+                        "region1\",le=\"1151\"} 1\n"));
+  EXPECT_THAT(text,
+              HasSubstr("geode_TestStatistics_getLatency_bucket{name=\"/"
+                        "region1\",le=\"1535\"} 2\n"));
+  EXPECT_THAT(text,
+              HasSubstr("geode_TestStatistics_getLatency_bucket{name=\"/"
+                        "region1\",le=\"+Inf\"} 3\n"
+                        "geode_TestStatistics_getLatency_count{name=\"/"
+                        "region1\"} 3\n"));
+  EXPECT_THAT(text, HasSubstr("geode_TestStatistics_getLatency_count{name=\"/"
+                              "region2\"} 0\n"));
+  // Both instances are exposed in the one family.
+  EXPECT_THAT(text.find("# TYPE geode_TestStatistics_getLatency"),
+              Eq(text.rfind("# TYPE geode_TestStatistics_getLatency")));
+  // The backing statistics are not repeated as plain counters.
+  EXPECT_THAT(text, Not(HasSubstr("geode_TestStatistics_getLatency_count_")));
+  EXPECT_THAT(text.substr(text.size() - 6), Eq("# EOF\n"));
+
+  region1.close();
+  region2.close();
+}
+
+TEST(OpenMetricsExporterTest, snapshotOutlivesRetiredStatistics) {
+  StatisticsManager statisticsManager("", std::chrono::seconds(1), false,
+                                      nullptr);
+  auto region = createTestStatistics(statisticsManager, "/retired");
+  auto snapshot = statisticsManager.getStatisticsSnapshot();
+  ASSERT_THAT(snapshot->getStatistics().size(), Eq(1u));
+
+  region->close();
+  {
+    std::lock_guard<std::recursive_mutex> guard(
+        statisticsManager.getListMutex());
+    auto& statsList = statisticsManager.getStatsList();
+    statsList.erase(std::find(statsList.begin(), statsList.end(), region));
+    statisticsManager.retireStatistics(region);
+  }
+
+  EXPECT_THAT(statisticsManager.getStatisticsSnapshot()->getStatistics().size(),
+              Eq(0u));
+  // The retired instance is still readable through the older snapshot.
+  EXPECT_THAT(snapshot->getStatistics()[0]->getTextId(), Eq("/retired"));
+}
+
+#ifdef BOOST_ASIO_HAS_LOCAL_SOCKETS
+TEST(OpenMetricsExporterTest, servesMetricsOverUnixSocket) {
+  StatisticsManager statisticsManager("", std::chrono::seconds(1), false,
+                                      nullptr);
+  auto region = createTestStatistics(statisticsManager, "/served");
+  region->incInt("puts", 7);
+  LatencyHistogram latency(statisticsManager.getStatisticsFactory(),
+                           "TestStatistics_putLatency", "/served");
+  latency.record(2000);
+  statisticsManager.addLatencyHistogram(&latency);
+
+  auto socketPath = (boost::filesystem::temp_directory_path() /
+                     boost::filesystem::unique_path("geode-%%%%%%.sock"))
+                        .string();
+  OpenMetricsExporter exporter(0, socketPath);
+  exporter.listen();
+  exporter.start(&statisticsManager);
+
+  boost::asio::io_context io_context;
+  boost::asio::local::stream_protocol::socket socket(io_context);
+  socket.connect(boost::asio::local::stream_protocol::endpoint(socketPath));
+  std::string request = "GET /metrics HTTP/1.1\r\nHost: localhost\r\n\r\n";
+  boost::asio::write(socket, boost::asio::buffer(request));
+
+  std::string response;
+  boost::system::error_code error;
+  boost::asio::read(socket, boost::asio::dynamic_buffer(response), error);
+
+  EXPECT_THAT(response, StartsWith("HTTP/1.1 200 OK\r\n"));
+  EXPECT_THAT(response, HasSubstr(OpenMetricsExporter::CONTENT_TYPE));
+  EXPECT_THAT(response,
+              HasSubstr("geode_TestStatistics_puts_total{name=\"/served\"} 7"));
+  EXPECT_THAT(response, HasSubstr("geode_TestStatistics_putLatency_count{name="
+                                  "\"/served\"} 1\n"));
+
+  exporter.stop();
+  statisticsManager.removeLatencyHistogram(&latency);
+  latency.close();
+  region->close();
+}
+
+TEST(OpenMetricsExporterTest, closesConnectionsWithoutRequest) {
+  StatisticsManager statisticsManager("", std::chrono::seconds(1), false,
+                                      nullptr);
+  auto socketPath = (boost::filesystem::temp_directory_path() /
+                     boost::filesystem::unique_path("geode-%%%%%%.sock"))
+                        .string();
+  OpenMetricsExporter exporter(0, socketPath, std::chrono::milliseconds(100));
+  exporter.listen();
+  exporter.start(&statisticsManager);
+
+  boost::asio::io_context io_context;
+  boost::asio::local::stream_protocol::socket socket(io_context);
+  socket.connect(boost::asio::local::stream_protocol::endpoint(socketPath));
+  std::string request = "GET /metrics HTTP/1.1\r\n";
+  boost::asio::write(socket, boost::asio::buffer(request));
+
+  auto start = std::chrono::steady_clock::now();
+  std::string response;
+  boost::system::error_code error;
+  boost::asio::read(socket, boost::asio::dynamic_buffer(response), error);
+
+  EXPECT_THAT(error, Eq(boost::asio::error::eof));
+  EXPECT_THAT(response, Eq(""));
+  EXPECT_LT(std::chrono::steady_clock::now() - start,
+            OpenMetricsExporter::DEFAULT_REQUEST_TIMEOUT);
+
+  exporter.stop();
+}
+
+TEST(OpenMetricsExporterTest, listenFailsWithoutStarting) {
+  auto socketPath = (boost::filesystem::temp_directory_path() /
+                     boost::filesystem::unique_path("geode-%%%%%%") /
+                     "missing-directory" / "exporter.sock")
+                        .string();
+  OpenMetricsExporter exporter(0, socketPath);
+
+  EXPECT_THROW(exporter.listen(), apache::geode::client::IllegalStateException);
+}
+#endif
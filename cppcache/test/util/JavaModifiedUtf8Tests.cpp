@@ -15,6 +15,7 @@
  * limitations under the License.
  */
 
+#include <cstring>
 #include <string>
 #include <util/JavaModifiedUtf8.hpp>
 
@@ -51,3 +52,63 @@ TEST(JavaModifiedUtf8Tests, DecodeStringWithInlineNullChar) {
       JavaModifiedUtf8::decode(reinterpret_cast<const char*>(buf.get()), 35);
   EXPECT_EQ(expected, actual);
 }
+
+TEST(JavaModifiedUtf8Tests, EncodeAndDecodeAcrossBlocks) {
+  // Long enough for the vectorized paths, with a character that is not
+  // encoded as itself at every position of the leading blocks.
+  for (size_t position = 0; position < 48; position++) {
+    for (auto c : {u'\0', u'\u00F6', u'\u4E2D', u'\uFFFF'}) {
+      std::u16string utf16(64, u'x');
+      utf16[position] = c;
+
+      std::string expected;
+      for (auto&& unit : utf16) {
+        JavaModifiedUtf8::encode(unit, expected);
+      }
+      auto length = static_cast<uint16_t>(expected.length());
+
+      EXPECT_EQ(expected.length(), JavaModifiedUtf8::encodedLength(utf16));
+      EXPECT_EQ(expected, JavaModifiedUtf8::fromString(utf16));
+      EXPECT_EQ(utf16, JavaModifiedUtf8::decode(expected.data(), length));
+      EXPECT_EQ(position,
+                JavaModifiedUtf8::asciiLength(utf16.data(), utf16.length()));
+      EXPECT_EQ(position,
+                JavaModifiedUtf8::asciiLength(expected.data(), length));
+    }
+  }
+}
+
+TEST(JavaModifiedUtf8Tests, EncodeWithLimit) {
+  std::u16string utf16(u"You had me at meat tornad\u00F6!");
+  uint8_t buf[64];
+  std::memset(buf, 0xFF, sizeof(buf));
+
+  // The complete length is returned and the last character cut short.
+  EXPECT_EQ(28,
+            JavaModifiedUtf8::encode(utf16.data(), utf16.length(), buf, 26));
+  EXPECT_EQ(0, std::memcmp("You had me at meat tornad\xC3", buf, 26));
+  EXPECT_EQ(0xFF, buf[26]);
+}
+
+TEST(JavaModifiedUtf8Tests, FromUtf8WithInlineNullAndSupplementaryChar) {
+  auto utf8 = std::string("You had me at");
+  utf8.push_back(0);
+  utf8.append(u8"meat tornad\u00F6!\U000F0000");
+
+  auto buf = ByteArray::fromString(
+      "596F7520686164206D65206174C0806D65617420746F726E6164C3B621EDAE80EDB080");
+  auto expected = std::string(reinterpret_cast<const char*>(buf.get()), 35);
+
+  EXPECT_EQ(35, JavaModifiedUtf8::encodedLength(utf8));
+  EXPECT_EQ(expected, JavaModifiedUtf8::fromString(utf8));
+  EXPECT_EQ(utf8, JavaModifiedUtf8::toUtf8(expected.data(), 35));
+}
+
+TEST(JavaModifiedUtf8Tests, EncodeRejectsIllFormedUtf8) {
+  for (auto utf8 : {"\x80", "\xC0\x80", "\xC3", "\xE0\x80\x80", "\xED\xA0\x80",
+                    "\xF4\x90\x80\x80", "\xF5\x80\x80\x80"}) {
+    EXPECT_EQ(std::string::npos,
+              JavaModifiedUtf8::encode(utf8, std::strlen(utf8), nullptr, 0))
+        << utf8;
+  }
+}
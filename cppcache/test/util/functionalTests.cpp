@@ -15,6 +15,7 @@
  * limitations under the License.
  */
 
+#include <random>
 #include <string>
 
 #include <gtest/gtest.h>
@@ -41,3 +42,80 @@ TEST(string, geodeHash) {
 
   EXPECT_EQ(701776767, hash(str));
 }
+
+TEST(string, geodeHashMatchesUtf16HashAcrossBlocks) {
+  // Long enough for the vectorized ASCII path, with a character that is not
+  // ASCII at every position of the leading blocks.
+  for (size_t position = 0; position < 80; position++) {
+    std::string utf8;
+    std::u16string utf16;
+    for (size_t i = 0; i < 100; i++) {
+      if (i == position) {
+        utf8.append(u8"\u00F6");
+        utf16.push_back(u'\u00F6');
+      } else {
+        utf8.push_back(static_cast<char>(i % 128));
+        utf16.push_back(static_cast<char16_t>(i % 128));
+      }
+    }
+
+    EXPECT_EQ(geode_hash<std::u16string>{}(utf16),
+              geode_hash<std::string>{}(utf8));
+    EXPECT_EQ(geode_hash<std::u16string>{}(utf16.substr(0, position)),
+              geode_hash<std::string>{}(utf8.substr(0, position)));
+  }
+}
+
+TEST(string, geodeHashMatchesUtf16HashForRandomStrings) {
+  // Differential fuzzing of the ASCII fast path against the UTF-16 hash, with
+  // a fixed seed so a failure can be reproduced. Mostly ASCII, so that the
+  // blocks are used, with non ASCII characters of every UTF-8 length.
+  std::mt19937 random(20261018);
+  std::uniform_int_distribution<size_t> lengths(0, 4200);
+  std::uniform_int_distribution<int> kinds(0, 199);
+  std::uniform_int_distribution<uint32_t> ascii(0, 0x7F);
+  std::uniform_int_distribution<uint32_t> twoBytes(0x80, 0x7FF);
+  std::uniform_int_distribution<uint32_t> threeBytes(0xE000, 0xFFFF);
+  std::uniform_int_distribution<uint32_t> fourBytes(0x10000, 0x10FFFF);
+
+  for (int iteration = 0; iteration < 500; iteration++) {
+    std::string utf8;
+    std::u16string utf16;
+    auto length = lengths(random);
+    for (size_t i = 0; i < length; i++) {
+      auto kind = kinds(random);
+      uint32_t c;
+      if (kind < 196) {
+        c = ascii(random);
+        utf8.push_back(static_cast<char>(c));
+      } else if (kind < 197) {
+        c = twoBytes(random);
+        utf8.push_back(static_cast<char>(0xC0 | (c >> 6)));
+        utf8.push_back(static_cast<char>(0x80 | (c & 0x3F)));
+      } else if (kind < 198) {
+        c = threeBytes(random);
+        utf8.push_back(static_cast<char>(0xE0 | (c >> 12)));
+        utf8.push_back(static_cast<char>(0x80 | ((c >> 6) & 0x3F)));
+        utf8.push_back(static_cast<char>(0x80 | (c & 0x3F)));
+      } else {
+        c = fourBytes(random);
+        utf8.push_back(static_cast<char>(0xF0 | (c >> 18)));
+        utf8.push_back(static_cast<char>(0x80 | ((c >> 12) & 0x3F)));
+        utf8.push_back(static_cast<char>(0x80 | ((c >> 6) & 0x3F)));
+        utf8.push_back(static_cast<char>(0x80 | (c & 0x3F)));
+      }
+      if (c >= 0x10000) {
+        auto supplementary = c - 0x10000;
+        utf16.push_back(static_cast<char16_t>(0xD800 + (supplementary >> 10)));
+        utf16.push_back(
+            static_cast<char16_t>(0xDC00 + (supplementary & 0x3FF)));
+      } else {
+        utf16.push_back(static_cast<char16_t>(c));
+      }
+    }
+
+    ASSERT_EQ(geode_hash<std::u16string>{}(utf16),
+              geode_hash<std::string>{}(utf8))
+        << "iteration " << iteration << ", length " << length;
+  }
+}